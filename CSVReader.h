@@ -86,6 +86,81 @@ namespace CSVReader
         struct make_index_sequence<0, I...> : index_sequence<I...> {};
     }
 
+    // This is a feature built-in for C++17 (std::basic_string_view)
+    /*!
+     * \brief Non-owning reference to a part of a string
+     *
+     * The referenced string must stay alive and unchanged while the view is used.
+     */
+    template<class CharT, class Traits = std::char_traits<CharT> >
+    class BasicStringView
+    {
+    public:
+        typedef CharT value_type;
+        typedef Traits traits_type;
+
+        BasicStringView() : _data(nullptr), _size(0) {}
+        BasicStringView(const CharT *str) : _data(str), _size(Traits::length(str)) {}
+        BasicStringView(const CharT *data, size_t size) : _data(data), _size(size) {}
+        BasicStringView(const std::basic_string<CharT, Traits> &str) : _data(str.data()), _size(str.size()) {}
+
+        const CharT *data() const
+        {
+            return _data;
+        }
+        size_t size() const
+        {
+            return _size;
+        }
+        size_t length() const
+        {
+            return _size;
+        }
+        bool empty() const
+        {
+            return _size == 0;
+        }
+        CharT operator[](size_t pos) const
+        {
+            return _data[pos];
+        }
+
+        BasicStringView substr(size_t pos, size_t count) const
+        {
+            if(pos > _size)
+                pos = _size;
+            if(count > _size - pos)
+                count = _size - pos;
+            return BasicStringView(_data + pos, count);
+        }
+
+        bool operator==(const BasicStringView &other) const
+        {
+            return (_size == other._size) && (Traits::compare(_data, other._data, _size) == 0);
+        }
+        bool operator!=(const BasicStringView &other) const
+        {
+            return !operator==(other);
+        }
+        bool operator==(const CharT *str) const
+        {
+            return operator==(BasicStringView(str));
+        }
+        bool operator!=(const CharT *str) const
+        {
+            return !operator==(BasicStringView(str));
+        }
+
+        operator std::basic_string<CharT, Traits>() const
+        {
+            return std::basic_string<CharT, Traits>(_data, _size);
+        }
+
+    private:
+        const CharT *_data;
+        size_t _size;
+    };
+
     // This is for the CSVBatchReader
     // This template class depends on .push_back()
     template<class ContainerValueT, class ContainerT>
@@ -99,6 +174,27 @@ namespace CSVReader
 
     namespace detail
     {
+        template<class T>
+        struct CSVVoid
+        {
+            typedef void type;
+        };
+
+        /*
+         * String utils may declare the field_type to read fields as views of
+         * the current line instead of copying every field into a new string.
+         */
+        template<class StrT, class StrTUtils, class = void>
+        struct CSVFieldType
+        {
+            typedef StrT type;
+        };
+
+        template<class StrT, class StrTUtils>
+        struct CSVFieldType<StrT, StrTUtils, typename CSVVoid<typename StrTUtils::field_type>::type>
+        {
+            typedef typename StrTUtils::field_type type;
+        };
 
         template<class StrT,
                  class CharT,
@@ -107,22 +203,41 @@ namespace CSVReader
         class CSVReaderBase
         {
         protected:
+            typedef typename CSVFieldType<StrT, StrTUtils>::type FieldT;
+
             size_t _currentCharIndex;
             CharT _sep;
-            StrT _currentLine; // Will be written by the derived class
+            FieldT _currentLine; // Will be written by the derived class
+            StrT _lineStorage; // Keeps the line data when fields are views
             int _fieldTracker; // Will be written by the derived class
             int _lineTracker;  // Will be written by the derived class
 
             CSVReaderBase(CharT sep) : _currentCharIndex(0u), _sep(sep),
                 _currentLine(""), _fieldTracker(0), _lineTracker(0) {}
 
-            inline StrT NextField()
+            inline void SetLine(StrT &&line)
+            {
+                SetLine(std::move(line), std::is_same<StrT, FieldT>());
+            }
+
+            inline void SetLine(StrT &&line, std::true_type)
+            {
+                _currentLine = std::move(line);
+            }
+
+            inline void SetLine(StrT &&line, std::false_type)
+            {
+                _lineStorage = std::move(line);
+                _currentLine = FieldT(_lineStorage);
+            }
+
+            inline FieldT NextField()
             {
                 size_t newCharIndex = _currentCharIndex;
                 if(!StrTUtils::find(_currentLine, _sep, newCharIndex))
                     newCharIndex = StrTUtils::length(_currentLine);
 
-                StrT next = StrTUtils::substring(_currentLine, _currentCharIndex, newCharIndex - _currentCharIndex);
+                FieldT next = StrTUtils::substring(_currentLine, _currentCharIndex, newCharIndex - _currentCharIndex);
                 _currentCharIndex = newCharIndex + 1;
                 return next;
             }
@@ -141,7 +256,7 @@ namespace CSVReader
             }
 
             template<typename ToType>
-            inline void SafeConvert(ToType *to, const StrT &from)
+            inline void SafeConvert(ToType *to, const FieldT &from)
             {
                 try
                 {
@@ -468,13 +583,15 @@ namespace CSVReader
         CSVBatchReader(CharT sep, Container* container, const PostProcessorFunc &postProcessorFunction) :
             detail::CSVReaderBase<StrT, CharT, StrTUtils, Converter>(sep), _container(container), _postProcessorFunction(postProcessorFunction) {}
 
-        inline void ReadDataLine(const StrT &val)
+        typedef typename detail::CSVReaderBase<StrT, CharT, StrTUtils, Converter>::FieldT FieldT;
+
+        inline void ReadDataLine(const FieldT &val)
         {
             this->_currentLine = val;
             while(this->HasNext())
             {
-                StrT from = this->NextField();
-                if(from == "")
+                FieldT from = this->NextField();
+                if(StrTUtils::length(from) == 0)
                     continue;
                 ContainerValueT to;
                 this->SafeConvert(&to, from);
@@ -503,13 +620,15 @@ namespace CSVReader
         CSVIterator(CharT sep, bool isOptional, const IteratorFunc &iteratorFunc) :
             detail::CSVReaderBase<StrT, CharT, StrTUtils, Converter>(sep), _isOptional(isOptional), _iteratorFunc(iteratorFunc) {}
 
-        inline void ReadDataLine(const StrT &val)
+        typedef typename detail::CSVReaderBase<StrT, CharT, StrTUtils, Converter>::FieldT FieldT;
+
+        inline void ReadDataLine(const FieldT &val)
         {
             this->_currentLine = val;
             while(this->HasNext())
             {
-                StrT next = this->NextField();
-                if(!(next == ""))
+                FieldT next = this->NextField();
+                if(StrTUtils::length(next) > 0)
                     _iteratorFunc(next);
             }
         }
@@ -614,6 +733,36 @@ namespace CSVReader
         }
     };
 
+    /*!
+     * \brief The wrapper for STL strings which reads fields as views of the line
+     */
+    template<class StrElementType, class StrElementTraits = std::char_traits<StrElementType> >
+    struct StringViewWrapper
+    {
+        typedef BasicStringView<StrElementType, StrElementTraits> field_type;
+
+        static bool find(const field_type &str, StrElementType sep, size_t &findIndex)
+        {
+            if(findIndex >= str.size())
+                return false;
+            const StrElementType *pos = StrElementTraits::find(str.data() + findIndex, str.size() - findIndex, sep);
+            if(!pos)
+                return false;
+            findIndex = static_cast<size_t>(pos - str.data());
+            return true;
+        }
+
+        static size_t length(const field_type &str)
+        {
+            return str.size();
+        }
+
+        static field_type substring(const field_type &str, size_t pos, size_t count)
+        {
+            return str.substr(pos, count);
+        }
+    };
+
 
 
 
@@ -631,6 +780,8 @@ namespace CSVReader
     class CSVReader : detail::CSVReaderBase<StrT, CharT, StrTUtils, Converter>
     {
     private:
+        typedef typename detail::CSVReaderBase<StrT, CharT, StrTUtils, Converter>::FieldT FieldT;
+
         Reader *_reader;
         int _currentTotalFields;
         bool _requireReadLine;
@@ -706,7 +857,7 @@ namespace CSVReader
                 optionalObj.AssignDefault();
             else
             {
-                StrT nextField = this->NextField();
+                FieldT nextField = this->NextField();
                 if(!optionalObj.ShouldAssingDefaultOnEmpty() || StrTUtils::length(nextField) > 0) {
                     this->SafeConvert(optionalObj.Get(), nextField);
                     if (!optionalObj.Validate())
@@ -813,7 +964,7 @@ namespace CSVReader
             _currentTotalFields = sizeof...(allValues);
             this->_fieldTracker = 0; // We need the tracker at 0 (because of out of range exception)
             if(_requireReadLine)
-                this->_currentLine = _reader->read_line();
+                this->SetLine(_reader->read_line());
             ReadNext(std::forward<Values>(allValues)...);
             _requireReadLine = true;
 
@@ -829,8 +980,8 @@ namespace CSVReader
             _currentTotalFields = sizeof(value);
             this->_fieldTracker = 0; // We need the tracker at 0 (because of out of range exception)
             if(_requireReadLine)
-                this->_currentLine = _reader->read_line();
-            value = this->_currentLine;
+                this->SetLine(_reader->read_line());
+            Converter::Convert(&value, this->_currentLine);
             _requireReadLine = true;
 
             return *this;
@@ -850,11 +1001,11 @@ namespace CSVReader
             _currentTotalFields = 0;
 
             if(_requireReadLine)
-                this->_currentLine = _reader->read_line();
+                this->SetLine(_reader->read_line());
             while(this->HasNext())
             {
-                StrT next = this->NextField();
-                if(!(next == ""))
+                FieldT next = this->NextField();
+                if(StrTUtils::length(next) > 0)
                     iteratorFunc(next);
             }
             _requireReadLine = true;
@@ -871,11 +1022,11 @@ namespace CSVReader
         T ReadField(int fieldNum)
         {
             if(_requireReadLine)
-                this->_currentLine = _reader->read_line();
+                this->SetLine(_reader->read_line());
             _requireReadLine = false;
             this->_currentCharIndex = 0;
 
-            StrT field;
+            FieldT field;
             for(int i = 1; i < fieldNum; i++)
             {
                 if(this->_currentCharIndex >= StrTUtils::length(this->_currentLine))
@@ -901,6 +1052,8 @@ namespace CSVReader
      *      static bool find(const StrT& str, CharT sep, size_t& findIndex)
      *      static size_t length(const target_string& str)
      *      static target_string substring(const target_string& str, size_t pos, size_t count)
+     * Optionally, StrTUtils may declare the field_type (for example, BasicStringView) to read
+     * fields without copying them, then functions above are taking and returning field_type.
      *
      * Converter is a wrapper for converting StrT fields to literal types:
      *      template<typename T>
@@ -950,7 +1103,9 @@ namespace CSVReader
         CSVSubReader(CharT sep, bool isOptional, Values &&... allValues) : _sep(sep), _val(allValues...), _isOptional(isOptional)
         {}
 
-        void ReadDataLine(const StrT &val)
+        typedef typename detail::CSVFieldType<StrT, StrTUtils>::type FieldT;
+
+        void ReadDataLine(const FieldT &val)
         {
             ReadDataLineImpl(val, detail::make_index_sequence<sizeof...(Values)> {});
         }
@@ -962,10 +1117,10 @@ namespace CSVReader
 
     private:
         template<std::size_t ...I>
-        void ReadDataLineImpl(const StrT &val, detail::index_sequence<I...>)
+        void ReadDataLineImpl(const FieldT &val, detail::index_sequence<I...>)
         {
-            DirectReader<StrT> subReader(val);
-            CSVReader<decltype(subReader), StrT, CharT, StrTUtils, Converter> subCSVReader(&subReader, _sep);
+            DirectReader<FieldT> subReader(val);
+            CSVReader<decltype(subReader), FieldT, CharT, StrTUtils, Converter> subCSVReader(&subReader, _sep);
             subCSVReader.ReadDataLine(std::get<I>(_val)...);
         }
 
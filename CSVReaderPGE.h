@@ -32,6 +32,13 @@
 
 #include "pge_file_lib_private.h"
 
+#ifndef PGE_FILES_QT
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#endif
+
 #if !defined(_MSC_VER) || _MSC_VER > 1800
 
 namespace CSVReader
@@ -71,8 +78,11 @@ namespace CSVReader
             return str.mid(pos, count);
         }
     };
+    typedef QString CSVPGESTRINGField;
     #else
-    struct CSVPGESTRINGUtils : DefaultStringWrapper<char, std::char_traits<char>, std::allocator<char>> {};
+    struct CSVPGESTRINGUtils : StringViewWrapper<char> {};
+    //! Type of fields given by the CSV reader: views of the line for STL strings
+    typedef CSVPGESTRINGUtils::field_type CSVPGESTRINGField;
     #endif
 
     #ifdef PGE_FILES_QT
@@ -156,7 +166,151 @@ namespace CSVReader
         }
     };
     #else
-    struct CSVPGESTRINGConverter : DefaultCSVConverter<std::string> {};
+    namespace detail
+    {
+        template<typename T>
+        inline T ParseSignedField(const CSVPGESTRINGField &field, const char *func)
+        {
+            bool negative, overflow;
+            unsigned long long magnitude;
+            const unsigned long long max = static_cast<unsigned long long>(std::numeric_limits<T>::max());
+
+            if(!PGE_FileFormats_misc::parseDecimal(field.data(), field.data() + field.size(), negative, magnitude, overflow))
+                throw std::invalid_argument(func);
+            if(overflow || (magnitude > (negative ? max + 1 : max)))
+                throw std::out_of_range(func);
+
+            if(!negative)
+                return static_cast<T>(magnitude);
+            if(magnitude == max + 1)
+                return std::numeric_limits<T>::min();
+            return -static_cast<T>(magnitude);
+        }
+
+        template<typename T>
+        inline T ParseUnsignedField(const CSVPGESTRINGField &field, const char *func)
+        {
+            bool negative, overflow;
+            unsigned long long magnitude;
+
+            if(!PGE_FileFormats_misc::parseDecimal(field.data(), field.data() + field.size(), negative, magnitude, overflow))
+                throw std::invalid_argument(func);
+            if(overflow || (magnitude > static_cast<unsigned long long>(std::numeric_limits<T>::max())))
+                throw std::out_of_range(func);
+
+            T value = static_cast<T>(magnitude);
+            return negative ? static_cast<T>(T(0) - value) : value;
+        }
+
+        inline double StrToFloat(const char *str, char **end, double *)
+        {
+            return std::strtod(str, end);
+        }
+        inline float StrToFloat(const char *str, char **end, float *)
+        {
+            return std::strtof(str, end);
+        }
+        inline long double StrToFloat(const char *str, char **end, long double *)
+        {
+            return std::strtold(str, end);
+        }
+
+        template<typename T>
+        inline T ParseFloatField(const CSVPGESTRINGField &field, const char *func)
+        {
+            // Fields are not null-terminated, so, short ones are copied into the local buffer
+            char buf[64];
+            std::string longField;
+            const char *str = buf;
+
+            if(field.size() < sizeof(buf))
+            {
+                std::memcpy(buf, field.data(), field.size());
+                buf[field.size()] = '\0';
+            }
+            else
+            {
+                longField = field;
+                str = longField.c_str();
+            }
+
+            char *end = nullptr;
+            const int savedErrno = errno;
+            errno = 0;
+            T value = StrToFloat(str, &end, static_cast<T*>(nullptr));
+            const bool outOfRange = (errno == ERANGE);
+            errno = savedErrno;
+
+            if(end == str)
+                throw std::invalid_argument(func);
+            if(outOfRange)
+                throw std::out_of_range(func);
+
+            return value;
+        }
+    }
+
+    /*!
+     * \brief Converts fields into values without temporary strings, only string targets are allocated
+     *
+     * Accepts the same input and throws the same exceptions as std::sto*() functions do.
+     */
+    struct CSVPGESTRINGConverter
+    {
+        static void Convert(double *out, const CSVPGESTRINGField &field)
+        {
+            *out = detail::ParseFloatField<double>(field, "stod");
+        }
+        static void Convert(float *out, const CSVPGESTRINGField &field)
+        {
+            *out = detail::ParseFloatField<float>(field, "stof");
+        }
+        static void Convert(int *out, const CSVPGESTRINGField &field)
+        {
+            *out = detail::ParseSignedField<int>(field, "stoi");
+        }
+        static void Convert(long *out, const CSVPGESTRINGField &field)
+        {
+            *out = detail::ParseSignedField<long>(field, "stol");
+        }
+        static void Convert(long long *out, const CSVPGESTRINGField &field)
+        {
+            *out = detail::ParseSignedField<long long>(field, "stoll");
+        }
+        static void Convert(long double *out, const CSVPGESTRINGField &field)
+        {
+            *out = detail::ParseFloatField<long double>(field, "stold");
+        }
+        static void Convert(unsigned int *out, const CSVPGESTRINGField &field)
+        {
+            *out = static_cast<unsigned int>(detail::ParseUnsignedField<unsigned long>(field, "stoul"));
+        }
+        static void Convert(unsigned long *out, const CSVPGESTRINGField &field)
+        {
+            *out = detail::ParseUnsignedField<unsigned long>(field, "stoul");
+        }
+        static void Convert(unsigned long long *out, const CSVPGESTRINGField &field)
+        {
+            *out = detail::ParseUnsignedField<unsigned long long>(field, "stoull");
+        }
+        static void Convert(bool *out, const CSVPGESTRINGField &field)
+        {
+            if(field == "0" || field.empty()) // FIXME: Is it correct? Or too hackish?
+                *out = false;
+            else if(field == "!0" || field == "1") // FIXME: Is it correct? Or too hackish?
+                *out = true;
+            else
+                throw std::invalid_argument(std::string("Could not convert to bool (must be empty, \"0\", \"!0\" or \"1\"), got \"") + std::string(field) + std::string("\""));
+        }
+        static void Convert(std::string *out, const CSVPGESTRINGField &field)
+        {
+            out->assign(field.data(), field.size());
+        }
+        static void Convert(CSVPGESTRINGField *out, const CSVPGESTRINGField &field)
+        {
+            *out = field;
+        }
+    };
     #endif
 
     namespace detail
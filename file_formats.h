@@ -79,7 +79,18 @@ public:
      * \param [__out] FileData Meta-data structure
      * \return true if file successfully opened and parsed, false if error occouped
      */
-    static bool ReadNonSMBX64MetaDataRaw(PGESTRING &rawdata, const PGESTRING &filePath, MetaData &FileData);
+    static bool ReadNonSMBX64MetaDataRaw(const PGESTRING &rawdata, const PGESTRING &filePath, MetaData &FileData);
+    /*!
+     * \brief Parses non-SMBX64 meta-data from additional *.meta files
+     *        there are contains data which impossible to save into SMBX64 LVL file
+     *        therefore it will be saved into additional *.meta file
+     * \param [__in] rawdata Pointer to the raw data
+     * \param [__in] rawdataSize Size of the raw data in bytes
+     * \param [__in] filePath Full path to file with meta-data (needed to detect custom directory info)
+     * \param [__out] FileData Meta-data structure
+     * \return true if file successfully opened and parsed, false if error occouped
+     */
+    static bool ReadNonSMBX64MetaDataRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, MetaData &FileData);
     /*!
      * \brief Parses non-SMBX64 meta-data from additional *.meta files
      *        there are contains data which impossible to save into SMBX64 LVL file
@@ -139,7 +150,16 @@ public:
      * @param [__out] FileData Level data structure
      * @return true if file successfully opened and parsed, false if error occouped
      */
-    static bool OpenLevelRaw(PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData);
+    static bool OpenLevelRaw(const PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData);
+    /**
+     * @brief Parses a level file data with auto-detection of a file type (SMBX1...64 LVL or PGE-LVLX)
+     * @param [__in] rawdata Pointer to the raw data
+     * @param [__in] rawdataSize Size of the raw data in bytes
+     * @param [__in] filePath Full path to the file (if empty, custom data in the episode and in the custom directories are will be inaccessible)
+     * @param [__out] FileData Level data structure
+     * @return true if file successfully opened and parsed, false if error occouped
+     */
+    static bool OpenLevelRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, LevelData &FileData);
     /**
      * @brief Parses a level file data with auto-detection of a file type (SMBX1...64 LVL or PGE-LVLX)
      * @param [__in] file Input file descriptor
@@ -161,7 +181,16 @@ public:
      * @param [__out] data Level data structure (with initialized header data only)
      * @return true if file successfully opened and parsed, false if error occouped
      */
-    static bool OpenLevelFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &filePath, LevelData &data);
+    static bool OpenLevelFileHeaderRaw(const PGESTRING &rawdata, const PGESTRING &filePath, LevelData &data);
+    /**
+     * @brief Parses a level file data header only with auto-detection of a file type (SMBX1...64 LVL or PGE-LVLX)
+     * @param [__in] rawdata Pointer to the raw data
+     * @param [__in] rawdataSize Size of the raw data in bytes
+     * @param [__in] filePath Full path to the file (if empty, custom data in the episode and in the custom directories are will be inaccessible)
+     * @param [__out] data Level data structure (with initialized header data only)
+     * @return true if file successfully opened and parsed, false if error occouped
+     */
+    static bool OpenLevelFileHeaderRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, LevelData &data);
     /**
      * @brief Parses a level file header only with auto-detection of a file type (SMBX1...64 LVL or PGE-LVLX)
      * @param [__in] file Input file descriptor
@@ -216,7 +245,16 @@ public:
      * \param [__out]  FileData Level data structure (with initialized header data only)
      * \return true if file successfully parsed, false if error occouped
      */
-    static bool ReadSMBX64LvlFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData);
+    static bool ReadSMBX64LvlFileHeaderRaw(const PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData);
+    /*!
+     * \brief Parses SMBX1...64 level file header and skips other part of a file
+     * \param [__in] rawdata Pointer to the raw data
+     * \param [__in] rawdataSize Size of the raw data in bytes
+     * \param [__in] filePath Full path to the file (if empty, custom data in the episode and in the custom directories are will be inaccessible)
+     * \param [__out]  FileData Level data structure (with initialized header data only)
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadSMBX64LvlFileHeaderRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, LevelData &FileData);
     /*!
      * \brief Parses SMBX1...64 level file header and skips other part of a file
      * \param [__in] inf Input file descriptor
@@ -238,7 +276,16 @@ public:
      * \param [__Out] FileData Level data structure
      * \return true if file successfully parsed, false if error occouped
      */
-    static bool ReadSMBX64LvlFileRaw(PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData);
+    static bool ReadSMBX64LvlFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData);
+    /*!
+     * \brief Parses SMBX1...64 level file data
+     * \param [__in] rawdata Pointer to the raw data
+     * \param [__in] rawdataSize Size of the raw data in bytes
+     * \param [__in] filePath Full path to the file (if empty, custom data in the episode and in the custom directories are will be inaccessible)
+     * \param [__Out] FileData Level data structure
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadSMBX64LvlFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, LevelData &FileData);
     /*!
      * \brief Parses SMBX1...64 level file data
      * \param [__in] in Input file descriptor
@@ -246,6 +293,16 @@ public:
      * \return true if file successfully parsed, false if error occouped
      */
     static bool ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelData /*output*/ &FileData);
+    /*!
+     * \brief Parses SMBX1...64 level file data, blocks, BGOs, NPCs and warps are decoded concurrently
+     * Result is identical to the result of the single-threaded parser. If the library was built
+     * without multi-threading support, the data is parsed in the current thread.
+     * \param [__in] in Input file descriptor
+     * \param [__out] FileData Level data structure
+     * \param [__in] threads Number of threads to use, 0 to use all hardware threads
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelData /*output*/ &FileData, unsigned int threads);
     /*!
      * \brief Generates SMBX1...64 Level file data and saves into file
      * \param [__in] filePath Target file path
@@ -286,7 +343,16 @@ public:
      * \param FileData Level data structure (with initialized header data only)
      * \return true if file successfully parsed, false if error occouped
      */
-    static bool ReadSMBX38ALvlFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData);
+    static bool ReadSMBX38ALvlFileHeaderRaw(const PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData);
+    /*!
+     * \brief Parses SMBX-38A level file header and skips other part of a file
+     * \param [__in] rawdata Pointer to the raw data
+     * \param [__in] rawdataSize Size of the raw data in bytes
+     * \param [__in] filePath Full path to the file (if empty, custom data in the episode and in the custom directories are will be inaccessible)
+     * \param FileData Level data structure (with initialized header data only)
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadSMBX38ALvlFileHeaderRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, LevelData &FileData);
     /*!
      * \brief Parses SMBX-38A level file header and skips other part of a file
      * \param [__in] inf Input file descriptor
@@ -309,7 +375,16 @@ public:
      * \param [__out] FileData Level data structure
      * \return true if file successfully parsed, false if error occouped
      */
-    static bool ReadSMBX38ALvlFileRaw(PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData);
+    static bool ReadSMBX38ALvlFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData);
+    /*!
+     * \brief Parses SMBX-38A level file data from raw data string
+     * \param [__in] rawdata Pointer to the raw data
+     * \param [__in] rawdataSize Size of the raw data in bytes
+     * \param [__in] filePath Full path to the file (if empty, custom data in the episode and in the custom directories are will be inaccessible)
+     * \param [__out] FileData Level data structure
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadSMBX38ALvlFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, LevelData &FileData);
     /*!
      * \brief Parses SMBX-38A level file data from raw data string
      * \param [__in] in File input descriptor
@@ -365,7 +440,16 @@ public:
      * \param [__out]  FileData Level data structure (with initialized header data only)
      * \return true if file successfully parsed, false if error occouped
      */
-    static bool ReadExtendedLvlFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData);
+    static bool ReadExtendedLvlFileHeaderRaw(const PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData);
+    /*!
+     * \brief Parses PGE-X Level file header from the file
+     * \param [__in] rawdata Pointer to the raw data
+     * \param [__in] rawdataSize Size of the raw data in bytes
+     * \param [__in] filePath Full path to the file (if empty, custom data in the episode and in the custom directories are will be inaccessible)
+     * \param [__out]  FileData Level data structure (with initialized header data only)
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadExtendedLvlFileHeaderRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, LevelData &FileData);
     /*!
      * \brief Parses PGE-X Level file header from the file
      * \param [__in] inf Input file descriptor
@@ -387,7 +471,16 @@ public:
      * \param [__out] FileData Level data structure
      * \return true if file successfully parsed, false if error occouped
      */
-    static bool ReadExtendedLvlFileRaw(PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData);
+    static bool ReadExtendedLvlFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData);
+    /*!
+     * \brief Parses PGE-X level file data from raw data string
+     * \param [__in] rawdata Pointer to the raw data
+     * \param [__in] rawdataSize Size of the raw data in bytes
+     * \param [__in] filePath Full path to the file (if empty, custom data in the episode and in the custom directories are will be inaccessible)
+     * \param [__out] FileData Level data structure
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadExtendedLvlFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, LevelData &FileData);
     /*!
      * \brief Parses PGE-X level file data from file input descriptor
      * \param [__in] in File Input descriptor
@@ -395,6 +488,16 @@ public:
      * \return true if file successfully parsed, false if error occouped
      */
     static bool ReadExtendedLvlFile(PGE_FileFormats_misc::TextInput &in, LevelData /*output*/ &FileData);
+    /*!
+     * \brief Parses PGE-X level file data from file input descriptor, independent sections are decoded concurrently
+     * Result is identical to the result of the single-threaded parser. If the library was built
+     * without multi-threading support, the data is parsed in the current thread.
+     * \param [__in] in File Input descriptor
+     * \param [__out] FileData Level data structure
+     * \param [__in] threads Number of threads to use, 0 to use all hardware threads
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadExtendedLvlFile(PGE_FileFormats_misc::TextInput &in, LevelData /*output*/ &FileData, unsigned int threads);
     /*!
      * \brief Generates PGE-X Level file
      * \param [__in] filePath Target file path
@@ -562,7 +665,16 @@ public:
      * @param [__out] FileData World data structure
      * @return true if file successfully opened and parsed, false if error occouped
      */
-    static bool OpenWorldRaw(PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData);
+    static bool OpenWorldRaw(const PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData);
+    /**
+     * @brief Parses a world map file data with auto-detection of a file type (SMBX1...64 LVL or PGE-LVLX)
+     * @param [__in] rawdata Pointer to the raw data
+     * @param [__in] rawdataSize Size of the raw data in bytes
+     * @param [__in] filePath Full path to the file (if empty, custom data in the episode and in the custom directories are will be inaccessible)
+     * @param [__out] FileData World data structure
+     * @return true if file successfully opened and parsed, false if error occouped
+     */
+    static bool OpenWorldRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, WorldData &FileData);
     /**
      * @brief Parses a level world map data with auto-detection of a file type (SMBX1...64 LVL or PGE-LVLX)
      * @param [__in] file Input file descriptor
@@ -584,7 +696,16 @@ public:
      * @param [__out] data Level data structure (with initialized header data only)
      * @return true if file successfully opened and parsed, false if error occouped
      */
-    static bool OpenWorldFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &filePath, WorldData &data);
+    static bool OpenWorldFileHeaderRaw(const PGESTRING &rawdata, const PGESTRING &filePath, WorldData &data);
+    /**
+     * @brief Parses a level file data header only with auto-detection of a file type (SMBX1...64 LVL or PGE-LVLX)
+     * @param [__in] rawdata Pointer to the raw data
+     * @param [__in] rawdataSize Size of the raw data in bytes
+     * @param [__in] filePath Full path to the file (if empty, custom data in the episode and in the custom directories are will be inaccessible)
+     * @param [__out] data Level data structure (with initialized header data only)
+     * @return true if file successfully opened and parsed, false if error occouped
+     */
+    static bool OpenWorldFileHeaderRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, WorldData &data);
     /**
      * @brief Parses a level file header only with auto-detection of a file type (SMBX1...64 LVL or PGE-LVLX)
      * @param [__in] file Input file descriptor
@@ -627,7 +748,16 @@ public:
      * \param [__out]  FileData World map data structure (with initialized header data only)
      * \return true if file successfully parsed, false if error occouped
      */
-    static bool ReadSMBX64WldFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData);
+    static bool ReadSMBX64WldFileHeaderRaw(const PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData);
+    /*!
+     * \brief Parses SMBX1...64 world map  file header and skips other part of a file
+     * \param [__in] rawdata Pointer to the raw data
+     * \param [__in] rawdataSize Size of the raw data in bytes
+     * \param [__in] filePath Full path to the file (if empty, custom data in the episode and in the custom directories are will be inaccessible)
+     * \param [__out]  FileData World map data structure (with initialized header data only)
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadSMBX64WldFileHeaderRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, WorldData &FileData);
     /*!
      * \brief Parses SMBX1...64 world map file header and skips other part of a file
      * \param [__in] inf Input file descriptor
@@ -649,7 +779,16 @@ public:
      * \param [__out] FileData World data structure
      * \return true if file successfully parsed, false if error occouped
      */
-    static bool ReadSMBX64WldFileRaw(PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData);
+    static bool ReadSMBX64WldFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData);
+    /*!
+     * \brief Parses SMBX1...64 World map file from raw data from raw-data string
+     * \param [__in] rawdata Pointer to the raw data
+     * \param [__in] rawdataSize Size of the raw data in bytes
+     * \param [__in] filePath
+     * \param [__out] FileData World data structure
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadSMBX64WldFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, WorldData &FileData);
     /*!
      * \brief Parses SMBX1...64 World map file from raw data from file input descriptor
      * \param [__in] in File Input descriptor
@@ -697,7 +836,16 @@ public:
      * \param FileData World data structure (with initialized header data only)
      * \return true if file successfully parsed, false if error occouped
      */
-    static bool ReadSMBX38AWldFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData);
+    static bool ReadSMBX38AWldFileHeaderRaw(const PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData);
+    /*!
+     * \brief Parses SMBX-38A world map file header and skips other part of a file
+     * \param [__in] rawdata Pointer to the raw data
+     * \param [__in] rawdataSize Size of the raw data in bytes
+     * \param [__in] filePath Full path to the file (if empty, custom data in the episode and in the custom directories are will be inaccessible)
+     * \param FileData World data structure (with initialized header data only)
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadSMBX38AWldFileHeaderRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, WorldData &FileData);
     /*!
      * \brief Parses SMBX-38A world map file header and skips other part of a file
      * \param [__in] inf Input file descriptor
@@ -719,7 +867,16 @@ public:
      * \param [__out] FileData Level data structure
      * \return true if file successfully parsed, false if error occouped
      */
-    static bool ReadSMBX38AWldFileRaw(PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData);
+    static bool ReadSMBX38AWldFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData);
+    /*!
+     * \brief Parses SMBX-38A world map file data from raw data string
+     * \param [__in] rawdata Pointer to the raw data
+     * \param [__in] rawdataSize Size of the raw data in bytes
+     * \param [__in] filePath Full path to the file (if empty, custom data in the episode and in the custom directories are will be inaccessible)
+     * \param [__out] FileData Level data structure
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadSMBX38AWldFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, WorldData &FileData);
     /*!
      * \brief Parses SMBX-38A world map file data from raw data string
      * \param [__in] in File input descriptor
@@ -764,7 +921,16 @@ public:
      * \param [__out]  FileData World data structure (with initialized header data only)
      * \return true if file successfully parsed, false if error occouped
      */
-    static bool ReadExtendedWldFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData);
+    static bool ReadExtendedWldFileHeaderRaw(const PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData);
+    /*!
+     * \brief Parses PGE-X World map file header from the file
+     * \param [__in] rawdata Pointer to the raw data
+     * \param [__in] rawdataSize Size of the raw data in bytes
+     * \param [__in] filePath Full path to the file (if empty, custom data in the episode and in the custom directories are will be inaccessible)
+     * \param [__out]  FileData World data structure (with initialized header data only)
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadExtendedWldFileHeaderRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, WorldData &FileData);
     /*!
      * \brief Parses PGE-X World map file header from the file
      * \param [__in] inf Input file descriptor
@@ -786,7 +952,16 @@ public:
      * \param [__out] FileData World map data structure
      * \return true if file successfully parsed, false if error occouped
      */
-    static bool ReadExtendedWldFileRaw(PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData);
+    static bool ReadExtendedWldFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData);
+    /*!
+     * \brief Parses PGE-X World map file from raw data string
+     * \param [__in] rawdata Pointer to the raw data
+     * \param [__in] rawdataSize Size of the raw data in bytes
+     * \param [__in] filePath Full path to the file (if empty, custom data in the episode and in the custom directories are will be inaccessible)
+     * \param [__out] FileData World map data structure
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadExtendedWldFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, WorldData &FileData);
     /*!
      * \brief Parses PGE-X World map file from file input descriptor
      * \param [__in] in File Input descriptor
@@ -794,6 +969,16 @@ public:
      * \return true if file successfully parsed, false if error occouped
      */
     static bool ReadExtendedWldFile(PGE_FileFormats_misc::TextInput &in, WorldData /*output*/ &FileData);
+    /*!
+     * \brief Parses PGE-X world file data from file input descriptor, independent sections are decoded concurrently
+     * Result is identical to the result of the single-threaded parser. If the library was built
+     * without multi-threading support, the data is parsed in the current thread.
+     * \param [__in] in File Input descriptor
+     * \param [__out] FileData World data structure
+     * \param [__in] threads Number of threads to use, 0 to use all hardware threads
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadExtendedWldFile(PGE_FileFormats_misc::TextInput &in, WorldData /*output*/ &FileData, unsigned int threads);
     /*!
      * \brief Saves world map data into file of PGE-X World map format
      * \param [__in] filePath Target file path
@@ -882,7 +1067,16 @@ public:
      * \param [__out] FileData Game save data structure
      * \return true if file successfully parsed, false if error occouped
      */
-    static bool ReadSMBX64SavFileRaw(PGESTRING &rawdata, const PGESTRING &filePath, GamesaveData &FileData);
+    static bool ReadSMBX64SavFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath, GamesaveData &FileData);
+    /*!
+     * \brief Parses SMBX1...64 Game save data from raw data string
+     * \param [__in] rawdata Pointer to the raw data
+     * \param [__in] rawdataSize Size of the raw data in bytes
+     * \param [__in] filePath Path to original file
+     * \param [__out] FileData Game save data structure
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadSMBX64SavFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, GamesaveData &FileData);
     /*!
      * \brief Parses SMBX1...64 Game save data from input descriptor
      * \param [__in] in File Input descriptor
@@ -906,7 +1100,16 @@ public:
      * \param [__out] FileData Game save data structure
      * \return true if file successfully parsed, false if error occouped
      */
-    static bool ReadExtendedSaveFileRaw(PGESTRING &rawdata, const PGESTRING &filePath, GamesaveData &FileData);
+    static bool ReadExtendedSaveFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath, GamesaveData &FileData);
+    /*!
+     * \brief Parses PGE-X level file data from raw data string
+     * \param [__in] rawdata Pointer to the raw data
+     * \param [__in] rawdataSize Size of the raw data in bytes
+     * \param [__in] filePath Full path to the file
+     * \param [__out] FileData Game save data structure
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadExtendedSaveFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, GamesaveData &FileData);
     /*!
      * \brief Parses PGE-X level file data from file input descriptor
      * \param [__in] in File Input descriptor
@@ -972,7 +1175,16 @@ public:
      * \param [__out] FileData SMBX Engine specific config structure
      * \return true if file successfully parsed, false if error occouped
      */
-    static bool ReadSMBX64ConfigFileRaw(PGESTRING &rawdata, const PGESTRING &filePath, SMBX64_ConfigFile &FileData);
+    static bool ReadSMBX64ConfigFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath, SMBX64_ConfigFile &FileData);
+    /*!
+     * \brief Parses SMBX Engine config data from raw data string
+     * \param [__in] rawdata Pointer to the raw data
+     * \param [__in] rawdataSize Size of the raw data in bytes
+     * \param [__in] filePath
+     * \param [__out] FileData SMBX Engine specific config structure
+     * \return true if file successfully parsed, false if error occouped
+     */
+    static bool ReadSMBX64ConfigFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, SMBX64_ConfigFile &FileData);
     /*!
      * \brief Parses SMBX Engine config data from file input descriptor
      * \param [__in] in File Input descriptor
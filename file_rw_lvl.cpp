@@ -30,6 +30,11 @@
 #include "smbx64.h"
 #include "smbx64_macro.h"
 #include "CSVUtils.h"
+#include "pge_x.h"
+#include "pge_file_lib_simd.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 
 static int s_smbx64_flags = FileFormats::F_SMBX64_NO_FLAGS;
@@ -50,6 +55,373 @@ struct LevelEvent_layers
     PGESTRING toggle;
 };
 
+/*
+ * Decoders of SMBX64 level objects, shared between the serial and the parallel readers.
+ * Every decoder expects the first line of the record being in the "line" and leaves the last one there.
+ */
+template<class Input>
+static bool readSMBX64LvlBlock(Input &in, PGESTRING &line, SMBX64::ParseError &parse_error,
+                               unsigned int file_format, LevelBlock &blocks)
+{
+    blocks = FileFormats::CreateLvlBlock();
+    SMBX64_ReadField(ParseSIntFromFloat, blocks.x, "block X");
+    nextLine();
+    SMBX64_ReadField(ParseSIntFromFloat, blocks.y, "block Y");
+    nextLine();
+    SMBX64_ReadField(ParseSIntFromFloat, blocks.h, "block height");
+    nextLine();
+    SMBX64_ReadField(ParseSIntFromFloat, blocks.w, "block width");
+    nextLine();
+    SMBX64_ReadField(ParseUInt, blocks.id, "block ID");
+    long xnpcID;
+    nextLine();
+    SMBX64_ReadField(ParseUInt, xnpcID, "block contents"); //Containing NPC id
+    {
+        //Convert NPC-ID value from SMBX1/2 to SMBX64
+        if((s_smbx64_flags & FileFormats::F_SMBX64_KEEP_LEGACY_NPC_IN_BLOCK_CODES) == 0)
+        {
+            switch(xnpcID)
+            {
+            case 100:
+                xnpcID = 1009;
+                break;//Mushroom
+
+            case 101:
+                xnpcID = 1001;
+                break;//Goomba
+
+            case 102:
+                xnpcID = 1014;
+                break;//Fire flower
+
+            case 103:
+                xnpcID = 1034;
+                break;//Super leaf
+
+            case 104:
+                xnpcID = 1035;
+                break;//Shoe
+
+            case 105:
+                xnpcID = 1095;
+                break;//Green Yoshi
+
+            case 201:
+                xnpcID = 1186;
+                break;//Life mushroom
+
+            default:
+                break;
+            }
+        }
+
+        // Convert NPC-ID value from SMBX64 into Moondust format
+        if(xnpcID != 0)
+        {
+            if(xnpcID > 1000)
+                xnpcID = xnpcID - 1000;
+            else
+                xnpcID *= -1;
+        }
+
+        blocks.npc_id = xnpcID;
+    }
+    nextLine();
+    SMBX64_ReadField(ParseCSVBool, blocks.invisible, "block invisible");
+
+    if(ge(61))
+    {
+        nextLine();
+        SMBX64_ReadField(ParseCSVBool, blocks.slippery, "block slippery");
+    }
+
+    if(ge(10))
+    {
+        nextLine();
+        SMBX64::ReadStr(&blocks.layer, line);
+    }
+
+    if(ge(14))
+    {
+        nextLine();
+        SMBX64::ReadStr(&blocks.event_destroy, line);
+        nextLine();
+        SMBX64::ReadStr(&blocks.event_hit, line);
+        nextLine();
+        SMBX64::ReadStr(&blocks.event_emptylayer, line);
+    }
+
+    return true;
+}
+
+template<class Input>
+static bool readSMBX64LvlBgo(Input &in, PGESTRING &line, SMBX64::ParseError &parse_error,
+                             unsigned int file_format, LevelBGO &bgodata)
+{
+    bgodata = FileFormats::CreateLvlBgo();
+    SMBX64_ReadField(ParseSIntFromFloat, bgodata.x, "BGO X");
+    nextLine();
+    SMBX64_ReadField(ParseSIntFromFloat, bgodata.y, "BGO Y");
+    nextLine();
+    SMBX64_ReadField(ParseUInt, bgodata.id, "BGO ID");
+
+    if(ge(10))
+    {
+        nextLine();
+        SMBX64::ReadStr(&bgodata.layer, line);
+    }
+
+    bgodata.smbx64_sp = -1;
+
+    if((file_format < 30) && (bgodata.id == 65)) //set foreground for BGO-65 (SMBX 1.0)
+    {
+        bgodata.z_mode = LevelBGO::Foreground1;
+        bgodata.smbx64_sp = 125;
+    }
+
+    return true;
+}
+
+//! Kind of the optional line which follows the NPC ID
+enum SMBX64_NpcExtraLine
+{
+    //! There is no extra line
+    SMBX64_NPC_NO_EXTRA = 0,
+    //! NPC special option
+    SMBX64_NPC_SPECIAL,
+    //! ID of the contained NPC
+    SMBX64_NPC_CONTENTS
+};
+
+static SMBX64_NpcExtraLine smbx64NpcExtraLine(uint64_t id, unsigned int file_format)
+{
+    switch(id)
+    {
+    //SMBX64 Fixed special options for NPC
+    /*parakoopas*/
+    case 76: case 121: case 122: case 123:
+    case 124: case 161: case 176: case 177:
+    /*Paragoomba*/
+    case 243: case 244:
+    /*Cheep-Cheep*/
+    case 28: case 229: case 230: case 232:
+    case 233: case 234: case 236:
+    /*WarpSelection*/
+    case 288: case 289:
+    /*firebar*/
+    case 260:
+        if((id == 76 && lt(15)) || (id == 28 && lt(31)))
+            return SMBX64_NPC_NO_EXTRA;
+        return SMBX64_NPC_SPECIAL;
+    /*Containers*/
+    case 91: /*buried*/
+    case 96: /*egg*/
+    case 283:/*Bubble*/
+    case 284:/*SMW Lakitu*/
+        return SMBX64_NPC_CONTENTS;
+    default:
+        return SMBX64_NPC_NO_EXTRA;
+    }
+}
+
+//! Is a special option of the contained NPC follows the contents
+static inline bool smbx64NpcHasContentsSpecial(uint64_t id, long contents)
+{
+    /*WarpSelection*/
+    return (id == 91) && (contents == 288); /*case 289:*/ /*firebar*/ /*case 260:*/
+}
+
+template<class Input>
+static bool readSMBX64LvlNpc(Input &in, PGESTRING &line, SMBX64::ParseError &parse_error,
+                             unsigned int file_format, LevelNPC &npcdata)
+{
+    npcdata = FileFormats::CreateLvlNpc();
+    SMBX64_ReadField(ParseSIntFromFloat, npcdata.x, "NPC X");
+    nextLine();
+    SMBX64_ReadField(ParseSIntFromFloat, npcdata.y, "NPC Y");
+    nextLine();
+    SMBX64_ReadField(ParseSInt, npcdata.direct, "NPC direction"); //NPC direction
+    nextLine();
+    SMBX64_ReadField(ParseUInt, npcdata.id, "NPC ID"); //NPC id
+    npcdata.special_data = 0;
+    npcdata.contents     = 0;
+
+    switch(smbx64NpcExtraLine(npcdata.id, file_format))
+    {
+    case SMBX64_NPC_SPECIAL:
+        nextLine();
+        SMBX64_ReadField(ParseSInt, npcdata.special_data, "NPC special option"); //NPC special option
+        break;
+    case SMBX64_NPC_CONTENTS:
+        nextLine();
+        SMBX64_ReadField(ParseSInt, npcdata.contents, "NPC contents");
+        if(smbx64NpcHasContentsSpecial(npcdata.id, npcdata.contents))
+        {
+            nextLine();
+            SMBX64_ReadField(ParseSInt, npcdata.special_data, "NPC special option");
+        }
+        break;
+    default:
+        if(npcdata.id == 28 && lt(31))
+            npcdata.special_data = 2;
+        break;
+    }
+
+    if(ge(3))
+    {
+        nextLine();
+        SMBX64_ReadField(ParseCSVBool, npcdata.generator, "NPC generator"); //Generator enabled
+        npcdata.generator_direct = 1;
+        npcdata.generator_type = 1;
+        if(npcdata.generator)
+        {
+            nextLine();
+            SMBX64_ReadField(ParseSInt, npcdata.generator_direct, "NPC generator direction"); //Generator direction (1, 2, 3, 4)
+            if(npcdata.generator_direct < 0)
+                npcdata.generator_direct = 1; //Fix of old accidental mistake causes -1 value
+            nextLine();
+            SMBX64_ReadField(ParseUInt, npcdata.generator_type, "NPC generator type");   //Generator type [1] Warp, [2] Projectile
+            nextLine();
+            SMBX64_ReadField(ParseUInt, npcdata.generator_period, "NPC generator period"); //Generator period ( sec*10 ) [1-600]
+        }
+    }
+
+    if(ge(5))
+    {
+        nextLine();
+        //strVarMultiLine(npcdata.msg, line)//Message
+        SMBX64::ReadStr(&npcdata.msg, line);//Message
+    }
+    if(ge(6))
+    {
+        nextLine();
+        SMBX64_ReadField(ParseCSVBool, npcdata.friendly, "NPC friendly");//Friendly NPC
+        nextLine();
+        SMBX64_ReadField(ParseCSVBool, npcdata.nomove, "NPC no move"); //Don't move NPC
+    }
+    if(ge(9))
+    {
+        nextLine();
+        SMBX64_ReadField(ParseCSVBool, npcdata.is_boss, "NPC boss"); //Set as boss flag
+    }
+    else
+    {
+        switch(npcdata.id)
+        {
+        //set boss flag to TRUE for old file formats automatically
+        case 15:
+        case 39:
+        case 86:
+            npcdata.is_boss = true;
+            break;
+        default:
+            break;
+        }
+    }
+
+    if(ge(10))
+    {
+        nextLine();
+        SMBX64::ReadStr(&npcdata.layer, line);
+        nextLine();
+        SMBX64::ReadStr(&npcdata.event_activate, line);
+        nextLine();
+        SMBX64::ReadStr(&npcdata.event_die, line);
+        nextLine();
+        SMBX64::ReadStr(&npcdata.event_talk, line);
+    }
+    if(ge(14))
+    {
+        nextLine();    //No more objects in layer event
+        SMBX64::ReadStr(&npcdata.event_emptylayer, line);
+    }
+    if(ge(63))
+    {
+        nextLine();    //Layer name to attach
+        SMBX64::ReadStr(&npcdata.attach_layer, line);
+    }
+
+    return true;
+}
+
+template<class Input>
+static bool readSMBX64LvlWarp(Input &in, PGESTRING &line, SMBX64::ParseError &parse_error,
+                              unsigned int file_format, LevelDoor &doors)
+{
+    doors = FileFormats::CreateLvlWarp();
+    doors.isSetIn = true;
+    doors.isSetOut = true;
+    SMBX64_ReadField(ParseSIntFromFloat, doors.ix, "warp entrance X"); //Entrance x
+    nextLine();
+    SMBX64_ReadField(ParseSIntFromFloat, doors.iy, "warp entrance Y"); //Entrance y
+    nextLine();
+    SMBX64_ReadField(ParseSIntFromFloat, doors.ox, "warp exit X"); //Exit x
+    nextLine();
+    SMBX64_ReadField(ParseSIntFromFloat, doors.oy, "warp exit Y"); //Exit y
+    nextLine();
+    SMBX64_ReadField(ParseUInt, doors.idirect, "warp entrance direction"); //Entrance direction: [3] down, [1] up, [2] left, [4] right
+    nextLine();
+    SMBX64_ReadField(ParseUInt, doors.odirect, "warp exit direction"); //Exit direction: [1] down [3] up [4] left [2] right
+    nextLine();
+    SMBX64_ReadField(ParseUInt, doors.type, "warp type");    //Door type: [1] pipe, [2] door, [0] instant
+
+    if(ge(3))
+    {
+        nextLine();
+        SMBX64::ReadStr(&doors.lname, line);   //Warp to level
+        nextLine();
+        SMBX64_ReadField(ParseUInt, doors.warpto, "warp target"); //Normal entrance or Warp to other door
+        nextLine();
+        SMBX64_ReadField(ParseCSVBool, doors.lvl_i, "warp level entrance"); //Level Entrance (cannot enter)
+        doors.isSetIn = !doors.lvl_i;
+    }
+
+    if(ge(4))   //-V112
+    {
+        nextLine();
+        SMBX64_ReadField(ParseCSVBool, doors.lvl_o, "warp level exit"); //-V112
+        doors.isSetOut = (!doors.lvl_o || (doors.lvl_i));
+        nextLine();
+        SMBX64_ReadField(ParseSInt, doors.world_x, "warp world map X"); //WarpTo X
+        nextLine();
+        SMBX64_ReadField(ParseSInt, doors.world_y, "warp world map Y"); //WarpTo y
+    }
+
+    if(ge(7))
+    {
+        nextLine();    //Need a stars
+        SMBX64_ReadField(ParseUInt, doors.stars, "warp stars");
+    }
+
+    if(ge(12))
+    {
+        nextLine();
+        SMBX64::ReadStr(&doors.layer, line); //Layer
+        nextLine();
+        SMBX64_ReadField(ParseCSVBool, doors.unknown, "warp unknown flag");
+    }    //<unused>, always FALSE
+
+    if(ge(23))
+    {
+        nextLine();    //Deny vehicles
+        SMBX64_ReadField(ParseCSVBool, doors.novehicles, "warp no vehicles");
+    }
+
+    if(ge(25))
+    {
+        nextLine();    //Allow carried items
+        SMBX64_ReadField(ParseCSVBool, doors.allownpc, "warp allows NPC");
+    }
+
+    if(ge(26))
+    {
+        nextLine();    //Locked
+        SMBX64_ReadField(ParseCSVBool, doors.locked, "warp locked");
+    }
+
+    return true;
+}
+
 bool FileFormats::ReadSMBX64LvlFileHeader(const PGESTRING &filePath, LevelData &FileData)
 {
     FileData.meta.ERROR_info.clear();
@@ -67,7 +439,7 @@ bool FileFormats::ReadSMBX64LvlFileHeader(const PGESTRING &filePath, LevelData &
     return ReadSMBX64LvlFileHeaderT(inf, FileData);
 }
 
-bool FileFormats::ReadSMBX64LvlFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData)
+bool FileFormats::ReadSMBX64LvlFileHeaderRaw(const PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData)
 {
     FileData.meta.ERROR_info.clear();
     CreateLevelHeader(FileData);
@@ -84,6 +456,23 @@ bool FileFormats::ReadSMBX64LvlFileHeaderRaw(PGESTRING &rawdata, const PGESTRING
     return ReadSMBX64LvlFileHeaderT(inf, FileData);
 }
 
+bool FileFormats::ReadSMBX64LvlFileHeaderRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, LevelData &FileData)
+{
+    FileData.meta.ERROR_info.clear();
+    CreateLevelHeader(FileData);
+    FileData.meta.RecentFormat = LevelData::SMBX64;
+    FileData.meta.RecentFormatVersion = 64;
+    PGE_FileFormats_misc::ViewTextInput inf;
+
+    if(!inf.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ERROR_info = "Can't open file";
+        FileData.meta.ReadFileValid = false;
+        return false;
+    }
+    return ReadSMBX64LvlFileHeaderT(inf, FileData);
+}
+
 bool FileFormats::ReadSMBX64LvlFileHeaderT(PGE_FileFormats_misc::TextInput &inf, LevelData &FileData)
 {
     PGE_FileFormats_misc::FileInfo in_1(inf.getFilePath());
@@ -98,13 +487,13 @@ bool FileFormats::ReadSMBX64LvlFileHeaderT(PGE_FileFormats_misc::TextInput &inf,
     try
     {
         nextLineH();                                    //Read first line
-        SMBX64::ReadUInt(&file_format, line);           //File format number
+        SMBX64_Read(ParseUInt, file_format, "file format");           //File format number
         FileData.meta.RecentFormatVersion = file_format;
 
         if(file_format >= 17)
         {
             nextLineH();                                //Read second Line
-            SMBX64::ReadUInt(&FileData.stars, line);    //Number of stars
+            SMBX64_Read(ParseUInt, FileData.stars, "stars");    //Number of stars
         }
         else
             FileData.stars = 0;
@@ -124,23 +513,13 @@ bool FileFormats::ReadSMBX64LvlFileHeaderT(PGE_FileFormats_misc::TextInput &inf,
     }
     catch(const std::exception &err)
     {
-        if(file_format > 0)
-            FileData.meta.ERROR_info = "Detected file format: SMBX-" + fromNum(file_format) + " is invalid\n";
-        else
-            FileData.meta.ERROR_info = "It is not an SMBX level file\n";
-
-#ifdef PGE_FILES_QT
-        FileData.meta.ERROR_info += QString::fromStdString(exception_to_pretty_string(err));
-#else
-        FileData.meta.ERROR_info += exception_to_pretty_string(err);
-#endif
-        FileData.meta.ERROR_linenum = inf.getCurrentLineNumber();
-        FileData.meta.ERROR_linedata = std::move(line);
-        FileData.meta.ReadFileValid = false;
-        PGE_CutLength(FileData.meta.ERROR_linedata, 50);
-        PGE_FilterBinary(FileData.meta.ERROR_linedata);
+        SMBX64::SetReadError(FileData.meta, "level", file_format, err, inf.getCurrentLineNumber(), line);
         return false;
     }
+
+badfile:
+    SMBX64::SetReadError(FileData.meta, "level", file_format, parse_error, inf.getCurrentLineNumber(), line);
+    return false;
 }
 
 
@@ -161,7 +540,7 @@ bool FileFormats::ReadSMBX64LvlFileF(const PGESTRING &filePath, LevelData &FileD
     return ReadSMBX64LvlFile(file, FileData);
 }
 
-bool FileFormats::ReadSMBX64LvlFileRaw(PGESTRING &rawdata, const PGESTRING &filePath,  LevelData &FileData)
+bool FileFormats::ReadSMBX64LvlFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath,  LevelData &FileData)
 {
     PGE_FileFormats_misc::RawTextInput file;
 
@@ -177,6 +556,22 @@ bool FileFormats::ReadSMBX64LvlFileRaw(PGESTRING &rawdata, const PGESTRING &file
     return ReadSMBX64LvlFile(file, FileData);
 }
 
+bool FileFormats::ReadSMBX64LvlFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, LevelData &FileData)
+{
+    PGE_FileFormats_misc::ViewTextInput file;
+
+    if(!file.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ERROR_info = "Failed to open raw string for read";
+        FileData.meta.ERROR_linedata.clear();
+        FileData.meta.ERROR_linenum = -1;
+        FileData.meta.ReadFileValid = false;
+        return false;
+    }
+
+    return ReadSMBX64LvlFile(file, FileData);
+}
+
 bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelData &FileData)
 {
     SMBX64_FileBegin();
@@ -227,13 +622,13 @@ bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelDa
     {
         ///////////////////////////////////////Begin file///////////////////////////////////////
         nextLine();   //Read first line
-        SMBX64::ReadUInt(&file_format, line);//File format number
+        SMBX64_Read(ParseUInt, file_format, "file format");//File format number
         FileData.meta.RecentFormatVersion = file_format;
 
         if(ge(17))
         {
             nextLine();
-            SMBX64::ReadUInt(&FileData.stars, line); //Number of stars
+            SMBX64_Read(ParseUInt, FileData.stars, "stars"); //Number of stars
         }
         else
             FileData.stars = 0; //-V1048
@@ -252,34 +647,34 @@ bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelDa
         {
             section = CreateLvlSection();
             nextLine();
-            SMBX64::ReadSIntFromFloat(&section.size_left, line);
+            SMBX64_Read(ParseSIntFromFloat, section.size_left, "section left");
             nextLine();
-            SMBX64::ReadSIntFromFloat(&section.size_top,  line);
+            SMBX64_Read(ParseSIntFromFloat, section.size_top, "section top");
             nextLine();
-            SMBX64::ReadSIntFromFloat(&section.size_bottom, line); //bottom
+            SMBX64_Read(ParseSIntFromFloat, section.size_bottom, "section bottom"); //bottom
             nextLine();
-            SMBX64::ReadSIntFromFloat(&section.size_right, line);  //right
+            SMBX64_Read(ParseSIntFromFloat, section.size_right, "section right");  //right
             nextLine();
-            SMBX64::ReadUInt(&section.music_id, line);    //Music ID
+            SMBX64_Read(ParseUInt, section.music_id, "section music");    //Music ID
             nextLine();
-            SMBX64::ReadUInt(&section.bgcolor, line);     //BG Color
+            SMBX64_Read(ParseUInt, section.bgcolor, "section background color");     //BG Color
             nextLine();
-            SMBX64::ReadCSVBool(&section.wrap_h, line);     //Connect sides of section
+            SMBX64_Read(ParseCSVBool, section.wrap_h, "section horizontal wrap");     //Connect sides of section
             nextLine();
-            SMBX64::ReadCSVBool(&section.OffScreenEn, line);//Offscreen exit
+            SMBX64_Read(ParseCSVBool, section.OffScreenEn, "section offscreen exit");//Offscreen exit
             nextLine();
-            SMBX64::ReadUInt(&section.background, line);  //BackGround id
+            SMBX64_Read(ParseUInt, section.background, "section background");  //BackGround id
 
             if(ge(1))
             {
                 nextLine();    //Don't walk to left (no turn back)
-                SMBX64::ReadCSVBool(&section.lock_left_scroll, line);
+                SMBX64_Read(ParseCSVBool, section.lock_left_scroll, "section no turn back");
             }
 
             if(ge(30))
             {
                 nextLine();    //Underwater
-                SMBX64::ReadCSVBool(&section.underwater, line);
+                SMBX64_Read(ParseCSVBool, section.underwater, "section underwater");
             }
 
             if(ge(2))
@@ -316,13 +711,13 @@ bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelDa
         {
             players = CreateLvlPlayerPoint();
             nextLine();
-            SMBX64::ReadSIntFromFloat(&players.x, line);//Player x
+            SMBX64_Read(ParseSIntFromFloat, players.x, "player X");//Player x
             nextLine();
-            SMBX64::ReadSIntFromFloat(&players.y, line);//Player y
+            SMBX64_Read(ParseSIntFromFloat, players.y, "player Y");//Player y
             nextLine();
-            SMBX64::ReadUInt(&players.w, line);//Player w
+            SMBX64_Read(ParseUInt, players.w, "player width");//Player w
             nextLine();
-            SMBX64::ReadUInt(&players.h, line);//Player h
+            SMBX64_Read(ParseUInt, players.h, "player height");//Player h
             players.id = static_cast<unsigned int>(i) + 1u;
 
             if(players.x != 0 && players.y != 0 && players.w != 0 && players.h != 0) //Don't add into array non-exist point
@@ -334,94 +729,8 @@ bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelDa
 
         while(line != "next")
         {
-            blocks = CreateLvlBlock();
-            SMBX64::ReadSIntFromFloat(&blocks.x, line);
-            nextLine();
-            SMBX64::ReadSIntFromFloat(&blocks.y, line);
-            nextLine();
-            SMBX64::ReadSIntFromFloat(&blocks.h, line);
-            nextLine();
-            SMBX64::ReadSIntFromFloat(&blocks.w, line);
-            nextLine();
-            SMBX64::ReadUInt(&blocks.id, line);
-            long xnpcID;
-            nextLine();
-            SMBX64::ReadUInt(&xnpcID, line); //Containing NPC id
-            {
-                //Convert NPC-ID value from SMBX1/2 to SMBX64
-                if((s_smbx64_flags & F_SMBX64_KEEP_LEGACY_NPC_IN_BLOCK_CODES) == 0)
-                {
-                    switch(xnpcID)
-                    {
-                    case 100:
-                        xnpcID = 1009;
-                        break;//Mushroom
-
-                    case 101:
-                        xnpcID = 1001;
-                        break;//Goomba
-
-                    case 102:
-                        xnpcID = 1014;
-                        break;//Fire flower
-
-                    case 103:
-                        xnpcID = 1034;
-                        break;//Super leaf
-
-                    case 104:
-                        xnpcID = 1035;
-                        break;//Shoe
-
-                    case 105:
-                        xnpcID = 1095;
-                        break;//Green Yoshi
-
-                    case 201:
-                        xnpcID = 1186;
-                        break;//Life mushroom
-
-                    default:
-                        break;
-                    }
-                }
-
-                // Convert NPC-ID value from SMBX64 into Moondust format
-                if(xnpcID != 0)
-                {
-                    if(xnpcID > 1000)
-                        xnpcID = xnpcID - 1000;
-                    else
-                        xnpcID *= -1;
-                }
-
-                blocks.npc_id = xnpcID;
-            }
-            nextLine();
-            SMBX64::ReadCSVBool(&blocks.invisible, line);
-
-            if(ge(61))
-            {
-                nextLine();
-                SMBX64::ReadCSVBool(&blocks.slippery, line);
-            }
-
-            if(ge(10))
-            {
-                nextLine();
-                SMBX64::ReadStr(&blocks.layer, line);
-            }
-
-            if(ge(14))
-            {
-                nextLine();
-                SMBX64::ReadStr(&blocks.event_destroy, line);
-                nextLine();
-                SMBX64::ReadStr(&blocks.event_hit, line);
-                nextLine();
-                SMBX64::ReadStr(&blocks.event_emptylayer, line);
-            }
-
+            if(!readSMBX64LvlBlock(in, line, parse_error, file_format, blocks))
+                goto badfile;
             blocks.meta.array_id = FileData.blocks_array_id++;
             blocks.meta.index = static_cast<unsigned int>(FileData.blocks.size()); //Apply element index
             FileData.blocks.push_back(blocks); //AddBlock into array
@@ -433,27 +742,8 @@ bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelDa
 
         while(line != "next")
         {
-            bgodata = CreateLvlBgo();
-            SMBX64::ReadSIntFromFloat(&bgodata.x, line);
-            nextLine();
-            SMBX64::ReadSIntFromFloat(&bgodata.y, line);
-            nextLine();
-            SMBX64::ReadUInt(&bgodata.id, line);
-
-            if(ge(10))
-            {
-                nextLine();
-                SMBX64::ReadStr(&bgodata.layer, line);
-            }
-
-            bgodata.smbx64_sp = -1;
-
-            if((file_format < 30) && (bgodata.id == 65)) //set foreground for BGO-65 (SMBX 1.0)
-            {
-                bgodata.z_mode = LevelBGO::Foreground1;
-                bgodata.smbx64_sp = 125;
-            }
-
+            if(!readSMBX64LvlBgo(in, line, parse_error, file_format, bgodata))
+                goto badfile;
             bgodata.meta.array_id = FileData.bgo_array_id++;
             bgodata.meta.index = static_cast<unsigned int>(FileData.bgo.size()); //Apply element index
             FileData.bgo.push_back(bgodata); //Add Background object into array
@@ -465,149 +755,8 @@ bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelDa
 
         while(line != "next")
         {
-            npcdata = CreateLvlNpc();
-            SMBX64::ReadSIntFromFloat(&npcdata.x, line);
-            nextLine();
-            SMBX64::ReadSIntFromFloat(&npcdata.y, line);
-            nextLine();
-            SMBX64::ReadSInt(&npcdata.direct, line); //NPC direction
-            nextLine();
-            SMBX64::ReadUInt(&npcdata.id, line); //NPC id
-            npcdata.special_data = 0;
-            npcdata.contents     = 0;
-
-            switch(npcdata.id)
-            {
-            //SMBX64 Fixed special options for NPC
-            /*parakoopas*/
-            case 76: case 121: case 122: case 123:
-            case 124: case 161: case 176: case 177:
-            /*Paragoomba*/
-            case 243: case 244:
-            /*Cheep-Cheep*/
-            case 28: case 229: case 230: case 232:
-            case 233: case 234: case 236:
-            /*WarpSelection*/
-            case 288: case 289:
-            /*firebar*/
-            case 260:
-            {
-                if(npcdata.id == 76 && lt(15))
-                {
-                    npcdata.special_data = 0; //-V1048
-                }
-                else if(npcdata.id == 28 && lt(31))
-                {
-                    npcdata.special_data = 2;
-                }
-                else
-                {
-                    nextLine();
-                    SMBX64::ReadSInt(&npcdata.special_data, line); //NPC special option
-                }
-
-                break;
-            }
-            /*Containers*/
-            case 91: /*buried*/
-            case 96: /*egg*/
-            case 283:/*Bubble*/
-            case 284:/*SMW Lakitu*/
-            {
-                nextLine();
-                SMBX64::ReadSInt(&npcdata.contents, line);
-                if(npcdata.id == 91)
-                {
-                    switch(npcdata.contents)
-                    {
-                    /*WarpSelection*/
-                    case 288: /*case 289:*/ /*firebar*/ /*case 260:*/
-                        nextLine();
-                        SMBX64::ReadSInt(&npcdata.special_data, line);
-                        break;
-                    default:
-                        break;
-                    }
-                }
-                break;
-            }
-            default:
-                break;
-            }
-
-            if(ge(3))
-            {
-                nextLine();
-                SMBX64::ReadCSVBool(&npcdata.generator, line); //Generator enabled
-                npcdata.generator_direct = 1;
-                npcdata.generator_type = 1;
-                if(npcdata.generator)
-                {
-                    nextLine();
-                    SMBX64::ReadSInt(&npcdata.generator_direct, line); //Generator direction (1, 2, 3, 4)
-                    if(npcdata.generator_direct < 0)
-                        npcdata.generator_direct = 1; //Fix of old accidental mistake causes -1 value
-                    nextLine();
-                    SMBX64::ReadUInt(&npcdata.generator_type, line);   //Generator type [1] Warp, [2] Projectile
-                    nextLine();
-                    SMBX64::ReadUInt(&npcdata.generator_period, line); //Generator period ( sec*10 ) [1-600]
-                }
-            }
-
-            if(ge(5))
-            {
-                nextLine();
-                //strVarMultiLine(npcdata.msg, line)//Message
-                SMBX64::ReadStr(&npcdata.msg, line);//Message
-            }
-            if(ge(6))
-            {
-                nextLine();
-                SMBX64::ReadCSVBool(&npcdata.friendly, line);//Friendly NPC
-                nextLine();
-                SMBX64::ReadCSVBool(&npcdata.nomove, line); //Don't move NPC
-            }
-            if(ge(9))
-            {
-                nextLine();
-                SMBX64::ReadCSVBool(&npcdata.is_boss, line); //Set as boss flag
-            }
-            else
-            {
-                switch(npcdata.id)
-                {
-                //set boss flag to TRUE for old file formats automatically
-                case 15:
-                case 39:
-                case 86:
-                    npcdata.is_boss = true;
-                    break;
-                default:
-                    break;
-                }
-            }
-
-            if(ge(10))
-            {
-                nextLine();
-                SMBX64::ReadStr(&npcdata.layer, line);
-                nextLine();
-                SMBX64::ReadStr(&npcdata.event_activate, line);
-                nextLine();
-                SMBX64::ReadStr(&npcdata.event_die, line);
-                nextLine();
-                SMBX64::ReadStr(&npcdata.event_talk, line);
-            }
-            if(ge(14))
-            {
-                nextLine();    //No more objects in layer event
-                SMBX64::ReadStr(&npcdata.event_emptylayer, line);
-            }
-            if(ge(63))
-            {
-                nextLine();    //Layer name to attach
-                SMBX64::ReadStr(&npcdata.attach_layer, line);
-            }
+            if(!readSMBX64LvlNpc(in, line, parse_error, file_format, npcdata))
+                goto badfile;
             npcdata.meta.array_id = FileData.npc_array_id++;
             npcdata.meta.index = static_cast<unsigned>(FileData.npc.size()); //Apply element index
             FileData.npc.push_back(npcdata); //Add NPC into array
@@ -622,77 +771,8 @@ bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelDa
             || ((file_format < 10) && (!IsEmpty(line)) && (!in.eof()))
         )
         {
-            doors = CreateLvlWarp();
-            doors.isSetIn = true;
-            doors.isSetOut = true;
-            SMBX64::ReadSIntFromFloat(&doors.ix, line); //Entrance x
-            nextLine();
-            SMBX64::ReadSIntFromFloat(&doors.iy, line); //Entrance y
-            nextLine();
-            SMBX64::ReadSIntFromFloat(&doors.ox, line); //Exit x
-            nextLine();
-            SMBX64::ReadSIntFromFloat(&doors.oy, line); //Exit y
-            nextLine();
-            SMBX64::ReadUInt(&doors.idirect, line); //Entrance direction: [3] down, [1] up, [2] left, [4] right
-            nextLine();
-            SMBX64::ReadUInt(&doors.odirect, line); //Exit direction: [1] down [3] up [4] left [2] right
-            nextLine();
-            SMBX64::ReadUInt(&doors.type, line);    //Door type: [1] pipe, [2] door, [0] instant
-
-            if(ge(3))
-            {
-                nextLine();
-                SMBX64::ReadStr(&doors.lname, line);   //Warp to level
-                nextLine();
-                SMBX64::ReadUInt(&doors.warpto, line); //Normal entrance or Warp to other door
-                nextLine();
-                SMBX64::ReadCSVBool(&doors.lvl_i, line); //Level Entrance (cannot enter)
-                doors.isSetIn = !doors.lvl_i;
-            }
-
-            if(ge(4))   //-V112
-            {
-                nextLine();
-                SMBX64::ReadCSVBool(&doors.lvl_o, line); //-V112
-                doors.isSetOut = (!doors.lvl_o || (doors.lvl_i));
-                nextLine();
-                SMBX64::ReadSInt(&doors.world_x, line); //WarpTo X
-                nextLine();
-                SMBX64::ReadSInt(&doors.world_y, line); //WarpTo y
-            }
-
-            if(ge(7))
-            {
-                nextLine();    //Need a stars
-                SMBX64::ReadUInt(&doors.stars, line);
-            }
-
-            if(ge(12))
-            {
-                nextLine();
-                SMBX64::ReadStr(&doors.layer, line); //Layer
-                nextLine();
-                SMBX64::ReadCSVBool(&doors.unknown, line);
-            }    //<unused>, always FALSE
-
-            if(ge(23))
-            {
-                nextLine();    //Deny vehicles
-                SMBX64::ReadCSVBool(&doors.novehicles, line);
-            }
-
-            if(ge(25))
-            {
-                nextLine();    //Allow carried items
-                SMBX64::ReadCSVBool(&doors.allownpc, line);
-            }
-
-            if(ge(26))
-            {
-                nextLine();    //Locked
-                SMBX64::ReadCSVBool(&doors.locked, line);
-            }
-
+            if(!readSMBX64LvlWarp(in, line, parse_error, file_format, doors))
+                goto badfile;
             doors.meta.array_id = FileData.doors_array_id++;
             doors.meta.index = static_cast<unsigned>(FileData.doors.size()); //Apply element index
             FileData.doors.push_back(doors); //Add NPC into array
@@ -707,20 +787,20 @@ bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelDa
             while(line != "next")
             {
                 waters = CreateLvlPhysEnv();
-                SMBX64::ReadSIntFromFloat(&waters.x, line);
+                SMBX64_Read(ParseSIntFromFloat, waters.x, "water X");
                 nextLine();
-                SMBX64::ReadSIntFromFloat(&waters.y, line);
+                SMBX64_Read(ParseSIntFromFloat, waters.y, "water Y");
                 nextLine();
-                SMBX64::ReadUInt(&waters.w, line);
+                SMBX64_Read(ParseUInt, waters.w, "water width");
                 nextLine();
-                SMBX64::ReadUInt(&waters.h, line);
+                SMBX64_Read(ParseUInt, waters.h, "water height");
                 nextLine();
-                SMBX64::ReadFloat(&waters.buoy, line);
+                SMBX64_Read(ParseFloat, waters.buoy, "water buoy");
 
                 if(ge(62))
                 {
                     nextLine();
-                    SMBX64::ReadCSVBool(&waters.env_type, line);
+                    SMBX64_Read(ParseCSVBool, waters.env_type, "water quicksand");
                 }
 
                 nextLine();
@@ -741,7 +821,7 @@ bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelDa
             {
                 SMBX64::ReadStr(&layers.name, line);     //Layer name
                 nextLine();
-                SMBX64::ReadCSVBool(&layers.hidden, line); //hidden layer
+                SMBX64_Read(ParseCSVBool, layers.hidden, "layer hidden"); //hidden layer
                 layers.locked = false;
                 layers.meta.array_id = FileData.layers_array_id++;
                 FileData.layers.push_back(layers); //Add Water area into array
@@ -765,13 +845,13 @@ bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelDa
                 if(ge(14))
                 {
                     nextLine();
-                    SMBX64::ReadUInt(&events.sound_id, line);
+                    SMBX64_Read(ParseUInt, events.sound_id, "event sound");
                 }
 
                 if(ge(18))
                 {
                     nextLine();
-                    SMBX64::ReadUInt(&events.end_game, line);
+                    SMBX64_Read(ParseUInt, events.end_game, "event end game");
                 }
 
                 PGELIST<LevelEvent_layers > events_layersArr;
@@ -815,17 +895,17 @@ bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelDa
                     {
                         events_sets.id = i;
                         nextLine();
-                        SMBX64::ReadSInt(&events_sets.music_id, line);        //Set Music
+                        SMBX64_Read(ParseSInt, events_sets.music_id, "event section music");        //Set Music
                         nextLine();
-                        SMBX64::ReadSInt(&events_sets.background_id, line);   //Set Background
+                        SMBX64_Read(ParseSInt, events_sets.background_id, "event section background");   //Set Background
                         nextLine();
-                        SMBX64::ReadSInt(&events_sets.position_left, line);   //Set Position to: LEFT
+                        SMBX64_Read(ParseSInt, events_sets.position_left, "event section left");   //Set Position to: LEFT
                         nextLine();
-                        SMBX64::ReadSInt(&events_sets.position_top, line);    //Set Position to: TOP
+                        SMBX64_Read(ParseSInt, events_sets.position_top, "event section top");    //Set Position to: TOP
                         nextLine();
-                        SMBX64::ReadSInt(&events_sets.position_bottom, line); //Set Position to: BOTTOM
+                        SMBX64_Read(ParseSInt, events_sets.position_bottom, "event section bottom"); //Set Position to: BOTTOM
                         nextLine();
-                        SMBX64::ReadSInt(&events_sets.position_right, line);  //Set Position to: RIGHT
+                        SMBX64_Read(ParseSInt, events_sets.position_right, "event section right");  //Set Position to: RIGHT
                         events.sets.push_back(events_sets);
                     }
                 }
@@ -835,37 +915,37 @@ bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelDa
                     nextLine();
                     SMBX64::ReadStr(&events.trigger, line); //Trigger
                     nextLine();
-                    SMBX64::ReadUInt(&events.trigger_timer, line);
+                    SMBX64_Read(ParseUInt, events.trigger_timer, "event trigger delay");
                 } //Start trigger event after x [1/10 sec]. Etc. 153,2 sec
 
                 if(ge(27))
                 {
                     nextLine();    //Don't smoke tobacco, let's healthy! :D
-                    SMBX64::ReadCSVBool(&events.nosmoke, line);
+                    SMBX64_Read(ParseCSVBool, events.nosmoke, "event no smoke");
                 }
 
                 if(ge(28))
                 {
                     nextLine();
-                    SMBX64::ReadCSVBool(&events.ctrl_altjump, line);//Hold ALT-JUMP player control
+                    SMBX64_Read(ParseCSVBool, events.ctrl_altjump, "event alt-jump control");//Hold ALT-JUMP player control
                     nextLine();
-                    SMBX64::ReadCSVBool(&events.ctrl_altrun, line); //ALT-RUN
+                    SMBX64_Read(ParseCSVBool, events.ctrl_altrun, "event alt-run control"); //ALT-RUN
                     nextLine();
-                    SMBX64::ReadCSVBool(&events.ctrl_down, line);   //DOWN
+                    SMBX64_Read(ParseCSVBool, events.ctrl_down, "event down control");   //DOWN
                     nextLine();
-                    SMBX64::ReadCSVBool(&events.ctrl_drop, line);   //DROP
+                    SMBX64_Read(ParseCSVBool, events.ctrl_drop, "event drop control");   //DROP
                     nextLine();
-                    SMBX64::ReadCSVBool(&events.ctrl_jump, line);   //JUMP
+                    SMBX64_Read(ParseCSVBool, events.ctrl_jump, "event jump control");   //JUMP
                     nextLine();
-                    SMBX64::ReadCSVBool(&events.ctrl_left, line);   //LEFT
+                    SMBX64_Read(ParseCSVBool, events.ctrl_left, "event left control");   //LEFT
                     nextLine();
-                    SMBX64::ReadCSVBool(&events.ctrl_right, line);  //RIGHT
+                    SMBX64_Read(ParseCSVBool, events.ctrl_right, "event right control");  //RIGHT
                     nextLine();
-                    SMBX64::ReadCSVBool(&events.ctrl_run, line);    //RUN
+                    SMBX64_Read(ParseCSVBool, events.ctrl_run, "event run control");    //RUN
                     nextLine();
-                    SMBX64::ReadCSVBool(&events.ctrl_start, line);  //START
+                    SMBX64_Read(ParseCSVBool, events.ctrl_start, "event start control");  //START
                     nextLine();
-                    SMBX64::ReadCSVBool(&events.ctrl_up, line);  //UP
+                    SMBX64_Read(ParseCSVBool, events.ctrl_up, "event up control");  //UP
                     events.ctrls_enable = events.ctrlKeyPressed();
                     events.ctrl_lock_keyboard = events.ctrls_enable;
                 }
@@ -873,13 +953,13 @@ bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelDa
                 if(ge(32))  //-V112
                 {
                     nextLine();
-                    SMBX64::ReadCSVBool(&events.autostart, line);  //Auto start
+                    SMBX64_Read(ParseCSVBool, events.autostart, "event autostart");  //Auto start
                     nextLine();
                     SMBX64::ReadStr(&events.movelayer, line);  //Layer for movement
                     nextLine();
-                    SMBX64::ReadFloat(&events.layer_speed_x, line); //Layer moving speed - horizontal
+                    SMBX64_Read(ParseFloat, events.layer_speed_x, "event layer horizontal speed"); //Layer moving speed - horizontal
                     nextLine();
-                    SMBX64::ReadFloat(&events.layer_speed_y, line); //Layer moving speed - vertical
+                    SMBX64_Read(ParseFloat, events.layer_speed_y, "event layer vertical speed"); //Layer moving speed - vertical
 
                     if(!IsEmpty(events.movelayer))
                     {
@@ -894,11 +974,11 @@ bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelDa
                 if(ge(33))
                 {
                     nextLine();
-                    SMBX64::ReadFloat(&events.move_camera_x, line); //Move screen horizontal speed
+                    SMBX64_Read(ParseFloat, events.move_camera_x, "event camera horizontal speed"); //Move screen horizontal speed
                     nextLine();
-                    SMBX64::ReadFloat(&events.move_camera_y, line); //Move screen vertical speed
+                    SMBX64_Read(ParseFloat, events.move_camera_y, "event camera vertical speed"); //Move screen vertical speed
                     nextLine();
-                    SMBX64::ReadSInt(&events.scroll_section, line); //Scroll section x, (in file value is x-1)
+                    SMBX64_Read(ParseSInt, events.scroll_section, "event scroll section"); //Scroll section x, (in file value is x-1)
 
 // !!!This code intended to convert old autoscroll into new, but, this is a source of the bug, so, don't do that!!!
 //                    if(((events.move_camera_x != 0.0) || (events.move_camera_y != 0.0)) && (events.scroll_section < static_cast<long>(events.sets.size())))
@@ -926,28 +1006,356 @@ bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelDa
     }
     catch(const std::exception &err)
     {
-        if(file_format > 0)
-            FileData.meta.ERROR_info = "Detected file format: SMBX-" + fromNum(file_format) + " is invalid\n";
-        else
-            FileData.meta.ERROR_info = "It is not an SMBX level file\n";
+        SMBX64::SetReadError(FileData.meta, "level", file_format, err, in.getCurrentLineNumber(), line);
+        return false;
+    }
+
+badfile:
+    SMBX64::SetReadError(FileData.meta, "level", file_format, parse_error, in.getCurrentLineNumber(), line);
+    return false;
+}
+
+/*
+ * Index of lines of SMBX64 file data. The "line" here is a CSV field exactly as it
+ * gets returned by the TextInput::readCVSLine(): a comma or a line feed outside of quotes
+ * are finishing it, quotes are removed.
+ */
+class SMBX64_LineIndex
+{
+    const PGESTRING &m_data;
+    //! Beginning of every line, the last entry is the end of data plus one
+    std::vector<size_t> m_begins;
+
+public:
+    explicit SMBX64_LineIndex(const PGESTRING &data) :
+        m_data(data)
+    {
+        const size_t len = static_cast<size_t>(data.size());
+        m_begins.reserve(len / 4 + 2);
+        m_begins.push_back(0);
+#ifdef PGE_FILES_QT
+        bool quoteIsOpen = false;
+        for(size_t pos = 0; pos < len; pos++)
+        {
+            QChar c = data[static_cast<int>(pos)];
+            if(c == QChar('\"'))
+                quoteIsOpen = !quoteIsOpen;
+            else if(!quoteIsOpen && ((c == QChar('\n')) || (c == QChar(','))))
+                m_begins.push_back(pos + 1);
+        }
+#else
+        const char *d = data.data();
+        size_t pos = 0;
+        while(pos < len)
+        {
+            pos += PGE_FileFormats_misc::findCSVDelimiter(d + pos, len - pos);
+            if(pos >= len)
+                break;
+
+            if(d[pos] == '\r')
+            {
+                pos++;
+                continue;
+            }
+
+            if(d[pos] == '\"')
+            {
+                const char *quote = reinterpret_cast<const char *>(std::memchr(d + pos + 1, '\"', len - pos - 1));
+                if(!quote)
+                    break; // Quote is not closed until the end of data
+                pos = static_cast<size_t>(quote - d) + 1;
+                continue;
+            }
+
+            m_begins.push_back(++pos);
+        }
+#endif
+        m_begins.push_back(len + 1);
+    }
+
+    size_t count() const
+    {
+        return m_begins.size() - 1;
+    }
+
+    //! Position of the line in the data, the end of data for lines out of range
+    size_t begin(size_t i) const
+    {
+        return (i < count()) ? m_begins[i] : static_cast<size_t>(m_data.size());
+    }
 
+    //! Value of the line, empty string for lines out of range (same as readCVSLine() does at the end of data)
+    PGESTRING line(size_t i) const
+    {
+        if(i >= count())
+            return PGESTRING();
+        size_t b = m_begins[i];
+        size_t e = m_begins[i + 1] - 1;
 #ifdef PGE_FILES_QT
-        FileData.meta.ERROR_info += QString::fromStdString(exception_to_pretty_string(err));
+        PGESTRING out = m_data.mid(static_cast<int>(b), static_cast<int>(e - b));
+        out.remove(QChar('\"'));
 #else
-        FileData.meta.ERROR_info += exception_to_pretty_string(err);
+        const char *d = m_data.data() + b;
+        PGESTRING out(d, e - b);
+        if(std::memchr(d, '\"', e - b))
+            out.erase(std::remove(out.begin(), out.end(), '\"'), out.end());
 #endif
-        FileData.meta.ERROR_linenum  = in.getCurrentLineNumber();
-        FileData.meta.ERROR_linedata = std::move(line);
-        FileData.meta.ReadFileValid = false;
-        PGE_CutLength(FileData.meta.ERROR_linedata, 50);
-        PGE_FilterBinary(FileData.meta.ERROR_linedata);
+        return out;
+    }
+};
+
+//! Reads lines from the index, serves as the input of record decoders
+class SMBX64_LineCursor
+{
+    const SMBX64_LineIndex &m_index;
+    size_t m_line;
+public:
+    SMBX64_LineCursor(const SMBX64_LineIndex &index, size_t line) :
+        m_index(index), m_line(line)
+    {}
+
+    PGESTRING readCVSLine()
+    {
+        return m_index.line(m_line++);
+    }
+};
+
+/*
+ * Line counters of SMBX64 level objects, must follow the decoders above.
+ * Return 0 if the record can't be measured.
+ */
+static size_t smbx64LvlBlockLines(const SMBX64_LineIndex &, size_t, unsigned int file_format)
+{
+    return 7 + (ge(61) ? 1 : 0) + (ge(10) ? 1 : 0) + (ge(14) ? 3 : 0);
+}
+
+static size_t smbx64LvlBgoLines(const SMBX64_LineIndex &, size_t, unsigned int file_format)
+{
+    return 3 + (ge(10) ? 1 : 0);
+}
+
+static size_t smbx64LvlNpcLines(const SMBX64_LineIndex &index, size_t first, unsigned int file_format)
+{
+    uint64_t id;
+    size_t lines = 4;
+
+    if(SMBX64::ParseUInt(&id, index.line(first + 3)) != SMBX64::PARSE_OK)
+        return 0;
+
+    switch(smbx64NpcExtraLine(id, file_format))
+    {
+    case SMBX64_NPC_SPECIAL:
+        lines++;
+        break;
+    case SMBX64_NPC_CONTENTS:
+    {
+        long contents;
+        if(SMBX64::ParseSInt(&contents, index.line(first + lines)) != SMBX64::PARSE_OK)
+            return 0;
+        lines++;
+        if(smbx64NpcHasContentsSpecial(id, contents))
+            lines++;
+        break;
+    }
+    default:
+        break;
+    }
+
+    if(ge(3))
+    {
+        bool generator;
+        if(SMBX64::ParseCSVBool(&generator, index.line(first + lines)) != SMBX64::PARSE_OK)
+            return 0;
+        lines += generator ? 4 : 1;
+    }
+
+    return lines + (ge(5) ? 1 : 0) + (ge(6) ? 2 : 0) + (ge(9) ? 1 : 0) +
+           (ge(10) ? 4 : 0) + (ge(14) ? 1 : 0) + (ge(63) ? 1 : 0);
+}
+
+static size_t smbx64LvlWarpLines(const SMBX64_LineIndex &, size_t, unsigned int file_format)
+{
+    return 7 + (ge(3) ? 3 : 0) + (ge(4) ? 3 : 0) + (ge(7) ? 1 : 0) + (ge(12) ? 2 : 0) + //-V112
+           (ge(23) ? 1 : 0) + (ge(25) ? 1 : 0) + (ge(26) ? 1 : 0);
+}
+
+typedef size_t (*SMBX64_RecordLines)(const SMBX64_LineIndex &index, size_t first, unsigned int file_format);
+
+/*
+ * Finds the first line of every record of the section which begins from the "line"
+ * and ends with the "next" line. The "next" line is added as the last entry,
+ * the "line" is moved to the line after it.
+ */
+static bool smbx64FindRecords(const SMBX64_LineIndex &index, size_t &line, unsigned int file_format,
+                              SMBX64_RecordLines recordLines, std::vector<size_t> &records)
+{
+    while(line < index.count())
+    {
+        records.push_back(line);
+        if(index.line(line) == "next")
+        {
+            line++;
+            return true;
+        }
+
+        size_t lines = recordLines(index, line, file_format);
+        if(lines == 0)
+            return false;
+        line += lines;
+    }
+
+    return false;
+}
+
+//! Decodes records from the "first" to the "last" (not included) of the section
+template<class T>
+static bool smbx64DecodeRecords(const SMBX64_LineIndex &index, const std::vector<size_t> &records,
+                                size_t first, size_t last, unsigned int file_format,
+                                bool (*decode)(SMBX64_LineCursor &, PGESTRING &, SMBX64::ParseError &, unsigned int, T &),
+                                PGELIST<T> &items)
+{
+    SMBX64_LineCursor in(index, records[first]);
+    SMBX64::ParseError parse_error;
+    PGESTRING line;
+    T item;
+
+    try
+    {
+        for(size_t i = first; i < last; i++)
+        {
+            nextLine();
+            if(!decode(in, line, parse_error, file_format, item))
+                return false;
+            items.push_back(item);
+        }
+    }
+    catch(const std::exception &)
+    {
         return false;
     }
+
+    return true;
 }
 
+bool FileFormats::ReadSMBX64LvlFile(PGE_FileFormats_misc::TextInput &in, LevelData &FileData, unsigned int threads)
+{
+    threads = PGEFile::parallelThreads(threads);
+    if(threads <= 1)
+        return ReadSMBX64LvlFile(in, FileData);
 
+    PGESTRING filePath = in.getFilePath();
+    PGESTRING rawData = in.readAll();
+    PGE_FileFormats_misc::RawTextInput file;
+
+    //Pass 1: find the first line of every block, BGO, NPC and warp
+    SMBX64_LineIndex index(rawData);
+    unsigned int file_format = 0;
+    std::vector<size_t> sections[4];
+    bool withWarps;
+    size_t line, objectsBegin;
 
+    if(SMBX64::ParseUInt(&file_format, index.line(0)) != SMBX64::PARSE_OK)
+    {
+        file.open(&rawData, filePath);
+        return ReadSMBX64LvlFile(file, FileData);
+    }
+
+    //Warps are terminated by the "next" line since SMBX 1.0.0 only
+    withWarps = ge(10);
+    line = 1 + (ge(17) ? 1 : 0) + (ge(60) ? 1 : 0); //Header
+    line += (ge(8) ? 21 : 6) * (9 + (ge(1) ? 1 : 0) + (ge(30) ? 1 : 0) + (ge(2) ? 1 : 0)); //Sections
+    line += 2 * 4; //Player points
+    objectsBegin = line;
+
+    if(!smbx64FindRecords(index, line, file_format, smbx64LvlBlockLines, sections[0]) ||
+       !smbx64FindRecords(index, line, file_format, smbx64LvlBgoLines, sections[1]) ||
+       !smbx64FindRecords(index, line, file_format, smbx64LvlNpcLines, sections[2]) ||
+       (withWarps && !smbx64FindRecords(index, line, file_format, smbx64LvlWarpLines, sections[3])))
+    {
+        file.open(&rawData, filePath);
+        return ReadSMBX64LvlFile(file, FileData);
+    }
 
+    //Pass 2: decode objects by chunks
+    struct Chunk
+    {
+        int section;
+        size_t first;
+        size_t last;
+    };
+    std::vector<Chunk> chunks;
+
+    for(int s = 0; s < 4; s++)
+    {
+        size_t records = sections[s].empty() ? 0 : sections[s].size() - 1;
+        size_t count = std::min(static_cast<size_t>(threads), (records + 255) / 256);
+        for(size_t c = 0; c < count; c++)
+            chunks.push_back({s, records * c / count, records * (c + 1) / count});
+    }
+
+    if(chunks.size() <= 1)
+    {
+        file.open(&rawData, filePath);
+        return ReadSMBX64LvlFile(file, FileData);
+    }
+
+    std::vector<LevelData> parts(chunks.size());
+    std::vector<char> valid(chunks.size(), 0);
+
+    PGEFile::runParallel(static_cast<pge_size_t>(chunks.size()), threads, [&](pge_size_t i)
+    {
+        const Chunk &c = chunks[static_cast<size_t>(i)];
+        const std::vector<size_t> &records = sections[c.section];
+        LevelData &part = parts[static_cast<size_t>(i)];
+        bool ok = false;
+
+        switch(c.section)
+        {
+        case 0:
+            ok = smbx64DecodeRecords(index, records, c.first, c.last, file_format, readSMBX64LvlBlock<SMBX64_LineCursor>, part.blocks);
+            break;
+        case 1:
+            ok = smbx64DecodeRecords(index, records, c.first, c.last, file_format, readSMBX64LvlBgo<SMBX64_LineCursor>, part.bgo);
+            break;
+        case 2:
+            ok = smbx64DecodeRecords(index, records, c.first, c.last, file_format, readSMBX64LvlNpc<SMBX64_LineCursor>, part.npc);
+            break;
+        default:
+            ok = smbx64DecodeRecords(index, records, c.first, c.last, file_format, readSMBX64LvlWarp<SMBX64_LineCursor>, part.doors);
+            break;
+        }
+
+        valid[static_cast<size_t>(i)] = ok;
+    });
+
+    //Other data is decoded by the serial reader with object sections cut out
+    PGESTRING rest = PGE_SubStr(rawData, 0, static_cast<int>(index.begin(objectsBegin)));
+    rest += withWarps ? "next\nnext\nnext\nnext\n" : "next\nnext\nnext\n";
+    rest += PGE_SubStr(rawData, static_cast<int>(index.begin(line)));
+    file.open(&rest, filePath);
+    bool restValid = ReadSMBX64LvlFile(file, FileData);
+
+    for(size_t i = 0; restValid && (i < valid.size()); i++)
+        restValid = valid[i] != 0;
+
+    if(!restValid)
+    {
+        //Decode whole data again to report the error exactly like the serial reader does
+        file.open(&rawData, filePath);
+        return ReadSMBX64LvlFile(file, FileData);
+    }
+
+    for(size_t i = 0; i < parts.size(); i++)
+    {
+        LevelData &part = parts[i];
+        PGEFile::mergeChunkItems(FileData.blocks, part.blocks, FileData.blocks_array_id);
+        PGEFile::mergeChunkItems(FileData.bgo, part.bgo, FileData.bgo_array_id);
+        PGEFile::mergeChunkItems(FileData.npc, part.npc, FileData.npc_array_id);
+        PGEFile::mergeChunkItems(FileData.doors, part.doors, FileData.doors_array_id);
+    }
+
+    return true;
+}
 
 
 
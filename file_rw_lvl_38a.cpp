@@ -82,7 +82,7 @@ bool FileFormats::ReadSMBX38ALvlFileHeader(const PGESTRING &filePath, LevelData
     return ReadSMBX38ALvlFileHeaderT(inf, FileData);
 }
 
-bool FileFormats::ReadSMBX38ALvlFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData)
+bool FileFormats::ReadSMBX38ALvlFileHeaderRaw(const PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData)
 {
     FileData.meta.ERROR_info.clear();
     CreateLevelHeader(FileData);
@@ -99,6 +99,23 @@ bool FileFormats::ReadSMBX38ALvlFileHeaderRaw(PGESTRING &rawdata, const PGESTRIN
     return ReadSMBX38ALvlFileHeaderT(inf, FileData);
 }
 
+bool FileFormats::ReadSMBX38ALvlFileHeaderRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, LevelData &FileData)
+{
+    FileData.meta.ERROR_info.clear();
+    CreateLevelHeader(FileData);
+    FileData.meta.RecentFormat = LevelData::SMBX38A;
+    PGE_FileFormats_misc::ViewTextInput inf;
+
+    if(!inf.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ERROR_info = "Can't open file";
+        FileData.meta.ReadFileValid = false;
+        return false;
+    }
+
+    return ReadSMBX38ALvlFileHeaderT(inf, FileData);
+}
+
 bool FileFormats::ReadSMBX38ALvlFileHeaderT(PGE_FileFormats_misc::TextInput &inf, LevelData &FileData)
 {
 #if !defined(_MSC_VER) || _MSC_VER > 1800
@@ -129,7 +146,7 @@ bool FileFormats::ReadSMBX38ALvlFileHeaderT(PGE_FileFormats_misc::TextInput &inf
 
         while(!inf.eof())
         {
-            PGESTRING identifier = dataReader.ReadField<PGESTRING>(1);
+            CSVPGESTRINGField identifier = dataReader.ReadField<CSVPGESTRINGField>(1);
 
             if(identifier == "A")
             {
@@ -213,7 +230,7 @@ bool FileFormats::ReadSMBX38ALvlFileF(const PGESTRING &filePath, LevelData &File
     return ReadSMBX38Level(file, FileData);
 }
 
-bool FileFormats::ReadSMBX38ALvlFileRaw(PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData)
+bool FileFormats::ReadSMBX38ALvlFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData)
 {
     FileData.meta.ERROR_info.clear();
     PGE_FileFormats_misc::RawTextInput file;
@@ -230,6 +247,23 @@ bool FileFormats::ReadSMBX38ALvlFileRaw(PGESTRING &rawdata, const PGESTRING &fil
     return ReadSMBX38Level(file, FileData);
 }
 
+bool FileFormats::ReadSMBX38ALvlFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, LevelData &FileData)
+{
+    FileData.meta.ERROR_info.clear();
+    PGE_FileFormats_misc::ViewTextInput file;
+
+    if(!file.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ERROR_info = "Failed to open raw string for read";
+        FileData.meta.ERROR_linedata.clear();
+        FileData.meta.ERROR_linenum = -1;
+        FileData.meta.ReadFileValid = false;
+        return false;
+    }
+
+    return ReadSMBX38Level(file, FileData);
+}
+
 struct LevelEvent_layers
 {
     PGESTRING hide;
@@ -283,7 +317,7 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
     LevelScript scriptdata;
     LevelItemSetup38A customcfg;
 
-    PGESTRING   identifier;
+    uint32_t    recordId = 0;
 
     //Add path data
     if(!IsEmpty(filePath))
@@ -312,9 +346,11 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
 
         while(!in.eof())
         {
-            identifier = dataReader.ReadField<PGESTRING>(1);
+            recordId = SMBX38A_RecordId(dataReader.ReadField<CSVPGESTRINGField>(1));
 
-            if(identifier == "A")
+            switch(recordId)
+            {
+            case SMBX38A_RecordId("A"):
             {
                 // FIXME: Remove copy from line 77
                 // A|param1|param2[|param3|param4]|
@@ -351,8 +387,9 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                         FileData.music_overrides.push_back(mo);
                     }
                 }
+                break;
             }
-            else if(identifier == "BTNS")
+            case SMBX38A_RecordId("BTNS"):
             {
                 // BTNS|mario|luigi|peach|toad|link
                 FileData.player_names_overrides.clear();
@@ -366,23 +403,26 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                 );
                 for(size_t i = 0; i < 5; i++)
                     FileData.player_names_overrides.push_back(plr[i]);
+                break;
             }
-            else if(identifier == "P1")
+            case SMBX38A_RecordId("P1"):
             {
                 // P1|x1|y1
                 playerdata = CreateLvlPlayerPoint(1);
                 dataReader.ReadDataLine(CSVDiscard(), &playerdata.x, &playerdata.y);
                 FileData.players.push_back(playerdata);
+                break;
             }
-            else if(identifier == "P2")
+            case SMBX38A_RecordId("P2"):
             {
                 // P2|x2|y2
                 // FIXME: Copy from above (can be solved with switch?)
                 playerdata = CreateLvlPlayerPoint(2);
                 dataReader.ReadDataLine(CSVDiscard(), &playerdata.x, &playerdata.y);
                 FileData.players.push_back(playerdata);
+                break;
             }
-            else if(identifier == "M")
+            case SMBX38A_RecordId("M"):
             {
                 // M|id|x|y|w|h|b1|b2|b3|b4|b5|b6|music|background,lightingvalue|musicfile
                 section = CreateLvlSection();
@@ -451,8 +491,9 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                     FileData.sections[static_cast<pge_size_t>(section.id)] = section;//Replace if already exists
                 else
                     FileData.sections.push_back(section); //Add Section in main array
+                break;
             }
-            else if(identifier == "B")
+            case SMBX38A_RecordId("B"):
             {
                 // B|layer[,name]|id[,dx,dy]|x|y|contain,sp|b11[,b12]|b2|[e1,e2,e3,e4]|w|h
                 blockdata = CreateLvlBlock();
@@ -515,8 +556,9 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                     blockdata.w *= -1;
                 blockdata.meta.array_id = FileData.blocks_array_id++;
                 FileData.blocks.push_back(blockdata);
+                break;
             }
-            else if(identifier == "T")
+            case SMBX38A_RecordId("T"):
             {
                 // T|layer|id[,dx,dy]|x|y
                 bgodata = CreateLvlBgo();
@@ -531,8 +573,9 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                                         &bgodata.y);
                 bgodata.meta.array_id = FileData.bgo_array_id++;
                 FileData.bgo.push_back(bgodata);
+                break;
             }
-            else if(identifier == "N")
+            case SMBX38A_RecordId("N"):
             {
                 // N|layer[,name]|id[,dx,dy]|x|y|b1,b2,b3,b4|sp|[e1,e2,e3,e4,e5,e6,e7]|a1,a2|c1[,c2,c3,c4,c5,c6,c7]|msg|
                 // N|layer[,name]|id[,dx,dy]|x|y|b1,b2,b3,b4|sp|[e1,e2,e3,e4,e5,e6,e7]|a1,a2|c1[,c2,c3,c4,c5,c6,c7]|msg|
@@ -678,8 +721,9 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                                            PGE_FileLibrary::TimeUnit::Decisecond);
                 npcdata.meta.array_id = FileData.npc_array_id++;
                 FileData.npc.push_back(npcdata);
+                break;
             }
-            else if(identifier == "Q")
+            case SMBX38A_RecordId("Q"):
             {
                 // Q|layer|x|y|w|h|b1,b2,b3,b4,b5|event
                 phyEnv = CreateLvlPhysEnv();
@@ -702,8 +746,9 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                                        );
                 phyEnv.meta.array_id = FileData.physenv_array_id++;
                 FileData.physez.push_back(phyEnv);
+                break;
             }
-            else if(identifier == "W")
+            case SMBX38A_RecordId("W"):
             {
                 // W|layer|x|y|ex|ey|type|enterd|exitd|sn,msg,hide|locked,noyoshi,canpick,bomb,hidef,anpc,mini,size|lik|liid|noexit|wx|wy|le|we
                 // W|layer|x|y|ex|ey|type|enterd|exitd|sn,msg,hide|locked,noyoshi,canpick,bomb,hidef,anpc,mini,size,ts,cannon,stand|lik|liid|noexit|wx|wy|le|we
@@ -815,8 +860,9 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                     doordata.cannon_exit_speed = 10.0;
                 doordata.meta.array_id = FileData.doors_array_id++;
                 FileData.doors.push_back(doordata);
+                break;
             }
-            else if(identifier == "L")
+            case SMBX38A_RecordId("L"):
             {
                 // L|name|status
                 layerdata = CreateLvlLayer();
@@ -826,8 +872,9 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                                        );
                 layerdata.meta.array_id = FileData.layers_array_id++;
                 FileData.layers.push_back(layerdata);
+                break;
             }
-            else if(identifier == "E")
+            case SMBX38A_RecordId("E"):
             {
                 // E|name|msg|ea|el|elm|epy|eps|eef|ecn|evc|ene
                 eventdata = CreateLvlEvent();
@@ -865,7 +912,7 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                                                 MakeCSVBatchReader(dataReader, ',', &eventdata.layers_toggle, PGEUrlDecodeFunc)
                                                         ),
                                         // elm=elm1/elm2...elmn
-                                        MakeCSVIterator(dataReader, '/', [&eventdata](const PGESTRING & nextFieldStr)
+                                        MakeCSVIterator(dataReader, '/', [&eventdata](const CSVPGESTRINGField &nextFieldStr)
                 {
                     auto fieldReader = MakeDirectReader(nextFieldStr);
                     auto fullReader  = MakeCSVReaderForPGESTRING(&fieldReader, ',');
@@ -899,7 +946,7 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                                 ),
                 // eps=esection/ebackground/emusic
                 MakeCSVSubReader(dataReader, '/', //-V681
-                                 MakeCSVIterator(dataReader, ':', [&eventdata](const PGESTRING & nextFieldStr)
+                                 MakeCSVIterator(dataReader, ':', [&eventdata](const CSVPGESTRINGField &nextFieldStr)
                 {
                     auto fieldReader = MakeDirectReader(nextFieldStr);
                     auto fullReader = MakeCSVReaderForPGESTRING(&fieldReader, ',');
@@ -996,7 +1043,7 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                     eventdata.scroll_section = static_cast<long>(sectionID);
                 }),
 
-                MakeCSVIterator(dataReader, ':', [&eventdata](const PGESTRING & nextFieldStr)
+                MakeCSVIterator(dataReader, ':', [&eventdata](const CSVPGESTRINGField &nextFieldStr)
                 {
                     auto fieldReader = MakeDirectReader(nextFieldStr);
                     auto fullReader = MakeCSVReaderForPGESTRING(&fieldReader, ',');
@@ -1032,7 +1079,7 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                     SMBX38A_mapBGID_From(nextSet.background_id);//Convert into SMBX64 ID set
                 }),
 
-                MakeCSVIterator(dataReader, ':', [&eventdata](const PGESTRING & nextFieldStr)
+                MakeCSVIterator(dataReader, ':', [&eventdata](const CSVPGESTRINGField &nextFieldStr)
                 {
                     auto fieldReader = MakeDirectReader(nextFieldStr);
                     auto fullReader = MakeCSVReaderForPGESTRING(&fieldReader, ',');
@@ -1069,7 +1116,7 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                 })
                 ),
                 // eef=sound/endgame/ce1/ce2...cen
-                MakeCSVIterator(dataReader, '/', [&eventdata, &spawnNpcReaderCurrentIndex](const PGESTRING & nextFieldStr)
+                MakeCSVIterator(dataReader, '/', [&eventdata, &spawnNpcReaderCurrentIndex](const CSVPGESTRINGField &nextFieldStr)
                 {
                     switch(spawnNpcReaderCurrentIndex)
                     {
@@ -1111,7 +1158,7 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                     }
                 }),
                 // ecn=cn1/cn2...cnn
-                MakeCSVIterator(dataReader, '/', [&eventdata](const PGESTRING & nextFieldStr)
+                MakeCSVIterator(dataReader, '/', [&eventdata](const CSVPGESTRINGField &nextFieldStr)
                 {
                     auto fieldReader = MakeDirectReader(nextFieldStr);
                     auto fullReader = MakeCSVReaderForPGESTRING(&fieldReader, ',');
@@ -1130,7 +1177,7 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                     eventdata.spawn_npc.push_back(spawnnpc);
                 }),
                 // evc=vc1/vc2...vcn
-                MakeCSVIterator(dataReader, '/', [&eventdata](const PGESTRING & nextFieldStr)
+                MakeCSVIterator(dataReader, '/', [&eventdata](const CSVPGESTRINGField &nextFieldStr)
                 {
                     auto fieldReader = MakeDirectReader(nextFieldStr);
                     auto fullReader = MakeCSVReaderForPGESTRING(&fieldReader, ',');
@@ -1165,8 +1212,9 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                                                PGE_FileLibrary::TimeUnit::Millisecond);
                 eventdata.meta.array_id = FileData.events_array_id++;
                 FileData.events.push_back(eventdata);
+                break;
             }
-            else if(identifier == "V")
+            case SMBX38A_RecordId("V"):
             {
                 // V|name|value
                 vardata = CreateLvlVariable("var");
@@ -1177,11 +1225,12 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                                                           variables to be universal */
                                        );
                 FileData.variables.push_back(vardata);
+                break;
             }
-            else if(identifier == "R")
+            case SMBX38A_RecordId("R"):
             {
                 // R|name1|name2|name3|....namen
-                dataReader.IterateDataLine([&FileData](const PGESTRING & nextFieldStr)
+                dataReader.IterateDataLine([&FileData](const CSVPGESTRINGField &nextFieldStr)
                 {
                     if(nextFieldStr == "R")
                         return;
@@ -1193,8 +1242,9 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                     );
                     FileData.arrays.push_back(arr);
                 });
+                break;
             }
-            else if(identifier == "S")
+            case SMBX38A_RecordId("S"):
             {
                 // S|name|script
                 scriptdata = CreateLvlScript("doScript", LevelScript::LANG_TEASCRIPT);
@@ -1203,8 +1253,10 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                                         MakeCSVPostProcessor(&scriptdata.script, PGEBase64DecodeFunc)
                                        );
                 FileData.scripts.push_back(scriptdata);
+                break;
             }
-            else if(identifier == "Su" || identifier == "SU")
+            case SMBX38A_RecordId("Su"):
+            case SMBX38A_RecordId("SU"):
             {
                 // Su|name|scriptu
                 scriptdata = CreateLvlScript("doScript", LevelScript::LANG_TEASCRIPT);
@@ -1215,14 +1267,17 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                 //Convert to LF
                 PGE_ReplSTRING(scriptdata.script, "\r\n", "\n");
                 FileData.scripts.push_back(scriptdata);
+                break;
             }
-            else if((identifier == "CB") || (identifier == "CT") || (identifier == "CE") )
+            case SMBX38A_RecordId("CB"):
+            case SMBX38A_RecordId("CT"):
+            case SMBX38A_RecordId("CE"):
             {
                 // CB|id|data   :custom block/background/effect
                 customcfg = LevelItemSetup38A();
-                if(identifier == "CB")
+                if(recordId == SMBX38A_RecordId("CB"))
                     customcfg.type = LevelItemSetup38A::BLOCK;
-                else if(identifier == "CT")
+                else if(recordId == SMBX38A_RecordId("CT"))
                     customcfg.type = LevelItemSetup38A::BGO;
                 else
                     customcfg.type = LevelItemSetup38A::EFFECT;
@@ -1230,7 +1285,7 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                 dataReader.ReadDataLine(CSVDiscard(),
                                         &customcfg.id,
                                         MakeCSVIterator(dataReader, ',',
-                                                        [&customcfg](const PGESTRING & nextFieldStr)
+                                                        [&customcfg](const CSVPGESTRINGField &nextFieldStr)
                 {
                     LevelItemSetup38A::Entry e;
                     SMBX38A_CC_decode(e.key, e.value, nextFieldStr);
@@ -1238,11 +1293,12 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                 })
                                        );
                 FileData.custom38A_configs.push_back(customcfg);
+                break;
             }
-            else if(identifier == "CW")
+            case SMBX38A_RecordId("CW"):
             {
                 // CW|cdata1|cdata2|...|cdatan	:custom sound:	same as wls file format
-                dataReader.IterateDataLine([&FileData](const PGESTRING & nextFieldStr)
+                dataReader.IterateDataLine([&FileData](const CSVPGESTRINGField &nextFieldStr)
                 {
                     if(nextFieldStr == "CW")
                         return;
@@ -1255,13 +1311,16 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
                                            );
                     FileData.sound_overrides.push_back(mo);
                 });
+                break;
             }
-            else
+            default:
             {
                 // Unsupported line, just keep it
                 PGESTRING str;
                 dataReader.ReadRawLine(str);
                 FileData.unsupported_38a_lines.push_back(str);
+                break;
+            }
             }
         }//while is not EOF
     }
@@ -1290,8 +1349,8 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
         FileData.meta.ReadFileValid = false;
         FileData.meta.ERROR_info = "Invalid file format, detected file SMBX-38A-" + fromNum(FileData.meta.RecentFormatVersion) + " format\n"
                                    "Caused by: \n" + PGESTRING(exception_to_pretty_string(err).c_str());
-        if(!IsEmpty(identifier))
-            FileData.meta.ERROR_info += "\n Field type " + identifier;
+        if(recordId != 0)
+            FileData.meta.ERROR_info += "\n Field type " + SMBX38A_RecordIdToString(recordId);
 
         // If we were unable to find error line number from the exception, then get the line number from the file reader.
         if(FileData.meta.ERROR_linenum == 0)
@@ -1310,8 +1369,8 @@ bool FileFormats::ReadSMBX38ALvlFile(PGE_FileFormats_misc::TextInput &in, LevelD
         FileData.meta.ReadFileValid = false;
         FileData.meta.ERROR_info = "Invalid file format, detected file SMBX-38A-" + fromNum(FileData.meta.RecentFormatVersion) + " format\n"
                                    "Caused by unknown exception\n";
-        if(!IsEmpty(identifier))
-            FileData.meta.ERROR_info += "\n Field type " + identifier;
+        if(recordId != 0)
+            FileData.meta.ERROR_info += "\n Field type " + SMBX38A_RecordIdToString(recordId);
 
         // If we were unable to find error line number from the exception, then get the line number from the file reader.
         if(FileData.meta.ERROR_linenum == 0)
@@ -1373,7 +1432,8 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
     FileData.meta.RecentFormatVersion = 68; // TODO: Make a version choosing
     //Count placed stars on this level
     FileData.stars = smbx64CountStars(FileData);
-#define layerNotDef(lr) ( ((lr) != "Default") ? PGE_URLENC(lr) : "" )
+    const PGESTRING noLayer;
+#define layerNotDef(lr) PGE_URLENC_OUT(((lr) != "Default") ? (lr) : noLayer)
     //========================================================
     //Data type markers:
     //A         - Level header settings
@@ -1393,22 +1453,22 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
     //line 1:
     //    SMBXFile??
     //    ??=Version number
-    out << "SMBXFile" << fromNum(FileData.meta.RecentFormatVersion) << "\n";
+    out << "SMBXFile" << PGE_NUM_OUT(FileData.meta.RecentFormatVersion) << "\n";
     //next line: level settings
     //    A|param1|param2[|param3|param4]
     //    []=optional
     out << "A";
     //    param1=the number of stars on this level
-    out << "|" << fromNum(FileData.stars);
+    out << "|" << PGE_NUM_OUT(FileData.stars);
     //    param2=level title
-    out << "|" << PGE_URLENC(FileData.LevelName);
+    out << "|" << PGE_URLENC_OUT(FileData.LevelName);
 
     if(!IsEmpty(FileData.open_level_on_fail))
     {
         //    param3=a filename, when player died, the player will be sent to this level.
-        out << "|" << PGE_URLENC(FileData.open_level_on_fail);
+        out << "|" << PGE_URLENC_OUT(FileData.open_level_on_fail);
         //    param4=normal entrance / to warp [0-WARPMAX]
-        out << "|" << fromNum(FileData.open_level_on_fail_warpID);
+        out << "|" << PGE_NUM_OUT(FileData.open_level_on_fail_warpID);
     } else {
         out << "|||";
     }
@@ -1433,7 +1493,7 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         {
             if(it > 0)
                 out << ",";
-            out << PGE_URLENC(s[it]);
+            out << PGE_URLENC_OUT(s[it]);
         }
     }
 
@@ -1445,13 +1505,13 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         //    P1|x1|y1
         //    P2|x2|y2
         const PlayerPoint &pl = FileData.players[i];
-        out << "P" << fromNum(pl.id);
+        out << "P" << PGE_NUM_OUT(pl.id);
         //    x1=first player position x
         //    x2=second player position x
-        out << "|" << fromNum(pl.x);
+        out << "|" << PGE_NUM_OUT(pl.x);
         //    y1=first player position y
         //    y2=second player position y
-        out << "|" << fromNum(pl.y);
+        out << "|" << PGE_NUM_OUT(pl.y);
         out << "\n";
     }
 
@@ -1462,46 +1522,46 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         const LevelSection &sct = FileData.sections[i];
         out << "M";
         //    id=[1-SectionMAX]
-        out << "|" << fromNum(sct.id + 1);
+        out << "|" << PGE_NUM_OUT(sct.id + 1);
         //    x=Left size[-left/+right]
-        out << "|" << fromNum(sct.size_left);
+        out << "|" << PGE_NUM_OUT(sct.size_left);
         //    y=Top size[-down/+up]
-        out << "|" << fromNum(sct.size_top);
+        out << "|" << PGE_NUM_OUT(sct.size_top);
         //    w=width of the section[if (w < 800) w = 800]
-        out << "|" << fromNum(sct.size_right - sct.size_left);
+        out << "|" << PGE_NUM_OUT(sct.size_right - sct.size_left);
         //    h=height of the section[if (h < 600) h = 600]
-        out << "|" << fromNum(sct.size_bottom - sct.size_top);
+        out << "|" << PGE_NUM_OUT(sct.size_bottom - sct.size_top);
         //    b1=under water?[0=false !0=true]
-        out << "|" << fromNum((int)sct.underwater);
+        out << "|" << PGE_NUM_OUT((int)sct.underwater);
         //    b2=is x-level wrap[0=false !0=true]
-        out << "|" << fromNum(sct.wrap_h);
+        out << "|" << PGE_NUM_OUT(sct.wrap_h);
         //    b3=enable off screen exit[0=false !0=true]
-        out << "|" << fromNum((int)sct.OffScreenEn);
+        out << "|" << PGE_NUM_OUT((int)sct.OffScreenEn);
 
         //    b4=no turn back(x)[0=no x-scrolllock 1=scrolllock left 2=scrolllock right]
         if((!sct.lock_left_scroll) && (!sct.lock_right_scroll))
-            out << "|" << fromNum(0);
+            out << "|" << PGE_NUM_OUT(0);
         else if((sct.lock_left_scroll) && (!sct.lock_right_scroll))
-            out << "|" << fromNum(1);
+            out << "|" << PGE_NUM_OUT(1);
         else
-            out << "|" << fromNum(2);
+            out << "|" << PGE_NUM_OUT(2);
 
         //    b5=no turn back(y)[0=no y-scrolllock 1=scrolllock up 2=scrolllock down]
         if((!sct.lock_up_scroll) && (!sct.lock_down_scroll))
-            out << "|" << fromNum(0);
+            out << "|" << PGE_NUM_OUT(0);
         else if((sct.lock_up_scroll) && (!sct.lock_down_scroll))
-            out << "|" << fromNum(1);
+            out << "|" << PGE_NUM_OUT(1);
         else
-            out << "|" << fromNum(2);
+            out << "|" << PGE_NUM_OUT(2);
 
         //    b6=is y-level wrap[0=false !0=true]
-        out << "|" << fromNum(sct.wrap_v);
+        out << "|" << PGE_NUM_OUT(sct.wrap_v);
         //    music=music number[same as smbx1.3]
-        out << "|" << fromNum(sct.music_id);
+        out << "|" << PGE_NUM_OUT(sct.music_id);
         //    background=background number[same as the filename in 'background2' folder]
-        out << "|" << fromNum(SMBX38A_mapBGID_To(sct.background));
+        out << "|" << PGE_NUM_OUT(SMBX38A_mapBGID_To(sct.background));
         //    musicfile=custom music file[***urlencode!***]
-        out << "|" << PGE_URLENC(sct.music_file);
+        out << "|" << PGE_URLENC_OUT(sct.music_file);
         out << "\n";
     }
 
@@ -1516,44 +1576,45 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         //  only if name != ""
         //  name=block's name
         if(!IsEmpty(blk.gfx_name))
-            out << "," << PGE_URLENC(blk.gfx_name);
+            out << "," << PGE_URLENC_OUT(blk.gfx_name);
         //    id=block id
-        out << "|" << fromNum(blk.id);
+        out << "|" << PGE_NUM_OUT(blk.id);
         if((blk.gfx_dx) > 0 || (blk.gfx_dy > 0))
         {
             //  dx=graphics extend x
-            out << "," << fromNum(blk.gfx_dx);
+            out << "," << PGE_NUM_OUT(blk.gfx_dx);
             //  dy=graphics extend y
-            out << "," << fromNum(blk.gfx_dy);
+            out << "," << PGE_NUM_OUT(blk.gfx_dy);
         }
         //    x=block position x
-        out << "|" << fromNum(blk.x);
+        out << "|" << PGE_NUM_OUT(blk.x);
         //    y=block position y
-        out << "|" << fromNum(blk.y);
+        out << "|" << PGE_NUM_OUT(blk.y);
         //    contain=containing npc number
         //        [1001-1000+NPCMAX] npc-id
         //        [1-999] coin number
         //        [0] nothing
-        out << "|" << ((blk.npc_id == 0) ? ""
-                        : fromNum(blk.npc_id <= 0 ? (-1 * blk.npc_id) : (blk.npc_id + 1000)) );
+        out << "|";
+        if(blk.npc_id != 0)
+            out << PGE_NUM_OUT(blk.npc_id <= 0 ? (-1 * blk.npc_id) : (blk.npc_id + 1000));
         //    b11=slippery[0=false !0=true]
-        out << "|" << fromNum((int)blk.slippery);
+        out << "|" << PGE_NUM_OUT((int)blk.slippery);
         //    b12=wing type
         //    b2=invisible[0=false !0=true]
-        out << "," << fromNum(blk.motion_ai_id);
-        out << "|" << fromNum((int)blk.invisible);
+        out << "," << PGE_NUM_OUT(blk.motion_ai_id);
+        out << "|" << PGE_NUM_OUT((int)blk.invisible);
         //    e1=block destory event name[***urlencode!***]
-        out << "|" << PGE_URLENC(blk.event_destroy);
+        out << "|" << PGE_URLENC_OUT(blk.event_destroy);
         //    e2=block hit event name[***urlencode!***]
-        out << "," << PGE_URLENC(blk.event_hit);
+        out << "," << PGE_URLENC_OUT(blk.event_hit);
         //    e3=no more object in layer event name[***urlencode!***]4
-        out << "," << PGE_URLENC(blk.event_emptylayer);
+        out << "," << PGE_URLENC_OUT(blk.event_emptylayer);
         //    e4=block onscreen event name[***urlencode!***]
-        out << "," << PGE_URLENC(blk.event_on_screen);
+        out << "," << PGE_URLENC_OUT(blk.event_on_screen);
         //    w=width
-        out << "|" << fromNum(blk.autoscale ? (-1 * blk.w) : blk.w);
+        out << "|" << PGE_NUM_OUT(blk.autoscale ? (-1 * blk.w) : blk.w);
         //    h=height
-        out << "|" << fromNum(blk.h);
+        out << "|" << PGE_NUM_OUT(blk.h);
         out << "\n";
     }
 
@@ -1566,18 +1627,18 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         //    layer=layer name["" == "Default"][***urlencode!***]
         out << "|" << layerNotDef(bgo.layer);
         //    id=background id
-        out << "|" << fromNum(bgo.id);
+        out << "|" << PGE_NUM_OUT(bgo.id);
         if((bgo.gfx_dx) > 0 || (bgo.gfx_dy > 0))
         {
             //  dx=graphics extend x
-            out << "," << fromNum(bgo.gfx_dx);
+            out << "," << PGE_NUM_OUT(bgo.gfx_dx);
             //  dy=graphics extend y
-            out << "," << fromNum(bgo.gfx_dy);
+            out << "," << PGE_NUM_OUT(bgo.gfx_dy);
         }
         //    x=background position x
-        out << "|" << fromNum(bgo.x);
+        out << "|" << PGE_NUM_OUT(bgo.x);
         //    y=background position y
-        out << "|" << fromNum(bgo.y);
+        out << "|" << PGE_NUM_OUT(bgo.y);
         out << "\n";
     }
 
@@ -1671,51 +1732,51 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         //only if name != ""
         //name=npc's name
         if(!IsEmpty(npc.gfx_name))
-            out << "," << PGE_URLENC(npc.gfx_name);
+            out << "," << PGE_URLENC_OUT(npc.gfx_name);
         //    id=npc id
-        out << "|" << fromNum(npcID);
+        out << "|" << PGE_NUM_OUT(npcID);
         if((npc.gfx_dx) > 0 || (npc.gfx_dy > 0))
         {
             //  dx=graphics extend x
-            out << "," << fromNum(npc.gfx_dx);
+            out << "," << PGE_NUM_OUT(npc.gfx_dx);
             //  dy=graphics extend y
-            out << "," << fromNum(npc.gfx_dy);
+            out << "," << PGE_NUM_OUT(npc.gfx_dy);
         }
         //    x=npc position x
-        out << "|" << fromNum(npc.x);
+        out << "|" << PGE_NUM_OUT(npc.x);
         //    y=npc position y
-        out << "|" << fromNum(npc.y);
+        out << "|" << PGE_NUM_OUT(npc.y);
         //    b1=[1]left [0]random [-1]right
-        out << "|" << fromNum(direct);
+        out << "|" << PGE_NUM_OUT(direct);
         //    b2=friendly npc
-        out << "," << fromNum((int)npc.friendly);
+        out << "," << PGE_NUM_OUT((int)npc.friendly);
         //    b3=don't move npc
-        out << "," << fromNum((int)npc.nomove);
+        out << "," << PGE_NUM_OUT((int)npc.nomove);
         //    b4=[1=npc91][2=npc96][3=npc283][4=npc284][5=npc300]
-        out << "," << fromNum(containerType);
+        out << "," << PGE_NUM_OUT(containerType);
         //    sp=special option
-        out << "|" << fromNum(specialData);
+        out << "|" << PGE_NUM_OUT(specialData);
         //        [***urlencode!***]
         //        e1=death event
-        out << "|" << PGE_URLENC(npc.event_die);
+        out << "|" << PGE_URLENC_OUT(npc.event_die);
         //        e2=talk event
-        out << "," << PGE_URLENC(npc.event_talk);
+        out << "," << PGE_URLENC_OUT(npc.event_talk);
         //        e3=activate event
-        out << "," << PGE_URLENC(npc.event_activate);
+        out << "," << PGE_URLENC_OUT(npc.event_activate);
         //        e4=no more object in layer event
-        out << "," << PGE_URLENC(npc.event_emptylayer);
+        out << "," << PGE_URLENC_OUT(npc.event_emptylayer);
         //        e5=grabed event
-        out << "," << PGE_URLENC(npc.event_grab);
+        out << "," << PGE_URLENC_OUT(npc.event_grab);
         //        e6=next frame event
-        out << "," << PGE_URLENC(npc.event_nextframe);
+        out << "," << PGE_URLENC_OUT(npc.event_nextframe);
         //        e7=touch event
-        out << "," << PGE_URLENC(npc.event_touch);
+        out << "," << PGE_URLENC_OUT(npc.event_touch);
         //        a1=layer name to attach
-        out << "|" << PGE_URLENC(npc.attach_layer);
+        out << "|" << PGE_URLENC_OUT(npc.attach_layer);
         //        a2=variable name to send
-        out << "," << PGE_URLENC(npc.send_id_to_variable);
+        out << "," << PGE_URLENC_OUT(npc.send_id_to_variable);
         //    c1=generator enable
-        out << "|" << fromNum((int)npc.generator);
+        out << "|" << PGE_NUM_OUT((int)npc.generator);
 
         //        [if c1!=0]
         if(npc.generator)
@@ -1723,7 +1784,7 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
             //        c2=generator period[1 frame]
             //Convert deciseconds into frames with rounding
             SMBX38A_RestoreOrigTime(npc.generator_period_orig, (long)npc.generator_period, PGE_FileLibrary::TimeUnit::Decisecond);
-            out << "," << fromNum(npc.generator_period_orig);
+            out << "," << PGE_NUM_OUT(npc.generator_period_orig);
             //        c3=generator effect
             //            c3-1 [1=warp][0=projective][4=no effect]
             //            c3-2 [0=center][1=up][2=left][3=down][4=right][9=up+left][10=left+down][11=down+right][12=right+up]
@@ -1731,19 +1792,19 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
             //                c3=4*(c3-1)+(c3-2)
             //                else
             //                c3=0
-            out << "," << fromNum(genType);
+            out << "," << PGE_NUM_OUT(genType);
             //        c4=generator direction[angle][when c3=0]
-            out << "," << fromNum(npc.generator_custom_angle);
+            out << "," << PGE_NUM_OUT(npc.generator_custom_angle);
             //        c5=batch[when c3=0][MAX=32]
-            out << "," << fromNum(npc.generator_branches);
+            out << "," << PGE_NUM_OUT(npc.generator_branches);
             //        c6=angle range[when c3=0]
-            out << "," << fromNum(npc.generator_angle_range);
+            out << "," << PGE_NUM_OUT(npc.generator_angle_range);
             //        c7=speed[when c3=0][float]
-            out << "," << fromNum(npc.generator_initial_speed);
+            out << "," << PGE_NUM_OUT(npc.generator_initial_speed);
         }
 
         //    msg=message by this npc talkative[***urlencode!***]
-        out << "|" << PGE_URLENC(npc.msg);
+        out << "|" << PGE_URLENC_OUT(npc.msg);
         out << "\n";
     }
 
@@ -1785,13 +1846,13 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         //    layer=layer name["" == "Default"][***urlencode!***]
         out << "|" << layerNotDef(door.layer);
         //    x=entrance position x
-        out << "|" << fromNum(door.ix);
+        out << "|" << PGE_NUM_OUT(door.ix);
         //    y=entrance postion y
-        out << "|" << fromNum(door.iy);
+        out << "|" << PGE_NUM_OUT(door.iy);
         //    ex=exit position x
-        out << "|" << fromNum(door.ox);
+        out << "|" << PGE_NUM_OUT(door.ox);
         //    ey=exit position y
-        out << "|" << fromNum(door.oy);
+        out << "|" << PGE_NUM_OUT(door.oy);
         //    type=[1=pipe][2=door][0=instant][3=loop]
         {
             //type%100=[0=instant][1=pipe][2=door]
@@ -1809,57 +1870,57 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
             }
             //type/100=[0=none][1=Scroll][2=Fade][3=FlipH][4=FlipV]
             type += te * 100;
-            out << "|" << fromNum(type);
+            out << "|" << PGE_NUM_OUT(type);
         }
         //    enterd=entrance direction[1=up 2=left 3=down 4=right]
-        out << "|" << fromNum(door.idirect);
+        out << "|" << PGE_NUM_OUT(door.idirect);
         //    exitd=exit direction[1=up 2=left 3=down 4=right]
-        out << "|" << fromNum(oDirect);
+        out << "|" << PGE_NUM_OUT(oDirect);
         //    sn=need stars for enter
-        out << "|" << fromNum(door.stars);
+        out << "|" << PGE_NUM_OUT(door.stars);
         //    msg=a message when you have not enough stars
-        out << "," << PGE_URLENC(door.stars_msg);
+        out << "," << PGE_URLENC_OUT(door.stars_msg);
         //    hide=hide the star number in this warp
-        out << "," << fromNum((int)door.star_num_hide);
+        out << "," << PGE_NUM_OUT((int)door.star_num_hide);
         //    locked=locked
-        out << "|" << fromNum((int)door.locked);
+        out << "|" << PGE_NUM_OUT((int)door.locked);
         //    noyoshi=no yoshi
-        out << "," << fromNum((int)door.novehicles);
+        out << "," << PGE_NUM_OUT((int)door.novehicles);
         //    canpick=allow npc
-        out << "," << fromNum((int)door.allownpc);
+        out << "," << PGE_NUM_OUT((int)door.allownpc);
         //    bomb=need a bomb
-        out << "," << fromNum((int)door.need_a_bomb);
+        out << "," << PGE_NUM_OUT((int)door.need_a_bomb);
         //    hide=hide the entry scene
-        out << "," << fromNum((int)door.hide_entering_scene);
+        out << "," << PGE_NUM_OUT((int)door.hide_entering_scene);
         //    anpc=allow npc interlevel
-        out << "," << fromNum((int)door.allownpc_interlevel);
+        out << "," << PGE_NUM_OUT((int)door.allownpc_interlevel);
         //    mini=Mini-Only
-        out << "," << fromNum((int)door.special_state_required);
+        out << "," << PGE_NUM_OUT((int)door.special_state_required);
         //    size=Warp Size(pixel)
-        out << "," << fromNum(door.length_i);
+        out << "," << PGE_NUM_OUT(door.length_i);
         if(door.two_way || door.cannon_exit || door.stood_state_required)
         {
             //    ts = two-way
-            out << "," << fromNum((int)door.two_way);
+            out << "," << PGE_NUM_OUT((int)door.two_way);
             //    cannon = Pipe Cannon Force
-            out << "," << fromNum(door.cannon_exit ? door.cannon_exit_speed : 0.0);
+            out << "," << PGE_NUM_OUT(door.cannon_exit ? door.cannon_exit_speed : 0.0);
             if(door.stood_state_required)
-                out << "," << fromNum((int)door.stood_state_required);
+                out << "," << PGE_NUM_OUT((int)door.stood_state_required);
         }
         //    lik=warp to level[***urlencode!***]
-        out << "|" << PGE_URLENC(door.lname);
+        out << "|" << PGE_URLENC_OUT(door.lname);
         //    liid=normal enterance / to warp[0-WARPMAX]
-        out << "|" << fromNum(door.warpto);
+        out << "|" << PGE_NUM_OUT(door.warpto);
         //    noexit=level entrance
-        out << "|" << fromNum((int)door.lvl_i);
+        out << "|" << PGE_NUM_OUT((int)door.lvl_i);
         //    wx=warp to x on world map
-        out << "|" << fromNum(door.world_x);
+        out << "|" << PGE_NUM_OUT(door.world_x);
         //    wy=warp to y on world map
-        out << "|" << fromNum(door.world_y);
+        out << "|" << PGE_NUM_OUT(door.world_y);
         //    le=level exit
-        out << "|" << fromNum((int)door.lvl_o);
+        out << "|" << PGE_NUM_OUT((int)door.lvl_o);
         //    we=warp event[***urlencode!***]
-        out << "|" << PGE_URLENC(door.event_enter);
+        out << "|" << PGE_URLENC_OUT(door.event_enter);
         out << "\n";
     }
 
@@ -1873,13 +1934,13 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         //    layer=layer name["" == "Default"][***urlencode!***]
         out << "|" << layerNotDef(pez.layer);
         //    x=position x
-        out << "|" << fromNum(pez.x);
+        out << "|" << PGE_NUM_OUT(pez.x);
         //    y=position y
-        out << "|" << fromNum(pez.y);
+        out << "|" << PGE_NUM_OUT(pez.y);
         //    w=width
-        out << "|" << fromNum(pez.w);
+        out << "|" << PGE_NUM_OUT(pez.w);
         //    h=height
-        out << "|" << fromNum(pez.h);
+        out << "|" << PGE_NUM_OUT(pez.h);
         //    b1=liquid type
         //        01-Water[friction=0.5]
         //        02-Quicksand[friction=0.1]
@@ -1894,17 +1955,17 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         //        11-Click Script
         //        12-Collision Event
         //        13-Air
-        out << "|" << fromNum((pez.env_type + 1));
+        out << "|" << PGE_NUM_OUT((pez.env_type + 1));
         //    b2=friction
-        out << "," << fromNum(pez.friction);
+        out << "," << PGE_NUM_OUT(pez.friction);
         //    b3=Acceleration Direction
-        out << "," << fromNum(pez.accel_direct);
+        out << "," << PGE_NUM_OUT(pez.accel_direct);
         //    b4=Acceleration
-        out << "," << fromNum(pez.accel);
+        out << "," << PGE_NUM_OUT(pez.accel);
         //    b5=Maximum Velocity
-        out << "," << fromNum(pez.max_velocity);
+        out << "," << PGE_NUM_OUT(pez.max_velocity);
         //    event=touch event
-        out << "|" << PGE_URLENC(pez.touch_event);
+        out << "|" << PGE_URLENC_OUT(pez.touch_event);
         out << "\n";
     }
 
@@ -1915,9 +1976,9 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         //    L|name|status
         out << "L";
         //    name=layer name[***urlencode!***]
-        out << "|" << PGE_URLENC(lyr.name);
+        out << "|" << PGE_URLENC_OUT(lyr.name);
         //    status=is vizible layer
-        out << "|" << fromNum((int)(!lyr.hidden));
+        out << "|" << PGE_NUM_OUT((int)(!lyr.hidden));
         out << "\n";
     }
 
@@ -1929,17 +1990,17 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         //    E|name|msg|ea|el|elm|epy|eps|eef|ecn|evc|ene
         out << "E";
         //    name=event name[***urlencode!***]
-        out << "|" << PGE_URLENC(evt.name);
+        out << "|" << PGE_URLENC_OUT(evt.name);
         //    msg=show message after start event[***urlencode!***]
-        out << "|" << PGE_URLENC(evt.msg);
+        out << "|" << PGE_URLENC_OUT(evt.msg);
         //    ea=val,syntax
         //        val=[0=not auto start][1=auto start when level start][2=auto start when match all condition][3=start when called and match all condidtion]
-        out << "|" << fromNum(evt.autostart);
+        out << "|" << PGE_NUM_OUT(evt.autostart);
         //        syntax=condidtion expression[***urlencode!***]
-        out << "," << PGE_URLENC(evt.autostart_condition);
+        out << "," << PGE_URLENC_OUT(evt.autostart_condition);
         //    el=b/s1,s2...sn/h1,h2...hn/t1,t2...tn
         //        b=no smoke[0=false !0=true]
-        out << "|" << fromNum((int)evt.nosmoke);
+        out << "|" << PGE_NUM_OUT((int)evt.nosmoke);
         //        [***urlencode!***]
         out << "/";
 
@@ -1948,7 +2009,7 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         {
             if(j > 0) out << ",";
 
-            out << PGE_URLENC(evt.layers_show[j]);
+            out << PGE_URLENC_OUT(evt.layers_show[j]);
         }
 
         out << "/";
@@ -1958,7 +2019,7 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         {
             if(j > 0) out << ",";
 
-            out << PGE_URLENC(evt.layers_hide[j]);
+            out << PGE_URLENC_OUT(evt.layers_hide[j]);
         }
 
         out << "/";
@@ -1968,7 +2029,7 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         {
             if(j > 0) out << ",";
 
-            out << PGE_URLENC(evt.layers_toggle[j]);
+            out << PGE_URLENC_OUT(evt.layers_toggle[j]);
         }
 
         out << "|";
@@ -1986,40 +2047,40 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
             PGESTRING expression_y = mvl.expression_y;
             SMBX38A_Num2Exp_URLEN(mvl.speed_x, expression_x);
             SMBX38A_Num2Exp_URLEN(mvl.speed_y, expression_y);
-            out << PGE_URLENC(mvl.name);
+            out << PGE_URLENC_OUT(mvl.name);
             //        horizontal syntax,vertical syntax[***urlencode!***][syntax]
             out << "," << expression_x;
             out << "," << expression_y;
             //        way=[0=by speed][1=by Coordinate]
-            out << "," << fromNum(mvl.way);
+            out << "," << PGE_NUM_OUT(mvl.way);
         }
 
         out << "|";
         //    epy=b1,b2,b3,b4,b5,b6,b7,b8,b9,b10,b11,b12
         //        b1=enable player controls
-        out << fromNum(evt.ctrls_enable);
+        out << PGE_NUM_OUT(evt.ctrls_enable);
         //        b2=drop
-        out << "," << fromNum(evt.ctrl_drop);
+        out << "," << PGE_NUM_OUT(evt.ctrl_drop);
         //        b3=alt run
-        out << "," << fromNum(evt.ctrl_altrun);
+        out << "," << PGE_NUM_OUT(evt.ctrl_altrun);
         //        b4=run
-        out << "," << fromNum(evt.ctrl_run);
+        out << "," << PGE_NUM_OUT(evt.ctrl_run);
         //        b5=jump
-        out << "," << fromNum(evt.ctrl_jump);
+        out << "," << PGE_NUM_OUT(evt.ctrl_jump);
         //        b6=alt jump
-        out << "," << fromNum(evt.ctrl_altjump);
+        out << "," << PGE_NUM_OUT(evt.ctrl_altjump);
         //        b7=up
-        out << "," << fromNum(evt.ctrl_up);
+        out << "," << PGE_NUM_OUT(evt.ctrl_up);
         //        b8=down
-        out << "," << fromNum(evt.ctrl_down);
+        out << "," << PGE_NUM_OUT(evt.ctrl_down);
         //        b9=left
-        out << "," << fromNum(evt.ctrl_left);
+        out << "," << PGE_NUM_OUT(evt.ctrl_left);
         //        b10=right
-        out << "," << fromNum(evt.ctrl_right);
+        out << "," << PGE_NUM_OUT(evt.ctrl_right);
         //        b11=start
-        out << "," << fromNum(evt.ctrl_start);
+        out << "," << PGE_NUM_OUT(evt.ctrl_start);
         //        b12=lock keyboard
-        out << "," << fromNum(evt.ctrl_lock_keyboard);
+        out << "," << PGE_NUM_OUT(evt.ctrl_lock_keyboard);
         out << "|";
         //    eps=esection/ebackground/emusic
         //        esection=es1:es2...esn
@@ -2087,9 +2148,9 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
 
             size_set_added = true;
             //                id=section id
-            out        << fromNum(set.id + 1);
+            out        << PGE_NUM_OUT(set.id + 1);
             //                stype=[0=don't change][1=default][2=custom]
-            out << "," << fromNum(section_pos);
+            out << "," << PGE_NUM_OUT(section_pos);
             //                x=left x coordinates for section [id][***urlencode!***][syntax]
             out << "," << expression_x;
             //                y=top y coordinates for section [id][***urlencode!***][syntax]
@@ -2099,7 +2160,7 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
             //                h=height for section [id][***urlencode!***][syntax]
             out << "," << expression_h;
             //                auto=enable autoscroll controls[0=false !0=tru
-            out << "," << fromNum((int)(set.autoscrol || legacyAutoScroll));
+            out << "," << PGE_NUM_OUT((int)(set.autoscrol || legacyAutoScroll));
             //                sx=move screen horizontal syntax[***urlencode!***][syntax]
             out << "," << expression_as_x;
             //                sy=move screen vertical syntax[***urlencode!***][syntax]
@@ -2128,11 +2189,11 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
 
             bg_set_added = true;
             //                id=section id
-            out        << fromNum(set.id + 1);
+            out        << PGE_NUM_OUT(set.id + 1);
             //                btype=[0=don't change][1=default][2=custom]
-            out << "," << fromNum(section_bg);
+            out << "," << PGE_NUM_OUT(section_bg);
             //                backgroundid=[when btype=2]custom background id
-            out << "," << fromNum(set.background_id >= 0 ? SMBX38A_mapBGID_To(set.background_id) : 0);
+            out << "," << PGE_NUM_OUT(set.background_id >= 0 ? SMBX38A_mapBGID_To(set.background_id) : 0);
         }
 
         out << "/";
@@ -2156,21 +2217,21 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
                 out << ":";
             muz_set_added = true;
             //                id=section id
-            out        << fromNum(set.id + 1);
+            out        << PGE_NUM_OUT(set.id + 1);
             //                mtype=[0=don't change][1=default][2=custom]
-            out << "," << fromNum(section_muz);
+            out << "," << PGE_NUM_OUT(section_muz);
             //                musicid=[when mtype=2]custom music id
-            out << "," << fromNum(set.music_id >= 0 ? set.music_id : 0);
+            out << "," << PGE_NUM_OUT(set.music_id >= 0 ? set.music_id : 0);
             //                customfile=[when mtype=3]custom music file name[***urlencode!***]
-            out << "," << PGE_URLENC(set.music_file);
+            out << "," << PGE_URLENC_OUT(set.music_file);
         }
 
         out << "|";
         //    eef=sound/endgame/ce1/ce2...cen
         //        sound=play sound number
-        out << fromNum(evt.sound_id);
+        out << PGE_NUM_OUT(evt.sound_id);
         //        endgame=[0=none][1=bowser defeat]
-        out << "/" << fromNum(evt.end_game);
+        out << "/" << PGE_NUM_OUT(evt.end_game);
 
         for(const auto &eff : evt.spawn_effects)
         {
@@ -2187,7 +2248,7 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
             SMBX38A_Num2Exp_URLEN(eff.speed_y, expression_sy);
             //        ce(n)=id,x,y,sx,sy,grv,fsp,life
             //            id=effect id
-            out        << fromNum(eff.id);
+            out        << PGE_NUM_OUT(eff.id);
             //            x=effect position x[***urlencode!***][syntax]
             out << "," << expression_x;
             //            y=effect position y[***urlencode!***][syntax]
@@ -2197,11 +2258,11 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
             //            sy=effect vertical speed[***urlencode!***][syntax]
             out << "," << expression_sy;
             //            grv=to decide whether the effects are affected by gravity[0=false !0=true]
-            out << "," << fromNum((int)eff.gravity);
+            out << "," << PGE_NUM_OUT((int)eff.gravity);
             //            fsp=frame speed of effect generated
-            out << "," << fromNum(eff.fps);
+            out << "," << PGE_NUM_OUT(eff.fps);
             //            life=effect existed over this time will be destroyed.
-            out << "," << fromNum(eff.max_life_time);
+            out << "," << PGE_NUM_OUT(eff.max_life_time);
         }
 
         out << "|";
@@ -2222,7 +2283,7 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
             //        cn(n)=id,x,y,sx,sy,sp
             if(j > 0) out << "/";
             //            id=npc id
-            out        << fromNum(snpc.id);
+            out        << PGE_NUM_OUT(snpc.id);
             //            x=npc position x[***urlencode!***][syntax]
             out << "," << expression_x;
             //            y=npc position y[***urlencode!***][syntax]
@@ -2232,7 +2293,7 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
             //            sy=npc vertical speed[***urlencode!***][syntax]
             out << "," << expression_sy;
             //            sp=advanced settings of generated npc
-            out << "," << fromNum(snpc.special);
+            out << "," << PGE_NUM_OUT(snpc.special);
         }
 
         out << "|";
@@ -2246,9 +2307,9 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
                 out << "/";
 
             //        vc(n)=name,newvalue
-            out        << PGE_URLENC(uvar.name);
+            out        << PGE_URLENC_OUT(uvar.name);
             //            name=variable name[***urlencode!***]
-            out << "," << PGE_URLENC(uvar.newval);
+            out << "," << PGE_URLENC_OUT(uvar.newval);
             //            newvalue=new value[***urlencode!***][syntax]
         }
 
@@ -2256,27 +2317,27 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         //    ene=nextevent/timer/apievent/scriptname
         //        nextevent=name,delay
         //            name=trigger event name[***urlencode!***]
-        out        << PGE_URLENC(evt.trigger);
+        out        << PGE_URLENC_OUT(evt.trigger);
         //            delay=trigger delay[1 frame]
         SMBX38A_RestoreOrigTime(evt.trigger_timer_orig, evt.trigger_timer, PGE_FileLibrary::TimeUnit::Decisecond);
-        out << "," << fromNum(evt.trigger_timer_orig);
+        out << "," << PGE_NUM_OUT(evt.trigger_timer_orig);
         //        timer=enable,count,interval,type,show
         //            enable=enable the game timer controlling[0=false !0=true]
-        out << "/" << fromNum((int)evt.timer_def.enable);
+        out << "/" << PGE_NUM_OUT((int)evt.timer_def.enable);
         //            count=set the time left of the game timer
-        out << "," << fromNum(evt.timer_def.count);
+        out << "," << PGE_NUM_OUT(evt.timer_def.count);
         //            interval=set the time count interval of the game timer
-        out << "," << fromNum(PGE_FileLibrary::TimeUnitsCVT(evt.timer_def.interval,
+        out << "," << PGE_NUM_OUT(PGE_FileLibrary::TimeUnitsCVT(evt.timer_def.interval,
                               PGE_FileLibrary::TimeUnit::Millisecond,
                               PGE_FileLibrary::TimeUnit::FrameOneOf65sec));
         //            type=to choose the way timer counts[0=counting down][1=counting up]
-        out << "," << fromNum(evt.timer_def.count_dir);
+        out << "," << PGE_NUM_OUT(evt.timer_def.count_dir);
         //            show=to choose whether the game timer is showed in hud[0=false !0=true]
-        out << "," << fromNum(evt.timer_def.show);
+        out << "," << PGE_NUM_OUT(evt.timer_def.show);
         //        apievent=the id of apievent
-        out << "/" << fromNum(evt.trigger_api_id);
+        out << "/" << PGE_NUM_OUT(evt.trigger_api_id);
         //        scriptname=script name[***urlencode!***]
-        out << "/" << PGE_URLENC(evt.trigger_script);
+        out << "/" << PGE_URLENC_OUT(evt.trigger_script);
         out << "\n";
     }
 
@@ -2286,11 +2347,11 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         //    V|name|value
         out << "V";
         //    name=variable name[***urlencode!***]
-        out << "|" << PGE_URLENC(var.name);
+        out << "|" << PGE_URLENC_OUT(var.name);
 
         //    value=initial value of the variable
         if(!SMBX64::IsSInt(var.value))//if is not signed integer, set value as zero
-            out << "|" << fromNum(0);
+            out << "|" << PGE_NUM_OUT(0);
         else
             out << "|" << var.value;
 
@@ -2304,7 +2365,7 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         out << "S";
         //    Su|name|scriptu
         //    name=name of script[***urlencode!***]
-        out << "|" << PGE_URLENC(script.name);
+        out << "|" << PGE_URLENC_OUT(script.name);
         //    script=script[***base64encode!***][utf-8]
         PGESTRING scriptT = script.script;
 
@@ -2340,7 +2401,7 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
             break;
         }
         //    id = object id
-        out << "|" << fromNum(is.id);
+        out << "|" << PGE_NUM_OUT(is.id);
 
         for(pge_size_t j = 0; j < is.data.size(); j++)
         {
@@ -2356,7 +2417,7 @@ bool FileFormats::WriteSMBX38ALvlFile(PGE_FileFormats_misc::TextOutput &out, Lev
         out << "CW";
         for(const LevelData::MusicOverrider &mo : FileData.sound_overrides)
         {
-            out << "|" << fromNum(mo.id) << "," << PGE_URLENC(mo.fileName);
+            out << "|" << PGE_NUM_OUT(mo.id) << "," << PGE_URLENC_OUT(mo.fileName);
         }
         out << "\n";
     }
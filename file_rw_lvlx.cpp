@@ -50,7 +50,7 @@ bool FileFormats::ReadExtendedLvlFileHeader(const PGESTRING &filePath, LevelData
     return ReadExtendedLvlFileHeaderT(inf, FileData);
 }
 
-bool FileFormats::ReadExtendedLvlFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData)
+bool FileFormats::ReadExtendedLvlFileHeaderRaw(const PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData)
 {
     CreateLevelHeader(FileData);
     FileData.meta.RecentFormat = LevelData::PGEX;
@@ -66,6 +66,22 @@ bool FileFormats::ReadExtendedLvlFileHeaderRaw(PGESTRING &rawdata, const PGESTRI
     return ReadExtendedLvlFileHeaderT(inf, FileData);
 }
 
+bool FileFormats::ReadExtendedLvlFileHeaderRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, LevelData &FileData)
+{
+    CreateLevelHeader(FileData);
+    FileData.meta.RecentFormat = LevelData::PGEX;
+    PGE_FileFormats_misc::ViewTextInput inf;
+
+    if(!inf.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ERROR_info = "Can't open file";
+        FileData.meta.ReadFileValid = false;
+        return false;
+    }
+
+    return ReadExtendedLvlFileHeaderT(inf, FileData);
+}
+
 bool FileFormats::ReadExtendedLvlFileHeaderT(PGE_FileFormats_misc::TextInput &inf, LevelData &FileData)
 {
     PGESTRING line;
@@ -143,9 +159,7 @@ bool FileFormats::ReadExtendedLvlFileHeaderT(PGE_FileFormats_misc::TextInput &in
             }
             else if(val[0] == "NO") //Overrides of player names
             {
-                if(PGEFile::IsStringArray(val[1]))
-                    FileData.player_names_overrides = PGEFile::X2STRArr(val[1]);
-                else
+                if(!PGEFile::X2STRArr(val[1], FileData.player_names_overrides))
                     goto bad_file;
             }
             else if(val[0] == "XTRA") //Extra settings
@@ -164,9 +178,7 @@ bool FileFormats::ReadExtendedLvlFileHeaderT(PGE_FileFormats_misc::TextInput &in
             }
             else if(val[0] == "MUS") // Level-wide list of external music files
             {
-                if(PGEFile::IsStringArray(val[1]))
-                    FileData.music_files = PGEFile::X2STRArr(val[1]);
-                else
+                if(!PGEFile::X2STRArr(val[1], FileData.music_files))
                     goto bad_file;
             }
         }
@@ -207,7 +219,7 @@ bool FileFormats::ReadExtendedLvlFileF(const PGESTRING &filePath, LevelData &Fil
     return ReadExtendedLvlFile(file, FileData);
 }
 
-bool FileFormats::ReadExtendedLvlFileRaw(PGESTRING &rawdata, const PGESTRING &filePath,  LevelData &FileData)
+bool FileFormats::ReadExtendedLvlFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath,  LevelData &FileData)
 {
     FileData.meta.ERROR_info.clear();
     PGE_FileFormats_misc::RawTextInput file;
@@ -224,6 +236,23 @@ bool FileFormats::ReadExtendedLvlFileRaw(PGESTRING &rawdata, const PGESTRING &fi
     return ReadExtendedLvlFile(file, FileData);
 }
 
+bool FileFormats::ReadExtendedLvlFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, LevelData &FileData)
+{
+    FileData.meta.ERROR_info.clear();
+    PGE_FileFormats_misc::ViewTextInput file;
+
+    if(!file.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ERROR_info = "Failed to open raw string for read";
+        FileData.meta.ERROR_linedata.clear();
+        FileData.meta.ERROR_linenum = -1;
+        FileData.meta.ReadFileValid = false;
+        return false;
+    }
+
+    return ReadExtendedLvlFile(file, FileData);
+}
+
 bool FileFormats::ReadExtendedLvlFile(PGE_FileFormats_misc::TextInput &in, LevelData &FileData)
 {
     PGESTRING errorString;
@@ -257,7 +286,7 @@ bool FileFormats::ReadExtendedLvlFile(PGE_FileFormats_misc::TextInput &in, Level
     LevelScript script;
     LevelItemSetup38A customcfg38A;
     ///////////////////////////////////////Begin file///////////////////////////////////////
-    PGEX_FileParseTree(in.readAll())
+    PGEX_FileParseStream(in)
     PGEX_FetchSection() //look sections
     {
         PGEX_FetchSection_begin()
@@ -910,12 +939,9 @@ bool FileFormats::ReadExtendedLvlFile(PGE_FileFormats_misc::TextInput &in, Level
                             {
                                 errorString = "Invalid Section Autoscroll path value type";
 
-                                if(PGEFile::IsIntArray(param[1]))
+                                PGELIST<long> arr;
+                                if(PGEFile::X2IntArr(param[1], arr))
                                 {
-                                    bool valid2 = false;
-                                    PGELIST<long> arr = PGEFile::X2IntArr(param[1], &valid2);
-                                    if(!valid2)
-                                        goto badfile;
                                     if(arr.size() % 4)
                                     {
                                         errorString = "Invalid Section Autoscroll path data contains non-multiple 4 entries";
@@ -1561,6 +1587,7 @@ bool FileFormats::ReadExtendedLvlFile(PGE_FileFormats_misc::TextInput &in, Level
     return true;
 
 badfile:    //If file format is not correct
+    PGEX_ValueError()
     FileData.meta.ERROR_info = errorString;
     FileData.meta.ERROR_linenum = in.getCurrentLineNumber();
     FileData.meta.ERROR_linedata = std::move(line);
@@ -1572,6 +1599,65 @@ badfile:    //If file format is not correct
 
 
 
+bool FileFormats::ReadExtendedLvlFile(PGE_FileFormats_misc::TextInput &in, LevelData &FileData, unsigned int threads)
+{
+    threads = PGEFile::parallelThreads(threads);
+    if(threads <= 1)
+        return ReadExtendedLvlFile(in, FileData);
+
+    PGESTRING filePath = in.getFilePath();
+    PGESTRING rawData = in.readAll();
+    PGE_FileFormats_misc::RawTextInput file;
+    PGELIST<PGEFile::PGEX_Chunk> chunks;
+    PGESTRINGList sections;
+    //Sections which items are not depend on other data
+    sections.push_back("BLOCK");
+    sections.push_back("BGO");
+    sections.push_back("NPC");
+    sections.push_back("PHYSICS");
+    sections.push_back("DOORS");
+
+    if(!PGEFile::splitToChunks(rawData, sections, threads, chunks) || (chunks.size() <= 2))
+    {
+        file.open(&rawData, filePath);
+        return ReadExtendedLvlFile(file, FileData);
+    }
+
+    std::vector<LevelData> parts(static_cast<size_t>(chunks.size()));
+    std::vector<char> valid(static_cast<size_t>(chunks.size()), 0);
+
+    PGEFile::runParallel(chunks.size(), threads, [&](pge_size_t i)
+    {
+        PGE_FileFormats_misc::RawTextInput chunk;
+        chunk.open(&chunks[i].data, filePath);
+        valid[i] = ReadExtendedLvlFile(chunk, i == 0 ? FileData : parts[i]);
+    });
+
+    for(size_t i = 0; i < valid.size(); i++)
+    {
+        if(!valid[i])
+        {
+            //Decode whole data again to report the error exactly like the serial reader does
+            file.open(&rawData, filePath);
+            return ReadExtendedLvlFile(file, FileData);
+        }
+    }
+
+    for(size_t i = 1; i < parts.size(); i++)
+    {
+        LevelData &part = parts[i];
+        PGEFile::mergeChunkItems(FileData.blocks, part.blocks, FileData.blocks_array_id);
+        PGEFile::mergeChunkItems(FileData.bgo, part.bgo, FileData.bgo_array_id);
+        PGEFile::mergeChunkItems(FileData.npc, part.npc, FileData.npc_array_id);
+        PGEFile::mergeChunkItems(FileData.physez, part.physez, FileData.physenv_array_id);
+        PGEFile::mergeChunkItems(FileData.doors, part.doors, FileData.doors_array_id);
+    }
+
+    return true;
+}
+
+
+
 //*********************************************************
 //****************WRITE FILE FORMAT************************
 //*********************************************************
@@ -1606,6 +1692,7 @@ bool FileFormats::WriteExtendedLvlFileRaw(LevelData &FileData, PGESTRING &rawdat
 
 bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, LevelData &FileData)
 {
+    PGEXWriter w(out);
     pge_size_t i;
     FileData.meta.RecentFormat = LevelData::PGEX;
     //Count placed stars on this level
@@ -1620,68 +1707,69 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
     //HEAD section
     {
         PGESTRING outHeader;
+        PGEXWriter outHeaderWriter(outHeader);
         if(!IsEmpty(FileData.LevelName))
-            outHeader += PGEFile::value("TL", PGEFile::WriteStr(FileData.LevelName)); // Level title
+            outHeaderWriter.writeStr("TL", FileData.LevelName); // Level title
 
         if(FileData.stars > 0)
-            outHeader += PGEFile::value("SZ", PGEFile::WriteInt(FileData.stars));      // Stars number
+            outHeaderWriter.writeInt("SZ", FileData.stars);      // Stars number
 
         if(!IsEmpty(FileData.open_level_on_fail))
-            outHeader += PGEFile::value("DL", PGEFile::WriteStr(FileData.open_level_on_fail)); // Open level on fail
+            outHeaderWriter.writeStr("DL", FileData.open_level_on_fail); // Open level on fail
 
         if(FileData.open_level_on_fail_warpID > 0)
-            outHeader += PGEFile::value("DE", PGEFile::WriteInt(FileData.open_level_on_fail_warpID));    // Open WarpID of level on fail
+            outHeaderWriter.writeInt("DE", FileData.open_level_on_fail_warpID);    // Open WarpID of level on fail
 
         if(!IsEmpty(FileData.player_names_overrides))
-            outHeader += PGEFile::value("NO", PGEFile::WriteStrArr(FileData.player_names_overrides));    // Overrides of player names
+            outHeaderWriter.writeStrArr("NO", FileData.player_names_overrides);    // Overrides of player names
 
         if(!IsEmpty(FileData.custom_params))
-            outHeader += PGEFile::value("XTRA", PGEFile::WriteStr(FileData.custom_params));
+            outHeaderWriter.writeStr("XTRA", FileData.custom_params);
 
         if(!IsEmpty(FileData.meta.configPackId))
-            outHeader += PGEFile::value("CPID", PGEFile::WriteStr(FileData.meta.configPackId));
+            outHeaderWriter.writeStr("CPID", FileData.meta.configPackId);
         
         if(FileData.quickDeathToggle > 0)
-            outHeader += PGEFile::value("QDTH", PGEFile::WriteInt(FileData.quickDeathToggle));
+            outHeaderWriter.writeInt("QDTH", FileData.quickDeathToggle);
 
         if(!IsEmpty(FileData.music_files))
-            outHeader += PGEFile::value("MUS", PGEFile::WriteStrArr(FileData.music_files));    // Overrides of player names
+            outHeaderWriter.writeStrArr("MUS", FileData.music_files);    // Overrides of player names
 
         if(!IsEmpty(outHeader))
-            out << "HEAD\n" << outHeader << "\n" << "HEAD_END\n";
+            w << "HEAD\n" << outHeader << "\n" << "HEAD_END\n";
     }
 
     //////////////////////////////////////MetaData////////////////////////////////////////////////
     //Bookmarks
     if(!FileData.metaData.bookmarks.empty())
     {
-        out << "META_BOOKMARKS\n";
+        w << "META_BOOKMARKS\n";
 
         for(const Bookmark &bm : FileData.metaData.bookmarks)
         {
             //Bookmark name
-            out << PGEFile::value("BM", PGEFile::WriteStr(bm.bookmarkName));
-            out << PGEFile::value("X", PGEFile::WriteRoundFloat(bm.x));
-            out << PGEFile::value("Y", PGEFile::WriteRoundFloat(bm.y));
-            out << "\n";
+            w.writeStr("BM", bm.bookmarkName);
+            w.writeRoundFloat("X", bm.x);
+            w.writeRoundFloat("Y", bm.y);
+            w << "\n";
         }
 
-        out << "META_BOOKMARKS_END\n";
+        w << "META_BOOKMARKS_END\n";
     }
 
     //Some System information
     if(FileData.metaData.crash.used)
     {
-        out << "META_SYS_CRASH\n";
-        out << PGEFile::value("UT", PGEFile::WriteBool(FileData.metaData.crash.untitled));
-        out << PGEFile::value("MD", PGEFile::WriteBool(FileData.metaData.crash.modifyed));
-        out << PGEFile::value("FF", PGEFile::WriteInt(FileData.metaData.crash.fmtID));
-        out << PGEFile::value("FV", PGEFile::WriteInt(FileData.metaData.crash.fmtVer));
-        out << PGEFile::value("N", PGEFile::WriteStr(FileData.metaData.crash.filename));
-        out << PGEFile::value("P", PGEFile::WriteStr(FileData.metaData.crash.path));
-        out << PGEFile::value("FP", PGEFile::WriteStr(FileData.metaData.crash.fullPath));
-        out << "\n";
-        out << "META_SYS_CRASH_END\n";
+        w << "META_SYS_CRASH\n";
+        w.writeBool("UT", FileData.metaData.crash.untitled);
+        w.writeBool("MD", FileData.metaData.crash.modifyed);
+        w.writeInt("FF", FileData.metaData.crash.fmtID);
+        w.writeInt("FV", FileData.metaData.crash.fmtVer);
+        w.writeStr("N", FileData.metaData.crash.filename);
+        w.writeStr("P", FileData.metaData.crash.path);
+        w.writeStr("FP", FileData.metaData.crash.fullPath);
+        w << "\n";
+        w << "META_SYS_CRASH_END\n";
     }
 
     //////////////////////////////////////MetaData///END//////////////////////////////////////////
@@ -1705,7 +1793,7 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
     //Don't store section data entry if no data to add
     if(totalSections > 0)
     {
-        out << "SECTION\n";
+        w << "SECTION\n";
 
         for(i = 0; i < FileData.sections.size(); i++)
         {
@@ -1719,53 +1807,53 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
             )
                 continue; //Skip unitialized sections
 
-            out << PGEFile::value("SC", PGEFile::WriteInt(section.id));  // Section ID
-            out << PGEFile::value("L", PGEFile::WriteInt(section.size_left));  // Left size
-            out << PGEFile::value("R", PGEFile::WriteInt(section.size_right));  // Right size
-            out << PGEFile::value("T", PGEFile::WriteInt(section.size_top));  // Top size
-            out << PGEFile::value("B", PGEFile::WriteInt(section.size_bottom));  // Bottom size
-            out << PGEFile::value("MZ", PGEFile::WriteInt(section.music_id));  // Music ID
-            out << PGEFile::value("MF", PGEFile::WriteStr(section.music_file));  // Music file
+            w.writeInt("SC", section.id);  // Section ID
+            w.writeInt("L", section.size_left);  // Left size
+            w.writeInt("R", section.size_right);  // Right size
+            w.writeInt("T", section.size_top);  // Top size
+            w.writeInt("B", section.size_bottom);  // Bottom size
+            w.writeInt("MZ", section.music_id);  // Music ID
+            w.writeStr("MF", section.music_file);  // Music file
             if(section.music_file_idx != -1)
-                out << PGEFile::value("ME", PGEFile::WriteInt(section.music_file_idx));  // Level-wide music entry
-            out << PGEFile::value("BG", PGEFile::WriteInt(section.background));  // Background ID
-            //out << PGEFile::value("BG", PGEFile::WriteStr(section.background_file));  // Background file
+                w.writeInt("ME", section.music_file_idx);  // Level-wide music entry
+            w.writeInt("BG", section.background);  // Background ID
+            //w.writeStr("BG", section.background_file);  // Background file
 
             if(section.lighting_value != LevelSection::LIGHTING_DISABLED)
-                out << PGEFile::value("LT", PGEFile::WriteInt(section.lighting_value));  // Lighting value
+                w.writeInt("LT", section.lighting_value);  // Lighting value
 
             if(section.wrap_h)
-                out << PGEFile::value("CS", PGEFile::WriteBool(section.wrap_h));  // Connect sides horizontally
+                w.writeBool("CS", section.wrap_h);  // Connect sides horizontally
 
             if(section.wrap_v)
-                out << PGEFile::value("CSV", PGEFile::WriteBool(section.wrap_v));  // Connect sides vertically
+                w.writeBool("CSV", section.wrap_v);  // Connect sides vertically
 
             if(section.OffScreenEn)
-                out << PGEFile::value("OE", PGEFile::WriteBool(section.OffScreenEn));  // Offscreen exit
+                w.writeBool("OE", section.OffScreenEn);  // Offscreen exit
 
             if(section.lock_left_scroll)
-                out << PGEFile::value("SR", PGEFile::WriteBool(section.lock_left_scroll));  // Right-way scroll only (No Turn-back)
+                w.writeBool("SR", section.lock_left_scroll);  // Right-way scroll only (No Turn-back)
 
             if(section.lock_right_scroll)
-                out << PGEFile::value("SL", PGEFile::WriteBool(section.lock_right_scroll));  // Left-way scroll only (No Turn-back)
+                w.writeBool("SL", section.lock_right_scroll);  // Left-way scroll only (No Turn-back)
 
             if(section.lock_up_scroll)
-                out << PGEFile::value("SD", PGEFile::WriteBool(section.lock_up_scroll));  // Down-way scroll only (No Turn-back)
+                w.writeBool("SD", section.lock_up_scroll);  // Down-way scroll only (No Turn-back)
 
             if(section.lock_down_scroll)
-                out << PGEFile::value("SU", PGEFile::WriteBool(section.lock_down_scroll));  // Up-way scroll only (No Turn-back)
+                w.writeBool("SU", section.lock_down_scroll);  // Up-way scroll only (No Turn-back)
 
             if(section.underwater)
-                out << PGEFile::value("UW", PGEFile::WriteBool(section.underwater));  // Underwater bit
+                w.writeBool("UW", section.underwater);  // Underwater bit
 
             if(!IsEmpty(section.custom_params))
-                out << PGEFile::value("XTRA", PGEFile::WriteStr(section.custom_params));
+                w.writeStr("XTRA", section.custom_params);
 
-            //out << PGEFile::value("SL", PGEFile::WriteBool(section.noforward));  // Left-way scroll only (No Turn-forward)
-            out << "\n";
+            //w.writeBool("SL", section.noforward);  // Left-way scroll only (No Turn-forward)
+            w << "\n";
         }
 
-        out << "SECTION_END\n";
+        w << "SECTION_END\n";
     }
 
     //STARTPOINT section
@@ -1782,7 +1870,7 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
     //Don't store section data entry if no data to add
     if(totalPlayerPoints > 0)
     {
-        out << "STARTPOINT\n";
+        w << "STARTPOINT\n";
 
         for(const PlayerPoint &pp : FileData.players)
         {
@@ -1790,252 +1878,252 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
                (pp.h == 0))
                 continue; //Skip empty points
 
-            out << PGEFile::value("ID", PGEFile::WriteInt(pp.id));  // Player ID
-            out << PGEFile::value("X", PGEFile::WriteInt(pp.x));  // Player X
-            out << PGEFile::value("Y", PGEFile::WriteInt(pp.y));  // Player Y
-            out << PGEFile::value("D", PGEFile::WriteInt(pp.direction));  // Direction -1 left, 1 right
-            out << "\n";
+            w.writeInt("ID", pp.id);  // Player ID
+            w.writeInt("X", pp.x);  // Player X
+            w.writeInt("Y", pp.y);  // Player Y
+            w.writeInt("D", pp.direction);  // Direction -1 left, 1 right
+            w << "\n";
         }
 
-        out << "STARTPOINT_END\n";
+        w << "STARTPOINT_END\n";
     }
 
     //BLOCK section
     if(!FileData.blocks.empty())
     {
-        out << "BLOCK\n";
+        w << "BLOCK\n";
         LevelBlock defBlock = CreateLvlBlock();
 
         for(const LevelBlock &blk : FileData.blocks)
         {
             //Type ID
-            out << PGEFile::value("ID", PGEFile::WriteInt(blk.id));  // Block ID
+            w.writeInt("ID", blk.id);  // Block ID
             //Position
-            out << PGEFile::value("X", PGEFile::WriteInt(blk.x));  // Block X
-            out << PGEFile::value("Y", PGEFile::WriteInt(blk.y));  // Block Y
+            w.writeInt("X", blk.x);  // Block X
+            w.writeInt("Y", blk.y);  // Block Y
             //Size
-            out << PGEFile::value("W", PGEFile::WriteInt(blk.w));  // Block Width (sizable only)
-            out << PGEFile::value("H", PGEFile::WriteInt(blk.h));  // Block Height (sizable only)
+            w.writeInt("W", blk.w);  // Block Width (sizable only)
+            w.writeInt("H", blk.h);  // Block Height (sizable only)
 
             if(blk.autoscale != defBlock.autoscale)
-                out << PGEFile::value("AS", PGEFile::WriteBool(blk.autoscale));// AutoScale
+                w.writeBool("AS", blk.autoscale);// AutoScale
 
             if(!IsEmpty(blk.gfx_name))
-                out << PGEFile::value("GXN", PGEFile::WriteStr(blk.gfx_name));// 38A GFX-Name
+                w.writeStr("GXN", blk.gfx_name);// 38A GFX-Name
             if(blk.gfx_dx > 0) //38A graphics extend x
-                out << PGEFile::value("GXX", PGEFile::WriteInt(blk.gfx_dx));  // 38A graphics extend x
+                w.writeInt("GXX", blk.gfx_dx);  // 38A graphics extend x
             if(blk.gfx_dy > 0) //38A graphics extend y
-                out << PGEFile::value("GXX", PGEFile::WriteInt(blk.gfx_dy));  // 38A graphics extend y
+                w.writeInt("GXX", blk.gfx_dy);  // 38A graphics extend y
 
             //Included NPC
             if(blk.npc_id != 0) //Write only if not zero
-                out << PGEFile::value("CN", PGEFile::WriteInt(blk.npc_id));  // Included NPC
+                w.writeInt("CN", blk.npc_id);  // Included NPC
             if(blk.npc_special_value != 0)
-                out << PGEFile::value("CS", PGEFile::WriteInt(blk.npc_special_value));  // Special value of included NPC
+                w.writeInt("CS", blk.npc_special_value);  // Special value of included NPC
 
             //Boolean flags
             if(blk.invisible)
-                out << PGEFile::value("IV", PGEFile::WriteBool(blk.invisible));  // Invisible
+                w.writeBool("IV", blk.invisible);  // Invisible
             if(blk.slippery)
-                out << PGEFile::value("SL", PGEFile::WriteBool(blk.slippery));  // Slippery flag
+                w.writeBool("SL", blk.slippery);  // Slippery flag
 
             if(blk.motion_ai_id != 0)
-                out << PGEFile::value("MA", PGEFile::WriteInt(blk.motion_ai_id));  // Motion AI type
+                w.writeInt("MA", blk.motion_ai_id);  // Motion AI type
 
             if(blk.special_data != 0)
-                out << PGEFile::value("S1", PGEFile::WriteInt(blk.special_data));  // Special value 1
+                w.writeInt("S1", blk.special_data);  // Special value 1
 
             if(blk.special_data2 != 0)
-                out << PGEFile::value("S2", PGEFile::WriteInt(blk.special_data2));  // Special value 2
+                w.writeInt("S2", blk.special_data2);  // Special value 2
 
             //Layer
             if(blk.layer != defBlock.layer) //Write only if not default
-                out << PGEFile::value("LR", PGEFile::WriteStr(blk.layer));  // Layer
+                w.writeStr("LR", blk.layer);  // Layer
             //Event Slots
             if(!IsEmpty(blk.event_destroy))
-                out << PGEFile::value("ED", PGEFile::WriteStr(blk.event_destroy));
+                w.writeStr("ED", blk.event_destroy);
             if(!IsEmpty(blk.event_hit))
-                out << PGEFile::value("EH", PGEFile::WriteStr(blk.event_hit));
+                w.writeStr("EH", blk.event_hit);
             if(!IsEmpty(blk.event_emptylayer))
-                out << PGEFile::value("EE", PGEFile::WriteStr(blk.event_emptylayer));
+                w.writeStr("EE", blk.event_emptylayer);
             if(!IsEmpty(blk.meta.custom_params))
-                out << PGEFile::value("XTRA", PGEFile::WriteStr(blk.meta.custom_params));
+                w.writeStr("XTRA", blk.meta.custom_params);
 
-            out << "\n";
+            w << "\n";
         }
 
-        out << "BLOCK_END\n";
+        w << "BLOCK_END\n";
     }
 
     //BGO section
     if(!FileData.bgo.empty())
     {
-        out << "BGO\n";
+        w << "BGO\n";
         LevelBGO defBGO = CreateLvlBgo();
 
         for(const LevelBGO &bgo : FileData.bgo)
         {
-            out << PGEFile::value("ID", PGEFile::WriteInt(bgo.id));  // BGO ID
+            w.writeInt("ID", bgo.id);  // BGO ID
             //Position
-            out << PGEFile::value("X", PGEFile::WriteInt(bgo.x));  // BGO X
-            out << PGEFile::value("Y", PGEFile::WriteInt(bgo.y));  // BGO Y
+            w.writeInt("X", bgo.x);  // BGO X
+            w.writeInt("Y", bgo.y);  // BGO Y
             if(bgo.gfx_dx > 0) //38A graphics extend x
-                out << PGEFile::value("GXX", PGEFile::WriteInt(bgo.gfx_dx));  // 38A graphics extend x
+                w.writeInt("GXX", bgo.gfx_dx);  // 38A graphics extend x
             if(bgo.gfx_dy > 0) //38A graphics extend y
-                out << PGEFile::value("GXX", PGEFile::WriteInt(bgo.gfx_dy));  // 38A graphics extend y
+                w.writeInt("GXX", bgo.gfx_dy);  // 38A graphics extend y
             if(fabs(bgo.z_offset - defBGO.z_offset) > DBL_EPSILON)
-                out << PGEFile::value("ZO", PGEFile::WriteFloat(bgo.z_offset));  // BGO Z-Offset
+                w.writeFloat("ZO", bgo.z_offset);  // BGO Z-Offset
             if(bgo.z_mode != defBGO.z_mode)
-                out << PGEFile::value("ZP", PGEFile::WriteInt(bgo.z_mode));  // BGO Z-Mode
+                w.writeInt("ZP", bgo.z_mode);  // BGO Z-Mode
             if(bgo.smbx64_sp != -1)
-                out << PGEFile::value("SP", PGEFile::WriteInt(bgo.smbx64_sp));  // BGO SMBX64 Sort Priority
+                w.writeInt("SP", bgo.smbx64_sp);  // BGO SMBX64 Sort Priority
             if(bgo.layer != defBGO.layer) //Write only if not default
-                out << PGEFile::value("LR", PGEFile::WriteStr(bgo.layer));  // Layer
+                w.writeStr("LR", bgo.layer);  // Layer
             if(!IsEmpty(bgo.meta.custom_params))
-                out << PGEFile::value("XTRA", PGEFile::WriteStr(bgo.meta.custom_params));
-            out << "\n";
+                w.writeStr("XTRA", bgo.meta.custom_params);
+            w << "\n";
         }
 
-        out << "BGO_END\n";
+        w << "BGO_END\n";
     }
 
     //NPC section
     if(!FileData.npc.empty())
     {
-        out << "NPC\n";
+        w << "NPC\n";
         LevelNPC defNPC = CreateLvlNpc();
 
         for(const LevelNPC &npc : FileData.npc)
         {
-            out << PGEFile::value("ID", PGEFile::WriteInt(npc.id));  // NPC ID
+            w.writeInt("ID", npc.id);  // NPC ID
             //Position
-            out << PGEFile::value("X", PGEFile::WriteInt(npc.x));  // NPC X
-            out << PGEFile::value("Y", PGEFile::WriteInt(npc.y));  // NPC Y
+            w.writeInt("X", npc.x);  // NPC X
+            w.writeInt("Y", npc.y);  // NPC Y
 
             if(!IsEmpty(npc.gfx_name))
-                out << PGEFile::value("GXN", PGEFile::WriteStr(npc.gfx_name));// 38A GFX-Name
+                w.writeStr("GXN", npc.gfx_name);// 38A GFX-Name
             if(npc.gfx_dx > 0) //38A graphics extend x
-                out << PGEFile::value("GXX", PGEFile::WriteInt(npc.gfx_dx));  // 38A graphics extend x
+                w.writeInt("GXX", npc.gfx_dx);  // 38A graphics extend x
             if(npc.gfx_dy > 0) //38A graphics extend y
-                out << PGEFile::value("GXX", PGEFile::WriteInt(npc.gfx_dy));  // 38A graphics extend y
+                w.writeInt("GXX", npc.gfx_dy);  // 38A graphics extend y
 
             if(npc.override_width >= 0) //38A graphics extend x
-                out << PGEFile::value("OW", PGEFile::WriteInt(npc.override_width));  // Width override
+                w.writeInt("OW", npc.override_width);  // Width override
             if(npc.override_height >= 0) //38A graphics extend y
-                out << PGEFile::value("OH", PGEFile::WriteInt(npc.override_height));  // Height override
+                w.writeInt("OH", npc.override_height);  // Height override
             if(npc.gfx_autoscale)
-                out << PGEFile::value("GAS", PGEFile::WriteBool(npc.gfx_autoscale));  // Autoscale GFX with overriden size
+                w.writeBool("GAS", npc.gfx_autoscale);  // Autoscale GFX with overriden size
 
             if(npc.wings_type != LevelNPC::WINGS38A_NONE)
-                out << PGEFile::value("WGT", PGEFile::WriteInt(npc.wings_type));  // 38A: Wings type
+                w.writeInt("WGT", npc.wings_type);  // 38A: Wings type
             if(npc.wings_style != LevelNPC::WINGS38A_STYLE_WINGS)
-                out << PGEFile::value("WGS", PGEFile::WriteInt(npc.wings_style));  // 38A: Wings style
+                w.writeInt("WGS", npc.wings_style);  // 38A: Wings style
 
-            out << PGEFile::value("D", PGEFile::WriteInt(npc.direct));  // NPC Direction
+            w.writeInt("D", npc.direct);  // NPC Direction
 
             if(npc.contents != 0)
-                out << PGEFile::value("CN", PGEFile::WriteInt(npc.contents));  // Contents of container
+                w.writeInt("CN", npc.contents);  // Contents of container
             if(npc.special_data != defNPC.special_data)
-                out << PGEFile::value("S1", PGEFile::WriteInt(npc.special_data));  // Special value 1
+                w.writeInt("S1", npc.special_data);  // Special value 1
             if(npc.special_data2 != defNPC.special_data2)
-                out << PGEFile::value("S2", PGEFile::WriteInt(npc.special_data2));  // Special value 2
+                w.writeInt("S2", npc.special_data2);  // Special value 2
 
             if(npc.generator)
             {
-                out << PGEFile::value("GE", PGEFile::WriteBool(npc.generator));  // NPC Generator
-                out << PGEFile::value("GT", PGEFile::WriteInt(npc.generator_type));  // Generator type
-                out << PGEFile::value("GD", PGEFile::WriteInt(npc.generator_direct));  // Generator direct
-                out << PGEFile::value("GM", PGEFile::WriteInt(npc.generator_period));  // Generator time
+                w.writeBool("GE", npc.generator);  // NPC Generator
+                w.writeInt("GT", npc.generator_type);  // Generator type
+                w.writeInt("GD", npc.generator_direct);  // Generator direct
+                w.writeInt("GM", npc.generator_period);  // Generator time
 
                 if(npc.generator_direct == 0)
                 {
-                    out << PGEFile::value("GA", PGEFile::WriteFloat(npc.generator_custom_angle));  // Generator custom angle
-                    out << PGEFile::value("GB", PGEFile::WriteInt(npc.generator_branches));  // Generator branches
-                    out << PGEFile::value("GR", PGEFile::WriteFloat(npc.generator_angle_range));  // Generator angle range
-                    out << PGEFile::value("GS", PGEFile::WriteFloat(npc.generator_initial_speed));  // Generator initial speed
+                    w.writeFloat("GA", npc.generator_custom_angle);  // Generator custom angle
+                    w.writeInt("GB", npc.generator_branches);  // Generator branches
+                    w.writeFloat("GR", npc.generator_angle_range);  // Generator angle range
+                    w.writeFloat("GS", npc.generator_initial_speed);  // Generator initial speed
                 }
             }
 
             if(!IsEmpty(npc.msg))
-                out << PGEFile::value("MG", PGEFile::WriteStr(npc.msg));  // Message
+                w.writeStr("MG", npc.msg);  // Message
             if(npc.friendly)
-                out << PGEFile::value("FD", PGEFile::WriteBool(npc.friendly));  // Friendly
+                w.writeBool("FD", npc.friendly);  // Friendly
             if(npc.nomove)
-                out << PGEFile::value("NM", PGEFile::WriteBool(npc.nomove));  // Idle
+                w.writeBool("NM", npc.nomove);  // Idle
             if(npc.is_boss)
-                out << PGEFile::value("BS", PGEFile::WriteBool(npc.is_boss));  // Set as boss
+                w.writeBool("BS", npc.is_boss);  // Set as boss
             if(npc.layer != defNPC.layer) //Write only if not default
-                out << PGEFile::value("LR", PGEFile::WriteStr(npc.layer));  // Layer
+                w.writeStr("LR", npc.layer);  // Layer
             if(!IsEmpty(npc.attach_layer))
-                out << PGEFile::value("LA", PGEFile::WriteStr(npc.attach_layer));  // Attach layer
+                w.writeStr("LA", npc.attach_layer);  // Attach layer
             if(!IsEmpty(npc.send_id_to_variable))
-                out << PGEFile::value("SV", PGEFile::WriteStr(npc.send_id_to_variable)); //Send ID to variable
+                w.writeStr("SV", npc.send_id_to_variable); //Send ID to variable
 
             //Event slots
             if(!IsEmpty(npc.event_activate))
-                out << PGEFile::value("EA", PGEFile::WriteStr(npc.event_activate));
+                w.writeStr("EA", npc.event_activate);
             if(!IsEmpty(npc.event_die))
-                out << PGEFile::value("ED", PGEFile::WriteStr(npc.event_die));
+                w.writeStr("ED", npc.event_die);
             if(!IsEmpty(npc.event_talk))
-                out << PGEFile::value("ET", PGEFile::WriteStr(npc.event_talk));
+                w.writeStr("ET", npc.event_talk);
             if(!IsEmpty(npc.event_emptylayer))
-                out << PGEFile::value("EE", PGEFile::WriteStr(npc.event_emptylayer));
+                w.writeStr("EE", npc.event_emptylayer);
             if(!IsEmpty(npc.event_grab))
-                out << PGEFile::value("EG", PGEFile::WriteStr(npc.event_grab));
+                w.writeStr("EG", npc.event_grab);
             if(!IsEmpty(npc.event_touch))
-                out << PGEFile::value("EO", PGEFile::WriteStr(npc.event_touch));
+                w.writeStr("EO", npc.event_touch);
             if(!IsEmpty(npc.event_nextframe))
-                out << PGEFile::value("EF", PGEFile::WriteStr(npc.event_nextframe));
+                w.writeStr("EF", npc.event_nextframe);
             if(!IsEmpty(npc.meta.custom_params))
-                out << PGEFile::value("XTRA", PGEFile::WriteStr(npc.meta.custom_params));
+                w.writeStr("XTRA", npc.meta.custom_params);
 
-            out << "\n";
+            w << "\n";
         }
 
-        out << "NPC_END\n";
+        w << "NPC_END\n";
     }
 
     //PHYSICS section
     if(!FileData.physez.empty())
     {
-        out << "PHYSICS\n";
+        w << "PHYSICS\n";
         LevelPhysEnv defPhys = CreateLvlPhysEnv();
 
         for(const LevelPhysEnv &physEnv : FileData.physez)
         {
-            out << PGEFile::value("ET", PGEFile::WriteInt(physEnv.env_type));
+            w.writeInt("ET", physEnv.env_type);
             //Position
-            out << PGEFile::value("X", PGEFile::WriteInt(physEnv.x));  // Physic Env X
-            out << PGEFile::value("Y", PGEFile::WriteInt(physEnv.y));  // Physic Env Y
+            w.writeInt("X", physEnv.x);  // Physic Env X
+            w.writeInt("Y", physEnv.y);  // Physic Env Y
             //Size
-            out << PGEFile::value("W", PGEFile::WriteInt(physEnv.w));  // Physic Env Width
-            out << PGEFile::value("H", PGEFile::WriteInt(physEnv.h));  // Physic Env Height
+            w.writeInt("W", physEnv.w);  // Physic Env Width
+            w.writeInt("H", physEnv.h);  // Physic Env Height
 
             if(physEnv.env_type == LevelPhysEnv::ENV_CUSTOM_LIQUID)
-                out << PGEFile::value("FR", PGEFile::WriteFloat(physEnv.friction)); //Friction
+                w.writeFloat("FR", physEnv.friction); //Friction
             if(physEnv.accel_direct >= 0.0)
-                out << PGEFile::value("AD", PGEFile::WriteFloat(physEnv.accel_direct)); //Acceleration direction
+                w.writeFloat("AD", physEnv.accel_direct); //Acceleration direction
             if(!PGE_floatEqual(physEnv.accel, 0.0, 5))
-                out << PGEFile::value("AC", PGEFile::WriteFloat(physEnv.accel)); //Acceleration
+                w.writeFloat("AC", physEnv.accel); //Acceleration
             if(!PGE_floatEqual(physEnv.max_velocity, 0.0, 5))
-                out << PGEFile::value("MV", PGEFile::WriteFloat(physEnv.max_velocity)); //Max-velocity
+                w.writeFloat("MV", physEnv.max_velocity); //Max-velocity
             if(physEnv.layer != defPhys.layer) //Write only if not default
-                out << PGEFile::value("LR", PGEFile::WriteStr(physEnv.layer));  // Layer
+                w.writeStr("LR", physEnv.layer);  // Layer
             if(!IsEmpty(physEnv.touch_event))
-                out << PGEFile::value("EO", PGEFile::WriteStr(physEnv.touch_event));  // Touch event slot
+                w.writeStr("EO", physEnv.touch_event);  // Touch event slot
             if(!IsEmpty(physEnv.meta.custom_params))
-                out << PGEFile::value("XTRA", PGEFile::WriteStr(physEnv.meta.custom_params));
+                w.writeStr("XTRA", physEnv.meta.custom_params);
 
-            out << "\n";
+            w << "\n";
         }
 
-        out << "PHYSICS_END\n";
+        w << "PHYSICS_END\n";
     }
 
     //DOORS section
     if(!FileData.doors.empty())
     {
-        out << "DOORS\n";
+        w << "DOORS\n";
         LevelDoor defDoor = CreateLvlWarp();
 
         for(const LevelDoor &warp : FileData.doors)
@@ -2049,105 +2137,105 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
             //Entrance
             if(warp.isSetIn)
             {
-                out << PGEFile::value("IX", PGEFile::WriteInt(warp.ix));  // Warp Input X
-                out << PGEFile::value("IY", PGEFile::WriteInt(warp.iy));  // Warp Input Y
+                w.writeInt("IX", warp.ix);  // Warp Input X
+                w.writeInt("IY", warp.iy);  // Warp Input Y
             }
 
             if(warp.isSetOut)
             {
-                out << PGEFile::value("OX", PGEFile::WriteInt(warp.ox));  // Warp Output X
-                out << PGEFile::value("OY", PGEFile::WriteInt(warp.oy));  // Warp Output Y
+                w.writeInt("OX", warp.ox);  // Warp Output X
+                w.writeInt("OY", warp.oy);  // Warp Output Y
             }
 
             if(warp.length_i != 32) //-V112
-                out << PGEFile::value("IL", PGEFile::WriteInt(warp.length_i));  //Length of entrance
+                w.writeInt("IL", warp.length_i);  //Length of entrance
 
             if(warp.length_o != 32) //-V112
-                out << PGEFile::value("OL", PGEFile::WriteInt(warp.length_o));  //Length of exit
+                w.writeInt("OL", warp.length_o);  //Length of exit
 
-            out << PGEFile::value("DT", PGEFile::WriteInt(warp.type));  // Warp type
-            out << PGEFile::value("ID", PGEFile::WriteInt(warp.idirect));  // Warp Input direction
-            out << PGEFile::value("OD", PGEFile::WriteInt(warp.odirect));  // Warp Outpu direction
+            w.writeInt("DT", warp.type);  // Warp type
+            w.writeInt("ID", warp.idirect);  // Warp Input direction
+            w.writeInt("OD", warp.odirect);  // Warp Outpu direction
 
             if(warp.world_x != -1 && warp.world_y != -1)
             {
-                out << PGEFile::value("WX", PGEFile::WriteInt(warp.world_x));  // World X
-                out << PGEFile::value("WY", PGEFile::WriteInt(warp.world_y));  // World Y
+                w.writeInt("WX", warp.world_x);  // World X
+                w.writeInt("WY", warp.world_y);  // World Y
             }
 
             if(!IsEmpty(warp.lname))
             {
-                out << PGEFile::value("LF", PGEFile::WriteStr(warp.lname));  // Warp to level file
-                out << PGEFile::value("LI", PGEFile::WriteInt(warp.warpto));  // Warp arrayID
+                w.writeStr("LF", warp.lname);  // Warp to level file
+                w.writeInt("LI", warp.warpto);  // Warp arrayID
             }
 
             if(warp.lvl_i)
-                out << PGEFile::value("ET", PGEFile::WriteBool(warp.lvl_i));  // Level Entance
+                w.writeBool("ET", warp.lvl_i);  // Level Entance
             if(warp.lvl_o)
-                out << PGEFile::value("EX", PGEFile::WriteBool(warp.lvl_o));  // Level Exit
+                w.writeBool("EX", warp.lvl_o);  // Level Exit
             if(warp.stars > 0)
-                out << PGEFile::value("SL", PGEFile::WriteInt(warp.stars));  // Need a stars
+                w.writeInt("SL", warp.stars);  // Need a stars
             if(!IsEmpty(warp.stars_msg))
-                out << PGEFile::value("SM", PGEFile::WriteStr(warp.stars_msg));  // Message for start requirement
+                w.writeStr("SM", warp.stars_msg);  // Message for start requirement
             if(warp.star_num_hide)
-                out << PGEFile::value("SH", PGEFile::WriteBool(warp.star_num_hide));  // Don't show number of stars
+                w.writeBool("SH", warp.star_num_hide);  // Don't show number of stars
             if(warp.novehicles)
-                out << PGEFile::value("NV", PGEFile::WriteBool(warp.novehicles));  // Deny Vehicles
+                w.writeBool("NV", warp.novehicles);  // Deny Vehicles
             if(warp.allownpc)
-                out << PGEFile::value("AI", PGEFile::WriteBool(warp.allownpc));  // Allow Items
+                w.writeBool("AI", warp.allownpc);  // Allow Items
             if(warp.locked)
-                out << PGEFile::value("LC", PGEFile::WriteBool(warp.locked));  // Locked door
+                w.writeBool("LC", warp.locked);  // Locked door
             if(warp.need_a_bomb)
-                out << PGEFile::value("LB", PGEFile::WriteBool(warp.need_a_bomb));  //Need a bomb to open door
+                w.writeBool("LB", warp.need_a_bomb);  //Need a bomb to open door
             if(warp.hide_entering_scene)
-                out << PGEFile::value("HS", PGEFile::WriteBool(warp.hide_entering_scene));   //Hide entrance scene
+                w.writeBool("HS", warp.hide_entering_scene);   //Hide entrance scene
             if(warp.allownpc_interlevel)
-                out << PGEFile::value("AL", PGEFile::WriteBool(warp.allownpc_interlevel));   //Allow Items inter-level
+                w.writeBool("AL", warp.allownpc_interlevel);   //Allow Items inter-level
             if(warp.special_state_required)
-                out << PGEFile::value("SR", PGEFile::WriteBool(warp.special_state_required));//Special state required
+                w.writeBool("SR", warp.special_state_required);//Special state required
             if(warp.stood_state_required)
-                out << PGEFile::value("STR", PGEFile::WriteBool(warp.stood_state_required));//Stood state required
+                w.writeBool("STR", warp.stood_state_required);//Stood state required
             if(warp.transition_effect != LevelDoor::TRANSIT_NONE)
-                out << PGEFile::value("TE", PGEFile::WriteInt(warp.transition_effect));//Transition effect
+                w.writeInt("TE", warp.transition_effect);//Transition effect
             if(warp.cannon_exit)
             {
-                out << PGEFile::value("PT", PGEFile::WriteBool(warp.cannon_exit));//cannon exit
-                out << PGEFile::value("PS", PGEFile::WriteFloat(warp.cannon_exit_speed));//cannon exit projectile speed
+                w.writeBool("PT", warp.cannon_exit);//cannon exit
+                w.writeFloat("PS", warp.cannon_exit_speed);//cannon exit projectile speed
             }
             if(warp.layer != defDoor.layer) //Write only if not default
-                out << PGEFile::value("LR", PGEFile::WriteStr(warp.layer));  // Layer
+                w.writeStr("LR", warp.layer);  // Layer
             if(!IsEmpty(warp.event_enter)) //Write only if not default
-                out << PGEFile::value("EE", PGEFile::WriteStr(warp.event_enter));  // On-Enter event
+                w.writeStr("EE", warp.event_enter);  // On-Enter event
             if(warp.two_way)
-                out << PGEFile::value("TW", PGEFile::WriteBool(warp.two_way)); //Two-way warp
+                w.writeBool("TW", warp.two_way); //Two-way warp
             if(!IsEmpty(warp.meta.custom_params))
-                out << PGEFile::value("XTRA", PGEFile::WriteStr(warp.meta.custom_params));
+                w.writeStr("XTRA", warp.meta.custom_params);
 
-            out << "\n";
+            w << "\n";
         }
 
-        out << "DOORS_END\n";
+        w << "DOORS_END\n";
     }
 
     //LAYERS section
     if(!FileData.layers.empty())
     {
-        out << "LAYERS\n";
+        w << "LAYERS\n";
 
         for(const LevelLayer &layer : FileData.layers)
         {
-            out << PGEFile::value("LR", PGEFile::WriteStr(layer.name));  // Layer name
+            w.writeStr("LR", layer.name);  // Layer name
 
             if(layer.hidden)
-                out << PGEFile::value("HD", PGEFile::WriteBool(layer.hidden));  // Hidden
+                w.writeBool("HD", layer.hidden);  // Hidden
 
             if(layer.locked)
-                out << PGEFile::value("LC", PGEFile::WriteBool(layer.locked));  // Locked
+                w.writeBool("LC", layer.locked);  // Locked
 
-            out << "\n";
+            w << "\n";
         }
 
-        out << "LAYERS_END\n";
+        w << "LAYERS_END\n";
     }
 
     //EVENTS section (action styled)
@@ -2156,30 +2244,30 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
     //EVENTS_CLASSIC (SMBX-Styled events)
     if(!FileData.events.empty())
     {
-        out << "EVENTS_CLASSIC\n";
+        w << "EVENTS_CLASSIC\n";
         bool addArray = false;
 
         for(const LevelSMBX64Event &event : FileData.events)
         {
-            out << PGEFile::value("ET", PGEFile::WriteStr(event.name));  // Event name
+            w.writeStr("ET", event.name);  // Event name
 
             if(!IsEmpty(event.msg))
-                out << PGEFile::value("MG", PGEFile::WriteStr(event.msg));  // Show Message
+                w.writeStr("MG", event.msg);  // Show Message
 
             if(event.sound_id != 0)
-                out << PGEFile::value("SD", PGEFile::WriteInt(event.sound_id));  // Play Sound ID
+                w.writeInt("SD", event.sound_id);  // Play Sound ID
 
             if(event.end_game != 0)
-                out << PGEFile::value("EG", PGEFile::WriteInt(event.end_game));  // End game
+                w.writeInt("EG", event.end_game);  // End game
 
             if(!event.layers_hide.empty())
-                out << PGEFile::value("LH", PGEFile::WriteStrArr(event.layers_hide));  // Hide Layers
+                w.writeStrArr("LH", event.layers_hide);  // Hide Layers
 
             if(!event.layers_show.empty())
-                out << PGEFile::value("LS", PGEFile::WriteStrArr(event.layers_show));  // Show Layers
+                w.writeStrArr("LS", event.layers_show);  // Show Layers
 
             if(!event.layers_toggle.empty())
-                out << PGEFile::value("LT", PGEFile::WriteStrArr(event.layers_toggle));  // Toggle Layers
+                w.writeStrArr("LT", event.layers_toggle);  // Toggle Layers
 
             /*
             PGESTRINGList musicSets;
@@ -2191,7 +2279,7 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
             for(int tt=0; tt<(signed)musicSets.size(); tt++)
             { if(musicSets[tt]!="-1") addArray=true; }
 
-            if(addArray) out << PGEFile::value("SM", PGEFile::WriteStrArr(musicSets));  // Change section's musics
+            if(addArray) w.writeStrArr("SM", musicSets);  // Change section's musics
 
 
             addArray=false;
@@ -2202,7 +2290,7 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
             for(int tt=0; tt<(signed)musicSets.size(); tt++)
             { if(!musicSets[tt].PGESTRINGisEmpty()) addArray=true; }
 
-            if(addArray) out << PGEFile::value("SMF", PGEFile::WriteStrArr(musicSets));  // Change section's music files
+            if(addArray) w.writeStrArr("SMF", musicSets);  // Change section's music files
 
 
             PGESTRINGList backSets;
@@ -2214,7 +2302,7 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
             for(int tt=0; tt<(signed)backSets.size(); tt++)
             { if(backSets[tt]!="-1") addArray=true; }
 
-            if(addArray) out << PGEFile::value("SB", PGEFile::WriteStrArr(backSets));  // Change section's backgrounds
+            if(addArray) w.writeStrArr("SB", backSets);  // Change section's backgrounds
 
 
             PGESTRINGList sizeSets;
@@ -2231,7 +2319,7 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
                 sizeSets.push_back(sizeSect);
             }
             if(addArray)
-                out << PGEFile::value("SS", PGEFile::WriteStrArr(sizeSets));// Change section's sizes
+                w.writeStrArr("SS", sizeSets);// Change section's sizes
             */
             PGESTRINGList sectionSettingsSets;
 
@@ -2239,92 +2327,93 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
             {
                 bool hasParams = false;
                 PGESTRING sectionSettings;
+                PGEXWriter sectionSettingsWriter(sectionSettings);
                 const LevelEvent_Sets &x = set;
-                sectionSettings += PGEFile::value("ID", PGEFile::WriteInt(x.id));
+                sectionSettingsWriter.writeInt("ID", x.id);
                 bool customSize = (x.position_left != LevelEvent_Sets::LESet_Nothing) &&
                                   (x.position_left != LevelEvent_Sets::LESet_ResetDefault);
 
                 if(x.position_left != -1)
                 {
-                    sectionSettings += PGEFile::value("SL", PGEFile::WriteInt(x.position_left));
+                    sectionSettingsWriter.writeInt("SL", x.position_left);
                     hasParams = true;
                 }
 
                 if(customSize && (x.position_top != 0))
                 {
-                    sectionSettings += PGEFile::value("ST", PGEFile::WriteInt(x.position_top));
+                    sectionSettingsWriter.writeInt("ST", x.position_top);
                     hasParams = true;
                 }
 
                 if(customSize && (x.position_bottom != 0))
                 {
-                    sectionSettings += PGEFile::value("SB", PGEFile::WriteInt(x.position_bottom));
+                    sectionSettingsWriter.writeInt("SB", x.position_bottom);
                     hasParams = true;
                 }
 
                 if(customSize && (x.position_right != 0))
                 {
-                    sectionSettings += PGEFile::value("SR", PGEFile::WriteInt(x.position_right));
+                    sectionSettingsWriter.writeInt("SR", x.position_right);
                     hasParams = true;
                 }
 
                 if(!IsEmpty(x.expression_pos_x) && (x.expression_pos_x != "0"))
                 {
-                    sectionSettings += PGEFile::value("SXX", PGEFile::WriteStr(x.expression_pos_x));
+                    sectionSettingsWriter.writeStr("SXX", x.expression_pos_x);
                     hasParams = true;
                 }
 
                 if(!IsEmpty(x.expression_pos_y) && (x.expression_pos_y != "0"))
                 {
-                    sectionSettings += PGEFile::value("SYX", PGEFile::WriteStr(x.expression_pos_y));
+                    sectionSettingsWriter.writeStr("SYX", x.expression_pos_y);
                     hasParams = true;
                 }
 
                 if(!IsEmpty(x.expression_pos_w) && (x.expression_pos_w != "0"))
                 {
-                    sectionSettings += PGEFile::value("SWX", PGEFile::WriteStr(x.expression_pos_w));
+                    sectionSettingsWriter.writeStr("SWX", x.expression_pos_w);
                     hasParams = true;
                 }
 
                 if(!IsEmpty(x.expression_pos_h) && (x.expression_pos_h != "0"))
                 {
-                    sectionSettings += PGEFile::value("SHX", PGEFile::WriteStr(x.expression_pos_h));
+                    sectionSettingsWriter.writeStr("SHX", x.expression_pos_h);
                     hasParams = true;
                 }
 
                 if(x.music_id != LevelEvent_Sets::LESet_Nothing)
                 {
-                    sectionSettings += PGEFile::value("MI", PGEFile::WriteInt(x.music_id));
+                    sectionSettingsWriter.writeInt("MI", x.music_id);
                     hasParams = true;
                 }
 
                 if(!IsEmpty(x.music_file))
                 {
-                    sectionSettings += PGEFile::value("MF", PGEFile::WriteStr(x.music_file));
+                    sectionSettingsWriter.writeStr("MF", x.music_file);
                     hasParams = true;
                 }
 
                 if(x.music_file_idx != LevelEvent_Sets::LESet_Nothing)
                 {
-                    sectionSettings += PGEFile::value("ME", PGEFile::WriteInt(x.music_file_idx));
+                    sectionSettingsWriter.writeInt("ME", x.music_file_idx);
                     hasParams = true;
                 }
 
                 if(x.background_id != LevelEvent_Sets::LESet_Nothing)
                 {
-                    sectionSettings += PGEFile::value("BG", PGEFile::WriteInt(x.background_id));
+                    sectionSettingsWriter.writeInt("BG", x.background_id);
                     hasParams = true;
                 }
 
                 if(x.autoscrol)
                 {
-                    sectionSettings += PGEFile::value("AS", PGEFile::WriteBool(x.autoscrol));
+                    sectionSettingsWriter.writeBool("AS", x.autoscrol);
                     hasParams = true;
                 }
 
                 if(x.autoscroll_style != LevelEvent_Sets::AUTOSCROLL_SIMPLE)
                 {
-                    sectionSettings += PGEFile::value("AST", PGEFile::WriteInt(x.autoscroll_style));
+                    sectionSettingsWriter.writeInt("AST", x.autoscroll_style);
                     hasParams = true;
                 }
 
@@ -2338,31 +2427,31 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
                         arr.push_back(ap.type);
                         arr.push_back(ap.speed);
                     }
-                    sectionSettings += PGEFile::value("ASP", PGEFile::WriteIntArr(arr));
+                    sectionSettingsWriter.writeIntArr("ASP", arr);
                     hasParams = true;
                 }
 
                 if(!PGE_floatEqual(x.autoscrol_x, 0.0f, 5))
                 {
-                    sectionSettings += PGEFile::value("AX", PGEFile::WriteFloat(x.autoscrol_x));
+                    sectionSettingsWriter.writeFloat("AX", x.autoscrol_x);
                     hasParams = true;
                 }
 
                 if(!PGE_floatEqual(x.autoscrol_y, 0.0f, 5))
                 {
-                    sectionSettings += PGEFile::value("AY", PGEFile::WriteFloat(x.autoscrol_y));
+                    sectionSettingsWriter.writeFloat("AY", x.autoscrol_y);
                     hasParams = true;
                 }
 
                 if(!IsEmpty(x.expression_autoscrool_x) && (x.expression_autoscrool_x != "0"))
                 {
-                    sectionSettings += PGEFile::value("AXX", PGEFile::WriteStr(x.expression_autoscrool_x));
+                    sectionSettingsWriter.writeStr("AXX", x.expression_autoscrool_x);
                     hasParams = true;
                 }
 
                 if(!IsEmpty(x.expression_autoscrool_y) && (x.expression_autoscrool_y != "0"))
                 {
-                    sectionSettings += PGEFile::value("AYX", PGEFile::WriteStr(x.expression_autoscrool_y));
+                    sectionSettingsWriter.writeStr("AYX", x.expression_autoscrool_y);
                     hasParams = true;
                 }
 
@@ -2371,30 +2460,30 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
             }
 
             if(!sectionSettingsSets.empty())
-                out << PGEFile::value("SSS", PGEFile::WriteStrArr(sectionSettingsSets));//Change section's settings
+                w.writeStrArr("SSS", sectionSettingsSets);//Change section's settings
 
             if(!IsEmpty(event.trigger))
             {
-                out << PGEFile::value("TE", PGEFile::WriteStr(event.trigger)); // Trigger Event
+                w.writeStr("TE", event.trigger); // Trigger Event
 
                 if(event.trigger_timer > 0)
-                    out << PGEFile::value("TD", PGEFile::WriteInt(event.trigger_timer)); // Trigger delay
+                    w.writeInt("TD", event.trigger_timer); // Trigger delay
             }
 
             if(!IsEmpty(event.trigger_script))
-                out << PGEFile::value("TSCR", PGEFile::WriteStr(event.trigger_script));
+                w.writeStr("TSCR", event.trigger_script);
 
             if(event.trigger_api_id != 0)
-                out << PGEFile::value("TAPI", PGEFile::WriteInt(event.trigger_api_id));
+                w.writeInt("TAPI", event.trigger_api_id);
 
             if(event.nosmoke)
-                out << PGEFile::value("DS", PGEFile::WriteBool(event.nosmoke)); // Disable Smoke
+                w.writeBool("DS", event.nosmoke); // Disable Smoke
 
             if(event.autostart > 0)
-                out << PGEFile::value("AU", PGEFile::WriteInt(event.autostart)); // Autostart event
+                w.writeInt("AU", event.autostart); // Autostart event
 
             if(!IsEmpty(event.autostart_condition))
-                out << PGEFile::value("AUC", PGEFile::WriteStr(event.autostart_condition)); // Autostart condition event
+                w.writeStr("AUC", event.autostart_condition); // Autostart condition event
 
             PGELIST<bool > controls;
             controls.push_back(event.ctrl_up);
@@ -2417,13 +2506,13 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
                     addArray = true;
             }
 
-            if(addArray) out << PGEFile::value("PC", PGEFile::WriteBoolArr(controls)); // Create boolean array
+            if(addArray) w.writeBoolArr("PC", controls); // Create boolean array
 
             if(!IsEmpty(event.movelayer))
             {
-                out << PGEFile::value("ML", PGEFile::WriteStr(event.movelayer)); // Move layer
-                out << PGEFile::value("MX", PGEFile::WriteFloat(event.layer_speed_x)); // Move layer X
-                out << PGEFile::value("MY", PGEFile::WriteFloat(event.layer_speed_y)); // Move layer Y
+                w.writeStr("ML", event.movelayer); // Move layer
+                w.writeFloat("MX", event.layer_speed_x); // Move layer X
+                w.writeFloat("MY", event.layer_speed_y); // Move layer Y
             }
 
             if(!event.moving_layers.empty())
@@ -2433,31 +2522,32 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
                 for(const auto &mvl : event.moving_layers)
                 {
                     PGESTRING moveLayer;
+                    PGEXWriter moveLayerWriter(moveLayer);
 
                     if(IsEmpty(mvl.name))
                         continue;
 
-                    moveLayer += PGEFile::value("LN", PGEFile::WriteStr(mvl.name));
+                    moveLayerWriter.writeStr("LN", mvl.name);
 
                     if(!PGE_floatEqual(mvl.speed_x, 0.0, 5))
-                        moveLayer += PGEFile::value("SX", PGEFile::WriteFloat(mvl.speed_x));
+                        moveLayerWriter.writeFloat("SX", mvl.speed_x);
 
                     if(!IsEmpty(mvl.expression_x) && (mvl.expression_x != "0"))
-                        moveLayer += PGEFile::value("SXX", PGEFile::WriteStr(mvl.expression_x));
+                        moveLayerWriter.writeStr("SXX", mvl.expression_x);
 
                     if(!PGE_floatEqual(mvl.speed_y, 0.0, 5))
-                        moveLayer += PGEFile::value("SY", PGEFile::WriteFloat(mvl.speed_y));
+                        moveLayerWriter.writeFloat("SY", mvl.speed_y);
 
                     if(!IsEmpty(mvl.expression_y) && (mvl.expression_y != "0"))
-                        moveLayer += PGEFile::value("SYX", PGEFile::WriteStr(mvl.expression_y));
+                        moveLayerWriter.writeStr("SYX", mvl.expression_y);
 
                     if(mvl.way != 0)
-                        moveLayer += PGEFile::value("MW", PGEFile::WriteInt(mvl.way));
+                        moveLayerWriter.writeInt("MW", mvl.way);
 
                     moveLayers.push_back(moveLayer);
                 }
 
-                out << PGEFile::value("MLA", PGEFile::WriteStrArr(moveLayers));
+                w.writeStrArr("MLA", moveLayers);
             }
 
             //NPC's to spawn
@@ -2468,39 +2558,40 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
                 for(const auto & npc : event.spawn_npc)
                 {
                     PGESTRING spawnNPC;
-                    spawnNPC += PGEFile::value("ID", PGEFile::WriteInt(npc.id));
+                    PGEXWriter spawnNPCWriter(spawnNPC);
+                    spawnNPCWriter.writeInt("ID", npc.id);
 
                     if(npc.x != 0)
-                        spawnNPC += PGEFile::value("SX", PGEFile::WriteInt(npc.x));
+                        spawnNPCWriter.writeInt("SX", npc.x);
 
                     if(!IsEmpty(npc.expression_x) && (npc.expression_x != "0"))
-                        spawnNPC += PGEFile::value("SXX", PGEFile::WriteStr(npc.expression_x));
+                        spawnNPCWriter.writeStr("SXX", npc.expression_x);
 
                     if(npc.y != 0)
-                        spawnNPC += PGEFile::value("SY", PGEFile::WriteInt(npc.y));
+                        spawnNPCWriter.writeInt("SY", npc.y);
 
                     if(!IsEmpty(npc.expression_y) && (npc.expression_y != "0"))
-                        spawnNPC += PGEFile::value("SYX", PGEFile::WriteStr(npc.expression_y));
+                        spawnNPCWriter.writeStr("SYX", npc.expression_y);
 
                     if(!PGE_floatEqual(npc.speed_x, 0.0, 5))
-                        spawnNPC += PGEFile::value("SSX", PGEFile::WriteFloat(npc.speed_x));
+                        spawnNPCWriter.writeFloat("SSX", npc.speed_x);
 
                     if(!IsEmpty(npc.expression_sx)  && (npc.expression_sx != "0"))
-                        spawnNPC += PGEFile::value("SSXX", PGEFile::WriteStr(npc.expression_sx));
+                        spawnNPCWriter.writeStr("SSXX", npc.expression_sx);
 
                     if(!PGE_floatEqual(npc.speed_y, 0.0, 5))
-                        spawnNPC += PGEFile::value("SSY", PGEFile::WriteFloat(npc.speed_y));
+                        spawnNPCWriter.writeFloat("SSY", npc.speed_y);
 
                     if(!IsEmpty(npc.expression_sy) && (npc.expression_sy != "0"))
-                        spawnNPC += PGEFile::value("SSYX", PGEFile::WriteStr(npc.expression_sy));
+                        spawnNPCWriter.writeStr("SSYX", npc.expression_sy);
 
                     if(npc.special != 0)
-                        spawnNPC += PGEFile::value("SSS", PGEFile::WriteInt(npc.special));
+                        spawnNPCWriter.writeInt("SSS", npc.special);
 
                     spawnNPCs.push_back(spawnNPC);
                 }
 
-                out << PGEFile::value("SNPC", PGEFile::WriteStrArr(spawnNPCs));
+                w.writeStrArr("SNPC", spawnNPCs);
             }
 
             //Effects to spawn
@@ -2511,39 +2602,40 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
                 for(const auto &effect : event.spawn_effects)
                 {
                     PGESTRING spawnEffect;
-                    spawnEffect += PGEFile::value("ID", PGEFile::WriteInt(effect.id));
+                    PGEXWriter spawnEffectWriter(spawnEffect);
+                    spawnEffectWriter.writeInt("ID", effect.id);
 
                     if(effect.x != 0)
-                        spawnEffect += PGEFile::value("SX", PGEFile::WriteInt(effect.x));
+                        spawnEffectWriter.writeInt("SX", effect.x);
                     if(!IsEmpty(effect.expression_x) && (effect.expression_x != "0"))
-                        spawnEffect += PGEFile::value("SXX", PGEFile::WriteStr(effect.expression_x));
+                        spawnEffectWriter.writeStr("SXX", effect.expression_x);
                     if(effect.y != 0)
-                        spawnEffect += PGEFile::value("SY", PGEFile::WriteInt(effect.y));
+                        spawnEffectWriter.writeInt("SY", effect.y);
                     if(!IsEmpty(effect.expression_y) && (effect.expression_y != "0"))
-                        spawnEffect += PGEFile::value("SYX", PGEFile::WriteStr(effect.expression_y));
+                        spawnEffectWriter.writeStr("SYX", effect.expression_y);
                     if(!PGE_floatEqual(effect.speed_x, 0.0, 5))
-                        spawnEffect += PGEFile::value("SSX", PGEFile::WriteFloat(effect.speed_x));
+                        spawnEffectWriter.writeFloat("SSX", effect.speed_x);
                     if(!IsEmpty(effect.expression_sx) && (effect.expression_sx != "0"))
-                        spawnEffect += PGEFile::value("SSXX", PGEFile::WriteStr(effect.expression_sx));
+                        spawnEffectWriter.writeStr("SSXX", effect.expression_sx);
                     if(!PGE_floatEqual(effect.speed_y, 0.0, 5))
-                        spawnEffect += PGEFile::value("SSY", PGEFile::WriteFloat(effect.speed_y));
+                        spawnEffectWriter.writeFloat("SSY", effect.speed_y);
                     if(!IsEmpty(effect.expression_sy) && (effect.expression_sy != "0"))
-                        spawnEffect += PGEFile::value("SSYX", PGEFile::WriteStr(effect.expression_sy));
+                        spawnEffectWriter.writeStr("SSYX", effect.expression_sy);
                     if(effect.fps != 0)
-                        spawnEffect += PGEFile::value("FP", PGEFile::WriteInt(effect.fps));
+                        spawnEffectWriter.writeInt("FP", effect.fps);
                     if(effect.max_life_time != 0)
-                        spawnEffect += PGEFile::value("TTL", PGEFile::WriteInt(effect.max_life_time));
+                        spawnEffectWriter.writeInt("TTL", effect.max_life_time);
                     if(effect.gravity)
-                        spawnEffect += PGEFile::value("GT", PGEFile::WriteBool(effect.gravity));
+                        spawnEffectWriter.writeBool("GT", effect.gravity);
                     spawnEffects.push_back(spawnEffect);
                 }
 
-                out << PGEFile::value("SEF", PGEFile::WriteStrArr(spawnEffects));
+                w.writeStrArr("SEF", spawnEffects);
             }
 
-            out << PGEFile::value("AS", PGEFile::WriteInt(event.scroll_section)); // Move camera
-            out << PGEFile::value("AX", PGEFile::WriteFloat(event.move_camera_x)); // Move camera x
-            out << PGEFile::value("AY", PGEFile::WriteFloat(event.move_camera_y)); // Move camera y
+            w.writeInt("AS", event.scroll_section); // Move camera
+            w.writeFloat("AX", event.move_camera_x); // Move camera x
+            w.writeFloat("AY", event.move_camera_y); // Move camera y
 
             //Variables to update
             if(!event.update_variable.empty())
@@ -2553,92 +2645,93 @@ bool FileFormats::WriteExtendedLvlFile(PGE_FileFormats_misc::TextOutput &out, Le
                 for(const auto &updVar : event.update_variable)
                 {
                     PGESTRING updateVar;
-                    updateVar += PGEFile::value("N", PGEFile::WriteStr(updVar.name));
-                    updateVar += PGEFile::value("V", PGEFile::WriteStr(updVar.newval));
+                    PGEXWriter updateVarWriter(updateVar);
+                    updateVarWriter.writeStr("N", updVar.name);
+                    updateVarWriter.writeStr("V", updVar.newval);
                     updateVars.push_back(updateVar);
                 }
 
-                out << PGEFile::value("UV", PGEFile::WriteStrArr(updateVars));
+                w.writeStrArr("UV", updateVars);
             }
 
             if(event.timer_def.enable)
             {
-                out << PGEFile::value("TMR", PGEFile::WriteBool(event.timer_def.enable));     //Enable timer
-                out << PGEFile::value("TMC", PGEFile::WriteInt(event.timer_def.count));       //Time left (ticks)
-                out << PGEFile::value("TMI", PGEFile::WriteFloat(event.timer_def.interval));    //Tick Interval
-                out << PGEFile::value("TMD", PGEFile::WriteInt(event.timer_def.count_dir));   //Count direction
-                out << PGEFile::value("TMV", PGEFile::WriteBool(event.timer_def.show));       //Is timer vizible
+                w.writeBool("TMR", event.timer_def.enable);     //Enable timer
+                w.writeInt("TMC", event.timer_def.count);       //Time left (ticks)
+                w.writeFloat("TMI", event.timer_def.interval);    //Tick Interval
+                w.writeInt("TMD", event.timer_def.count_dir);   //Count direction
+                w.writeBool("TMV", event.timer_def.show);       //Is timer vizible
             }
 
-            out << "\n";
+            w << "\n";
         }
 
-        out << "EVENTS_CLASSIC_END\n";
+        w << "EVENTS_CLASSIC_END\n";
 
         //VARIABLES section
         if(!FileData.variables.empty())
         {
-            out << "VARIABLES\n";
+            w << "VARIABLES\n";
 
             for(const auto &var : FileData.variables)
             {
-                out << PGEFile::value("N", PGEFile::WriteStr(var.name));  // Variable name
+                w.writeStr("N", var.name);  // Variable name
                 if(!IsEmpty(var.value))
-                    out << PGEFile::value("V", PGEFile::WriteStr(var.value));  // Value
+                    w.writeStr("V", var.value);  // Value
                 if(var.is_global)
-                    out << PGEFile::value("G", PGEFile::WriteBool(var.is_global));  // Is GLobal
-                out << "\n";
+                    w.writeBool("G", var.is_global);  // Is GLobal
+                w << "\n";
             }
 
-            out << "VARIABLES_END\n";
+            w << "VARIABLES_END\n";
         }
 
         //ARRAYS section
         if(!FileData.arrays.empty())
         {
-            out << "ARRAYS\n";
+            w << "ARRAYS\n";
 
             for(const auto &var : FileData.arrays)
             {
-                out << PGEFile::value("N", PGEFile::WriteStr(var.name));  // Array name
-                out << "\n";
+                w.writeStr("N", var.name);  // Array name
+                w << "\n";
             }
 
-            out << "ARRAYS_END\n";
+            w << "ARRAYS_END\n";
         }
 
         //SCRIPTS section
         if(!FileData.scripts.empty())
         {
-            out << "SCRIPTS\n";
+            w << "SCRIPTS\n";
 
             for(const auto &script : FileData.scripts)
             {
-                out << PGEFile::value("N", PGEFile::WriteStr(script.name));  // Variable name
-                out << PGEFile::value("L", PGEFile::WriteInt(script.language));// Code of language
+                w.writeStr("N", script.name);  // Variable name
+                w.writeInt("L", script.language);// Code of language
                 if(!IsEmpty(script.script))
-                    out << PGEFile::value("S", PGEFile::WriteStr(script.script));  // Script text
-                out << "\n";
+                    w.writeStr("S", script.script);  // Script text
+                w << "\n";
             }
 
-            out << "SCRIPTS_END\n";
+            w << "SCRIPTS_END\n";
         }
 
         //CUSTOM_ITEMS_38A section
         if(!FileData.custom38A_configs.empty())
         {
-            out << "CUSTOM_ITEMS_38A\n";
+            w << "CUSTOM_ITEMS_38A\n";
             for(const auto &cfg : FileData.custom38A_configs)
             {
-                out << PGEFile::value("T", PGEFile::WriteInt(cfg.type));
-                out << PGEFile::value("ID", PGEFile::WriteInt(cfg.id));
+                w.writeInt("T", cfg.type);
+                w.writeInt("ID", cfg.id);
                 PGESTRINGList data;
                 for(auto &e : cfg.data)
                     data.PGESTRING_EMPLACE(PGEFile::WriteInt(e.key) + "=" + PGEFile::WriteInt(e.value));
-                out << PGEFile::value("D", PGEFile::WriteStrArr(data));
-                out << "\n";
+                w.writeStrArr("D", data);
+                w << "\n";
             }
-            out << "CUSTOM_ITEMS_38A_END\n";
+            w << "CUSTOM_ITEMS_38A_END\n";
         }
     }
 
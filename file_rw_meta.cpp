@@ -50,7 +50,7 @@ bool FileFormats::ReadNonSMBX64MetaDataF(const PGESTRING &filePath, MetaData &Fi
     return ReadNonSMBX64MetaDataFile(file, FileData);
 }
 
-bool FileFormats::ReadNonSMBX64MetaDataRaw(PGESTRING &rawdata, const PGESTRING &filePath, MetaData &FileData)
+bool FileFormats::ReadNonSMBX64MetaDataRaw(const PGESTRING &rawdata, const PGESTRING &filePath, MetaData &FileData)
 {
     FileData.meta.ERROR_info.clear();
     PGE_FileFormats_misc::RawTextInput file;
@@ -67,11 +67,29 @@ bool FileFormats::ReadNonSMBX64MetaDataRaw(PGESTRING &rawdata, const PGESTRING &
     return ReadNonSMBX64MetaDataFile(file, FileData);
 }
 
+bool FileFormats::ReadNonSMBX64MetaDataRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, MetaData &FileData)
+{
+    FileData.meta.ERROR_info.clear();
+    PGE_FileFormats_misc::ViewTextInput file;
+
+    if(!file.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ERROR_info = "Failed to open raw string for read";
+        FileData.meta.ERROR_linedata.clear();
+        FileData.meta.ERROR_linenum = -1;
+        FileData.meta.ReadFileValid = false;
+        return false;
+    }
+
+    return ReadNonSMBX64MetaDataFile(file, FileData);
+}
+
 bool FileFormats::ReadNonSMBX64MetaDataFile(PGE_FileFormats_misc::TextInput &in, MetaData &FileData)
 {
     PGESTRING errorString;
     int str_count = 0;      //Line Counter
     PGESTRING line;           //Current Line data
+    PGEFile::PGEX_ValueLocation valueLoc;
     ///////////////////////////////////////Begin file///////////////////////////////////////
     PGEFile pgeX_Data(in.readAll());
 
@@ -103,7 +121,7 @@ bool FileFormats::ReadNonSMBX64MetaDataFile(PGE_FileFormats_misc::TextInput &in,
                     goto badfile;
                 }
 
-                PGEFile::PGEX_Item x = f_section.data[sdata];
+                const PGEFile::PGEX_Item &x = f_section.data[sdata];
                 Bookmark meta_bookmark;
                 meta_bookmark.bookmarkName.clear();
                 meta_bookmark.x = 0;
@@ -111,32 +129,36 @@ bool FileFormats::ReadNonSMBX64MetaDataFile(PGE_FileFormats_misc::TextInput &in,
 
                 for(const auto &v : x.values) //Look markers and values
                 {
-                    errorString = PGESTRING("Wrong value syntax\nSection [") +
-                                  f_section.name + "]\nData line " +
-                                  fromNum(sdata) + "\nMarker " +
-                                  v.marker + "\nValue " +
-                                  v.value;
+                    errorString.clear();
+                    valueLoc.section = &f_section;
+                    valueLoc.item = sdata;
+                    valueLoc.value = &v;
 
-                    if(v.marker == "BM") //Bookmark name
+                    switch(PGEFile::markerKey(v.marker))
                     {
+                    case PGEFile::markerKey("BM"): //Bookmark name
                         if(PGEFile::IsQoutedString(v.value))
                             meta_bookmark.bookmarkName = PGEFile::X2STRING(v.value);
                         else
                             goto badfile;
-                    }
-                    else if(v.marker == "X") // Position X
-                    {
+                        break;
+
+                    case PGEFile::markerKey("X"): // Position X
                         if(PGEFile::IsIntS(v.value))
                             meta_bookmark.x = toInt(v.value);
                         else
                             goto badfile;
-                    }
-                    else if(v.marker == "Y") //Position Y
-                    {
+                        break;
+
+                    case PGEFile::markerKey("Y"): //Position Y
                         if(PGEFile::IsIntS(v.value))
                             meta_bookmark.y = toInt(v.value);
                         else
                             goto badfile;
+                        break;
+
+                    default:
+                        break;
                     }
                 }
 
@@ -152,6 +174,8 @@ bool FileFormats::ReadNonSMBX64MetaDataFile(PGE_FileFormats_misc::TextInput &in,
 
 badfile:    //If file format is not correct
     //BadFileMsg(filePath+"\nError message: "+errorString, str_count, line);
+    if(IsEmpty(errorString))
+        errorString = PGEFile::valueErrorString(valueLoc);
     FileData.meta.ERROR_info = errorString;
     FileData.meta.ERROR_linenum = str_count;
     FileData.meta.ERROR_linedata = line;
@@ -199,24 +223,25 @@ bool FileFormats::WriteNonSMBX64MetaDataRaw(MetaData &metaData, PGESTRING &rawda
 
 bool FileFormats::WriteNonSMBX64MetaData(PGE_FileFormats_misc::TextOutput &out, MetaData &metaData)
 {
+    PGEXWriter w(out);
     pge_size_t i;
 
     //Bookmarks
     if(!metaData.bookmarks.empty())
     {
-        out << "META_BOOKMARKS\n";
+        w << "META_BOOKMARKS\n";
 
         for(i = 0; i < metaData.bookmarks.size(); i++)
         {
             Bookmark &bm = metaData.bookmarks[i];
             //Bookmark name
-            out << PGEFile::value("BM", PGEFile::WriteStr(bm.bookmarkName));
-            out << PGEFile::value("X", PGEFile::WriteRoundFloat(bm.x));
-            out << PGEFile::value("Y", PGEFile::WriteRoundFloat(bm.y));
-            out << "\n";
+            w.writeStr("BM", bm.bookmarkName);
+            w.writeRoundFloat("X", bm.x);
+            w.writeRoundFloat("Y", bm.y);
+            w << "\n";
         }
 
-        out << "META_BOOKMARKS_END\n";
+        w << "META_BOOKMARKS_END\n";
     }
 
     return true;
@@ -349,97 +349,97 @@ bool FileFormats::WriteNPCTxtFileRaw(NPCConfigFile &FileData, PGESTRING &rawdata
 bool FileFormats::WriteNPCTxtFile(PGE_FileFormats_misc::TextOutput &out, NPCConfigFile &fileData)
 {
     if(fileData.en_gfxoffsetx)
-        out << "gfxoffsetx=" + fromNum(fileData.gfxoffsetx) + "\n";
+        out << "gfxoffsetx=" << fromNum(fileData.gfxoffsetx) << "\n";
     if(fileData.en_gfxoffsety)
-        out << "gfxoffsety=" + fromNum(fileData.gfxoffsety) + "\n";
+        out << "gfxoffsety=" << fromNum(fileData.gfxoffsety) << "\n";
     if(fileData.en_gfxwidth)
-        out << "gfxwidth=" + fromNum(fileData.gfxwidth) + "\n";
+        out << "gfxwidth=" << fromNum(fileData.gfxwidth) << "\n";
     if(fileData.en_gfxheight)
-        out << "gfxheight=" + fromNum(fileData.gfxheight) + "\n";
+        out << "gfxheight=" << fromNum(fileData.gfxheight) << "\n";
     if(fileData.en_foreground)
-        out << "foreground=" + fromBoolToNum(fileData.foreground) + "\n";
+        out << "foreground=" << fromBoolToNum(fileData.foreground) << "\n";
     if(fileData.en_width)
-        out << "width=" + fromNum(fileData.width) + "\n";
+        out << "width=" << fromNum(fileData.width) << "\n";
     if(fileData.en_height)
-        out << "height=" + fromNum(fileData.height) + "\n";
+        out << "height=" << fromNum(fileData.height) << "\n";
 
     if(fileData.en_score)
-        out << "score=" + fromNum(fileData.score) + "\n";
+        out << "score=" << fromNum(fileData.score) << "\n";
     if(fileData.en_health)
-        out << "health=" + fromNum(fileData.health) + "\n";
+        out << "health=" << fromNum(fileData.health) << "\n";
 
     if(fileData.en_playerblock)
-        out << "playerblock=" + fromBoolToNum(fileData.playerblock) + "\n";
+        out << "playerblock=" << fromBoolToNum(fileData.playerblock) << "\n";
 
     if(fileData.en_playerblocktop)
-        out << "playerblocktop=" + fromBoolToNum(fileData.playerblocktop) + "\n";
+        out << "playerblocktop=" << fromBoolToNum(fileData.playerblocktop) << "\n";
 
     if(fileData.en_npcblock)
-        out << "npcblock=" + fromBoolToNum(fileData.npcblock) + "\n";
+        out << "npcblock=" << fromBoolToNum(fileData.npcblock) << "\n";
 
     if(fileData.en_npcblocktop)
-        out << "npcblocktop=" + fromBoolToNum(fileData.npcblocktop) + "\n";
+        out << "npcblocktop=" << fromBoolToNum(fileData.npcblocktop) << "\n";
     if(fileData.en_grabside)
-        out << "grabside=" + fromBoolToNum(fileData.grabside) + "\n";
+        out << "grabside=" << fromBoolToNum(fileData.grabside) << "\n";
     if(fileData.en_grabtop)
-        out << "grabtop=" + fromBoolToNum(fileData.grabtop) + "\n";
+        out << "grabtop=" << fromBoolToNum(fileData.grabtop) << "\n";
     if(fileData.en_jumphurt)
-        out << "jumphurt=" + fromBoolToNum(fileData.jumphurt) + "\n";
+        out << "jumphurt=" << fromBoolToNum(fileData.jumphurt) << "\n";
     if(fileData.en_nohurt)
-        out << "nohurt=" + fromBoolToNum(fileData.nohurt) + "\n";
+        out << "nohurt=" << fromBoolToNum(fileData.nohurt) << "\n";
     if(fileData.en_speed)
-        out << "speed=" + fromNum(fileData.speed) + "\n";
+        out << "speed=" << fromNum(fileData.speed) << "\n";
     if(fileData.en_noblockcollision)
-        out << "noblockcollision=" + fromBoolToNum(fileData.noblockcollision) + "\n";
+        out << "noblockcollision=" << fromBoolToNum(fileData.noblockcollision) << "\n";
     if(fileData.en_cliffturn)
-        out << "cliffturn=" + fromBoolToNum(fileData.cliffturn) + "\n";
+        out << "cliffturn=" << fromBoolToNum(fileData.cliffturn) << "\n";
     if(fileData.en_noyoshi)
-        out << "noyoshi=" + fromBoolToNum(fileData.noyoshi) + "\n";
+        out << "noyoshi=" << fromBoolToNum(fileData.noyoshi) << "\n";
     if(fileData.en_nofireball)
-        out << "nofireball=" + fromBoolToNum(fileData.nofireball) + "\n";
+        out << "nofireball=" << fromBoolToNum(fileData.nofireball) << "\n";
     if(fileData.en_nogravity)
-        out << "nogravity=" + fromBoolToNum(fileData.nogravity) + "\n";
+        out << "nogravity=" << fromBoolToNum(fileData.nogravity) << "\n";
     if(fileData.en_noiceball)
-        out << "noiceball=" + fromBoolToNum(fileData.noiceball) + "\n";
+        out << "noiceball=" << fromBoolToNum(fileData.noiceball) << "\n";
     if(fileData.en_frames)
-        out << "frames=" + fromNum(fileData.frames) + "\n";
+        out << "frames=" << fromNum(fileData.frames) << "\n";
     if(fileData.en_framespeed)
-        out << "framespeed=" + fromNum(fileData.framespeed) + "\n";
+        out << "framespeed=" << fromNum(fileData.framespeed) << "\n";
     if(fileData.en_framestyle)
-        out << "framestyle=" + fromNum(fileData.framestyle) + "\n";
+        out << "framestyle=" << fromNum(fileData.framestyle) << "\n";
 
     //Extended
     if(fileData.en_nohammer)
-        out << "nohammer=" + fromBoolToNum(fileData.nohammer) + "\n";
+        out << "nohammer=" << fromBoolToNum(fileData.nohammer) << "\n";
     if(fileData.en_noshell)
-        out << "noshell=" + fromBoolToNum(fileData.noshell) + "\n";
+        out << "noshell=" << fromBoolToNum(fileData.noshell) << "\n";
     if(fileData.en_name && !IsEmpty(fileData.name))
-        out << "name=" + SMBX64::WriteStr(fileData.name);
+        out << "name=" << SMBX64::WriteStr(fileData.name);
     if(fileData.en_description && !IsEmpty(fileData.description))
-        out << "description=" + SMBX64::WriteStr(fileData.description);
+        out << "description=" << SMBX64::WriteStr(fileData.description);
     if(fileData.en_image && !IsEmpty(fileData.image))
-        out << "image=" + SMBX64::WriteStr(fileData.image);
+        out << "image=" << SMBX64::WriteStr(fileData.image);
     if(fileData.en_icon && !IsEmpty(fileData.icon))
-        out << "icon=" + SMBX64::WriteStr(fileData.icon);
+        out << "icon=" << SMBX64::WriteStr(fileData.icon);
     if(fileData.en_script && !IsEmpty(fileData.script))
-        out << "script=" + SMBX64::WriteStr(fileData.script);
+        out << "script=" << SMBX64::WriteStr(fileData.script);
     if(fileData.en_group && !IsEmpty(fileData.group))
-        out << "group=" + SMBX64::WriteStr(fileData.group);
+        out << "group=" << SMBX64::WriteStr(fileData.group);
     if(fileData.en_category && !IsEmpty(fileData.category))
-        out << "category=" + SMBX64::WriteStr(fileData.category);
+        out << "category=" << SMBX64::WriteStr(fileData.category);
     if(fileData.en_grid)
-        out << "grid=" + fromNum(fileData.grid) + "\n";
+        out << "grid=" << fromNum(fileData.grid) << "\n";
     if(fileData.en_gridoffsetx)
-        out << "gridoffsetx=" + fromNum(fileData.gridoffsetx) + "\n";
+        out << "gridoffsetx=" << fromNum(fileData.gridoffsetx) << "\n";
     if(fileData.en_gridoffsety)
-        out << "gridoffsety=" + fromNum(fileData.gridoffsety) + "\n";
+        out << "gridoffsety=" << fromNum(fileData.gridoffsety) << "\n";
     if(fileData.en_gridalign)
-        out << "gridalign=" + fromNum(fileData.gridalign) + "\n";
+        out << "gridalign=" << fromNum(fileData.gridalign) << "\n";
 
     // Custom values
     for(auto it = fileData.entries.begin(); it != fileData.entries.end(); ++it)
     {
-        out << PGEMAPKEY(it) << "=" << PGEMAPVAL(it) + "\n";
+        out << PGEMAPKEY(it) << "=" << PGEMAPVAL(it) << "\n";
     }
 
     return true;
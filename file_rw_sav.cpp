@@ -58,7 +58,7 @@ bool FileFormats::ReadSMBX64SavFileF(const PGESTRING &filePath, GamesaveData &Fi
     return ReadSMBX64SavFile(file, FileData);
 }
 
-bool FileFormats::ReadSMBX64SavFileRaw(PGESTRING &rawdata, const PGESTRING &filePath,  GamesaveData &FileData)
+bool FileFormats::ReadSMBX64SavFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath,  GamesaveData &FileData)
 {
     FileData.meta.ERROR_info.clear();
     PGE_FileFormats_misc::RawTextInput file;
@@ -73,6 +73,21 @@ bool FileFormats::ReadSMBX64SavFileRaw(PGESTRING &rawdata, const PGESTRING &file
     return ReadSMBX64SavFile(file, FileData);
 }
 
+bool FileFormats::ReadSMBX64SavFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, GamesaveData &FileData)
+{
+    FileData.meta.ERROR_info.clear();
+    PGE_FileFormats_misc::ViewTextInput file;
+    if(!file.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ERROR_info = "Failed to open raw string for read";
+        FileData.meta.ERROR_linedata.clear();
+        FileData.meta.ERROR_linenum = -1;
+        FileData.meta.ReadFileValid = false;
+        return false;
+    }
+    return ReadSMBX64SavFile(file, FileData);
+}
+
 bool FileFormats::ReadSMBX64SavFile(PGE_FileFormats_misc::TextInput &in, GamesaveData &FileData)
 {
     SMBX64_FileBegin();
@@ -102,32 +117,32 @@ bool FileFormats::ReadSMBX64SavFile(PGE_FileFormats_misc::TextInput &in, Gamesav
     {
         ///////////////////////////////////////Begin file///////////////////////////////////////
         nextLine();
-        SMBX64::ReadUInt(&file_format, line);//File format number
+        SMBX64_Read(ParseUInt, file_format, "file format");//File format number
         FileData.meta.RecentFormatVersion = file_format;
         nextLine();
-        SMBX64::ReadSInt(&FileData.lives, line); //Number of lives
+        SMBX64_Read(ParseSInt, FileData.lives, "lives"); //Number of lives
         nextLine();
-        SMBX64::ReadUInt(&FileData.coins, line); //Number of coins
+        SMBX64_Read(ParseUInt, FileData.coins, "coins"); //Number of coins
         nextLine();
-        SMBX64::ReadSInt(&FileData.worldPosX, line);  //World map pos X
+        SMBX64_Read(ParseSInt, FileData.worldPosX, "world map X");  //World map pos X
         nextLine();
-        SMBX64::ReadSInt(&FileData.worldPosY, line);  //World map pos Y
+        SMBX64_Read(ParseSInt, FileData.worldPosY, "world map Y");  //World map pos Y
 
         for(i = 0; i < (ge(56) ? 5 : 2) ; i++)
         {
             saveCharState charState;
             charState = CreateSavCharacterState();
             nextLine();
-            SMBX64::ReadUInt(&charState.state, line);//Character's power up state
+            SMBX64_Read(ParseUInt, charState.state, "character power-up state");//Character's power up state
             nextLine();
-            SMBX64::ReadUInt(&charState.itemID, line); //ID of item in the slot
+            SMBX64_Read(ParseUInt, charState.itemID, "character reserved item"); //ID of item in the slot
             if(ge(10))
             {
                 nextLine();    //Type of mount
-                SMBX64::ReadUInt(&charState.mountType, line);
+                SMBX64_Read(ParseUInt, charState.mountType, "character mount type");
             }
             nextLine();
-            SMBX64::ReadUInt(&charState.mountID, line); //ID of mount
+            SMBX64_Read(ParseUInt, charState.mountID, "character mount ID"); //ID of mount
             if(lt(10))
             {
                 if(charState.mountID > 0) charState.mountType = 1;
@@ -135,20 +150,20 @@ bool FileFormats::ReadSMBX64SavFile(PGE_FileFormats_misc::TextInput &in, Gamesav
             if(ge(56))
             {
                 nextLine();    //ID of mount
-                SMBX64::ReadUInt(&charState.health, line);
+                SMBX64_Read(ParseUInt, charState.health, "character health");
             }
             FileData.characterStates.push_back(charState);
         }
 
         nextLine();
-        SMBX64::ReadUInt(&FileData.musicID, line);//ID of music
+        SMBX64_Read(ParseUInt, FileData.musicID, "world music");//ID of music
         nextLine();
         if(IsEmpty(line) || in.eof())
             goto successful;
 
         if(ge(56))
         {
-            SMBX64::ReadCSVBool(&FileData.gameCompleted, line);   //Game was complited
+            SMBX64_Read(ParseCSVBool, FileData.gameCompleted, "game completed");   //Game was complited
         }
 
         arrayIdCounter = 1;
@@ -159,7 +174,7 @@ bool FileFormats::ReadSMBX64SavFile(PGE_FileFormats_misc::TextInput &in, Gamesav
             visibleItem level;
             level.first = (unsigned int)arrayIdCounter;
             level.second = false;
-            SMBX64::ReadCSVBool(&level.second, line); //Is level shown
+            SMBX64_Read(ParseCSVBool, level.second, "visible level"); //Is level shown
 
             FileData.visibleLevels.push_back(level);
             arrayIdCounter++;
@@ -173,7 +188,7 @@ bool FileFormats::ReadSMBX64SavFile(PGE_FileFormats_misc::TextInput &in, Gamesav
             visibleItem level;
             level.first = (unsigned int)arrayIdCounter;
             level.second = false;
-            SMBX64::ReadCSVBool(&level.second, line); //Is path shown
+            SMBX64_Read(ParseCSVBool, level.second, "visible path"); //Is path shown
 
             FileData.visiblePaths.push_back(level);
             arrayIdCounter++;
@@ -187,7 +202,7 @@ bool FileFormats::ReadSMBX64SavFile(PGE_FileFormats_misc::TextInput &in, Gamesav
             visibleItem level;
             level.first = (unsigned int)arrayIdCounter;
             level.second = false;
-            SMBX64::ReadCSVBool(&level.second, line); //Is Scenery shown
+            SMBX64_Read(ParseCSVBool, level.second, "visible scenery"); //Is Scenery shown
 
             FileData.visibleScenery.push_back(level);
             arrayIdCounter++;
@@ -207,7 +222,7 @@ bool FileFormats::ReadSMBX64SavFile(PGE_FileFormats_misc::TextInput &in, Gamesav
                 if(ge(16))
                 {
                     nextLine();    //Section ID
-                    SMBX64::ReadUInt(&gottenStar.second, line);
+                    SMBX64_Read(ParseUInt, gottenStar.second, "star section");
                 }
 
                 FileData.gottenStars.push_back(gottenStar);
@@ -220,7 +235,7 @@ bool FileFormats::ReadSMBX64SavFile(PGE_FileFormats_misc::TextInput &in, Gamesav
             nextLine();
             if(IsEmpty(line) || in.eof())
                 goto successful;
-            SMBX64::ReadUInt(&FileData.totalStars, line);//Total Number of stars
+            SMBX64_Read(ParseUInt, FileData.totalStars, "total stars");//Total Number of stars
         }
 
 successful:
@@ -230,21 +245,12 @@ successful:
     }
     catch(const std::exception &err)
     {
-        if(file_format > 0)
-            FileData.meta.ERROR_info = "Detected file format: SMBX-" + fromNum(file_format) + " is invalid\n";
-        else
-            FileData.meta.ERROR_info = "It is not an SMBX game save file\n";
-        #ifdef PGE_FILES_QT
-        FileData.meta.ERROR_info += QString::fromStdString(exception_to_pretty_string(err));
-        #else
-        FileData.meta.ERROR_info += exception_to_pretty_string(err);
-        #endif
-        FileData.meta.ERROR_linenum = in.getCurrentLineNumber();
-        FileData.meta.ERROR_linedata = line;
-        FileData.meta.ReadFileValid = false;
-        PGE_CutLength(FileData.meta.ERROR_linedata, 50);
-        PGE_FilterBinary(FileData.meta.ERROR_linedata);
+        SMBX64::SetReadError(FileData.meta, "game save", file_format, err, in.getCurrentLineNumber(), line);
         return false;
     }
+
+badfile:
+    SMBX64::SetReadError(FileData.meta, "game save", file_format, parse_error, in.getCurrentLineNumber(), line);
+    return false;
 }
 
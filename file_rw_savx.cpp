@@ -54,7 +54,7 @@ bool FileFormats::ReadExtendedSaveFileF(const PGESTRING &filePath, GamesaveData
     return ReadExtendedSaveFile(file, FileData);
 }
 
-bool FileFormats::ReadExtendedSaveFileRaw(PGESTRING &rawdata, const PGESTRING &filePath, GamesaveData &FileData)
+bool FileFormats::ReadExtendedSaveFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath, GamesaveData &FileData)
 {
     FileData.meta.ERROR_info.clear();
     PGE_FileFormats_misc::RawTextInput file;
@@ -71,6 +71,23 @@ bool FileFormats::ReadExtendedSaveFileRaw(PGESTRING &rawdata, const PGESTRING &f
     return ReadExtendedSaveFile(file, FileData);
 }
 
+bool FileFormats::ReadExtendedSaveFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, GamesaveData &FileData)
+{
+    FileData.meta.ERROR_info.clear();
+    PGE_FileFormats_misc::ViewTextInput file;
+
+    if(!file.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ERROR_info = "Failed to open raw string for read";
+        FileData.meta.ERROR_linedata.clear();
+        FileData.meta.ERROR_linenum = -1;
+        FileData.meta.ReadFileValid = false;
+        return false;
+    }
+
+    return ReadExtendedSaveFile(file, FileData);
+}
+
 bool FileFormats::ReadExtendedSaveFile(PGE_FileFormats_misc::TextInput &in, GamesaveData &FileData)
 {
     FileData = CreateGameSaveData();
@@ -96,7 +113,7 @@ bool FileFormats::ReadExtendedSaveFile(PGE_FileFormats_misc::TextInput &in, Game
     FileData.meta.untitled = false;
     FileData.meta.modified = false;
     ///////////////////////////////////////Begin file///////////////////////////////////////
-    PGEX_FileParseTree(in.readAll());
+    PGEX_FileParseStream(in);
     PGEX_FetchSection()
     {
         PGEX_FetchSection_begin()
@@ -292,6 +309,7 @@ bool FileFormats::ReadExtendedSaveFile(PGE_FileFormats_misc::TextInput &in, Game
     FileData.meta.ReadFileValid = true;
     return true;
 badfile:    //If file format not corrects
+    PGEX_ValueError()
     FileData.meta.ERROR_info = errorString;
     FileData.meta.ERROR_linenum = str_count;
     FileData.meta.ERROR_linedata = line;
@@ -336,139 +354,140 @@ bool FileFormats::WriteExtendedSaveFileRaw(GamesaveData &FileData, PGESTRING &ra
 
 bool FileFormats::WriteExtendedSaveFile(PGE_FileFormats_misc::TextOutput &out, GamesaveData &FileData)
 {
+    PGEXWriter w(out);
     pge_size_t i;
-    out << "SAVE_HEADER\n";
-    out << PGEFile::value("LV", PGEFile::WriteInt(FileData.lives));
-    out << PGEFile::value("CN", PGEFile::WriteInt(FileData.coins));
-    out << PGEFile::value("PT", PGEFile::WriteInt(FileData.points));
-    out << PGEFile::value("TS", PGEFile::WriteInt(FileData.totalStars));
-    out << PGEFile::value("WX", PGEFile::WriteInt(FileData.worldPosX));
-    out << PGEFile::value("WY", PGEFile::WriteInt(FileData.worldPosY));
-    out << PGEFile::value("HW", PGEFile::WriteInt(FileData.last_hub_warp));
-    out << PGEFile::value("MI", PGEFile::WriteInt(FileData.musicID));
-    out << PGEFile::value("MF", PGEFile::WriteStr(FileData.musicFile));
-    out << PGEFile::value("GC", PGEFile::WriteBool(FileData.gameCompleted));
-    out << "\n";
-    out << "SAVE_HEADER_END\n";
+    w << "SAVE_HEADER\n";
+    w.writeInt("LV", FileData.lives);
+    w.writeInt("CN", FileData.coins);
+    w.writeInt("PT", FileData.points);
+    w.writeInt("TS", FileData.totalStars);
+    w.writeInt("WX", FileData.worldPosX);
+    w.writeInt("WY", FileData.worldPosY);
+    w.writeInt("HW", FileData.last_hub_warp);
+    w.writeInt("MI", FileData.musicID);
+    w.writeStr("MF", FileData.musicFile);
+    w.writeBool("GC", FileData.gameCompleted);
+    w << "\n";
+    w << "SAVE_HEADER_END\n";
 
     if(!FileData.characterStates.empty())
     {
-        out << "CHARACTERS\n";
+        w << "CHARACTERS\n";
 
         for(i = 0; i < FileData.characterStates.size(); i++)
         {
             saveCharState &chState = FileData.characterStates[i];
-            out << PGEFile::value("ID", PGEFile::WriteInt(chState.id));
-            out << PGEFile::value("ST", PGEFile::WriteInt(chState.state));
-            out << PGEFile::value("IT", PGEFile::WriteInt(chState.itemID));
-            out << PGEFile::value("MT", PGEFile::WriteInt(chState.mountType));
-            out << PGEFile::value("MI", PGEFile::WriteInt(chState.mountID));
-            out << PGEFile::value("HL", PGEFile::WriteInt(chState.health));
-            out << "\n";
+            w.writeInt("ID", chState.id);
+            w.writeInt("ST", chState.state);
+            w.writeInt("IT", chState.itemID);
+            w.writeInt("MT", chState.mountType);
+            w.writeInt("MI", chState.mountID);
+            w.writeInt("HL", chState.health);
+            w << "\n";
         }
 
-        out << "CHARACTERS_END\n";
+        w << "CHARACTERS_END\n";
     }
 
     if(!FileData.currentCharacter.empty())
     {
-        out << "CHARACTERS_PER_PLAYERS\n";
+        w << "CHARACTERS_PER_PLAYERS\n";
 
         for(i = 0; i < FileData.currentCharacter.size(); i++)
         {
-            out << PGEFile::value("ID", PGEFile::WriteInt(FileData.currentCharacter[i]));
-            out << "\n";
+            w.writeInt("ID", FileData.currentCharacter[i]);
+            w << "\n";
         }
 
-        out << "CHARACTERS_PER_PLAYERS_END\n";
+        w << "CHARACTERS_PER_PLAYERS_END\n";
     }
 
     if(!FileData.visibleLevels.empty())
     {
-        out << "VIZ_LEVELS\n";
+        w << "VIZ_LEVELS\n";
 
         for(i = 0; i < FileData.visibleLevels.size(); i++)
         {
             visibleItem &slevel = FileData.visibleLevels[i];
-            out << PGEFile::value("ID", PGEFile::WriteInt(slevel.first));
-            out << PGEFile::value("V", PGEFile::WriteBool(slevel.second));
-            out << "\n";
+            w.writeInt("ID", slevel.first);
+            w.writeBool("V", slevel.second);
+            w << "\n";
         }
 
-        out << "VIZ_LEVELS_END\n";
+        w << "VIZ_LEVELS_END\n";
     }
 
     if(!FileData.visiblePaths.empty())
     {
-        out << "VIZ_PATHS\n";
+        w << "VIZ_PATHS\n";
 
         for(i = 0; i < FileData.visiblePaths.size(); i++)
         {
             visibleItem &slevel = FileData.visiblePaths[i];
-            out << PGEFile::value("ID", PGEFile::WriteInt(slevel.first));
-            out << PGEFile::value("V", PGEFile::WriteBool(slevel.second));
-            out << "\n";
+            w.writeInt("ID", slevel.first);
+            w.writeBool("V", slevel.second);
+            w << "\n";
         }
 
-        out << "VIZ_PATHS_END\n";
+        w << "VIZ_PATHS_END\n";
     }
 
     if(!FileData.visibleScenery.empty())
     {
-        out << "VIZ_SCENERY\n";
+        w << "VIZ_SCENERY\n";
 
         for(i = 0; i < FileData.visibleScenery.size(); i++)
         {
             visibleItem &slevel = FileData.visibleScenery[i];
-            out << PGEFile::value("ID", PGEFile::WriteInt(slevel.first));
-            out << PGEFile::value("V", PGEFile::WriteBool(slevel.second));
-            out << "\n";
+            w.writeInt("ID", slevel.first);
+            w.writeBool("V", slevel.second);
+            w << "\n";
         }
 
-        out << "VIZ_SCENERY_END\n";
+        w << "VIZ_SCENERY_END\n";
     }
 
     if(!FileData.gottenStars.empty())
     {
-        out << "STARS\n";
+        w << "STARS\n";
 
         for(i = 0; i < FileData.gottenStars.size(); i++)
         {
             starOnLevel &slevel = FileData.gottenStars[i];
-            out << PGEFile::value("L", PGEFile::WriteStr(slevel.first));
-            out << PGEFile::value("S", PGEFile::WriteInt(slevel.second));
-            out << "\n";
+            w.writeStr("L", slevel.first);
+            w.writeInt("S", slevel.second);
+            w << "\n";
         }
 
-        out << "STARS_END\n";
+        w << "STARS_END\n";
     }
 
     if(!FileData.levelInfo.empty())
     {
-        out << "LEVEL_INFO\n";
+        w << "LEVEL_INFO\n";
 
         for(i = 0; i < FileData.levelInfo.size(); i++)
         {
             saveLevelInfo &slinfo = FileData.levelInfo[i];
-            out << PGEFile::value("L", PGEFile::WriteStr(slinfo.level_filename));
-            out << PGEFile::value("S", PGEFile::WriteInt(slinfo.max_stars));
-            out << PGEFile::value("M", PGEFile::WriteInt(slinfo.max_medals));
+            w.writeStr("L", slinfo.level_filename);
+            w.writeInt("S", slinfo.max_stars);
+            w.writeInt("M", slinfo.max_medals);
 
             if(!slinfo.medals_got.empty())
-                out << PGEFile::value("MG", PGEFile::WriteBoolArr(slinfo.medals_got));
+                w.writeBoolArr("MG", slinfo.medals_got);
 
             if(!slinfo.medals_best.empty())
-                out << PGEFile::value("MB", PGEFile::WriteBoolArr(slinfo.medals_best));
+                w.writeBoolArr("MB", slinfo.medals_best);
 
-            out << "\n";
+            w << "\n";
         }
 
-        out << "LEVEL_INFO_END\n";
+        w << "LEVEL_INFO_END\n";
     }
 
     if(!FileData.userData.store.empty())
     {
-        out << "USERDATA\n";
+        w << "USERDATA\n";
 
         for(const auto &e : FileData.userData.store)
         {
@@ -476,13 +495,13 @@ bool FileFormats::WriteExtendedSaveFile(PGE_FileFormats_misc::TextOutput &out, G
                 continue;// Don't save volatile fields into the file!
 
             int location_clean = (e.location & saveUserData::DATA_LOCATION_MASK);
-            out << PGEFile::value("L", PGEFile::WriteInt(location_clean));
+            w.writeInt("L", location_clean);
 
             if(!IsEmpty(e.name) && (e.name != "default"))
-                out << PGEFile::value("SN", PGEFile::WriteStr(e.name));
+                w.writeStr("SN", e.name);
 
             if(!IsEmpty(e.location_name))
-                out << PGEFile::value("LN", PGEFile::WriteStr(e.location_name));
+                w.writeStr("LN", e.location_name);
 
             PGESTRINGList data;
             for(const auto &d : e.data)
@@ -492,12 +511,12 @@ bool FileFormats::WriteExtendedSaveFile(PGE_FileFormats_misc::TextOutput &out, G
                 data.PGESTRING_EMPLACE(PGEFile::WriteStr(key) + "=" + PGEFile::WriteStr(value));
             }
 
-            out << PGEFile::value("D", PGEFile::WriteStrArr(data));
-            out << "\n";
+            w.writeStrArr("D", data);
+            w << "\n";
         }
-        out << "USERDATA_END\n";
+        w << "USERDATA_END\n";
     }
 
-    out << "\n";
+    w << "\n";
     return true;
 }
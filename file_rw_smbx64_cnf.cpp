@@ -51,7 +51,7 @@ bool FileFormats::ReadSMBX64ConfigFileF(const PGESTRING &filePath, SMBX64_Config
     return ReadSMBX64ConfigFile(file, FileData);
 }
 
-bool FileFormats::ReadSMBX64ConfigFileRaw(PGESTRING &rawdata, const PGESTRING &filePath,  SMBX64_ConfigFile &FileData)
+bool FileFormats::ReadSMBX64ConfigFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath,  SMBX64_ConfigFile &FileData)
 {
     PGE_FileFormats_misc::RawTextInput file;
     FileData.meta.ERROR_info.clear();
@@ -68,6 +68,23 @@ bool FileFormats::ReadSMBX64ConfigFileRaw(PGESTRING &rawdata, const PGESTRING &f
     return ReadSMBX64ConfigFile(file, FileData);
 }
 
+bool FileFormats::ReadSMBX64ConfigFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, SMBX64_ConfigFile &FileData)
+{
+    PGE_FileFormats_misc::ViewTextInput file;
+    FileData.meta.ERROR_info.clear();
+
+    if(!file.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ERROR_info = "Failed to open raw string for read";
+        FileData.meta.ERROR_linedata.clear();
+        FileData.meta.ERROR_linenum = -1;
+        FileData.meta.ReadFileValid = false;
+        return false;
+    }
+
+    return ReadSMBX64ConfigFile(file, FileData);
+}
+
 SMBX64_ConfigFile FileFormats::ReadSMBX64ConfigFile(PGESTRING RawData)
 {
     SMBX64_ConfigFile FileData;
@@ -87,60 +104,60 @@ bool FileFormats::ReadSMBX64ConfigFile(PGE_FileFormats_misc::TextInput &in, SMBX
         ///////////////////////////////////////Begin file///////////////////////////////////////
         //File format number
         nextLine();
-        SMBX64::ReadUInt(&file_format, line);
+        SMBX64_Read(ParseUInt, file_format, "file format");
 
         //Full screen mode
         if(ge(16))
         {
             nextLine();
-            SMBX64::ReadCSVBool(&FileData.fullScreen, line);
+            SMBX64_Read(ParseCSVBool, FileData.fullScreen, "full screen");
         }
 
         for(unsigned int i = 0; i < 2; i++)
         {
             SMBX64_ConfigPlayer plr;
             nextLine();
-            SMBX64::ReadUInt(&plr.controllerType, line);
+            SMBX64_Read(ParseUInt, plr.controllerType, "controller type");
             nextLine();
-            SMBX64::ReadUInt(&plr.k_up, line);
+            SMBX64_Read(ParseUInt, plr.k_up, "key up");
             nextLine();
-            SMBX64::ReadUInt(&plr.k_down, line);
+            SMBX64_Read(ParseUInt, plr.k_down, "key down");
             nextLine();
-            SMBX64::ReadUInt(&plr.k_left, line);
+            SMBX64_Read(ParseUInt, plr.k_left, "key left");
             nextLine();
-            SMBX64::ReadUInt(&plr.k_right, line);
+            SMBX64_Read(ParseUInt, plr.k_right, "key right");
             nextLine();
-            SMBX64::ReadUInt(&plr.k_run, line);
+            SMBX64_Read(ParseUInt, plr.k_run, "key run");
             nextLine();
-            SMBX64::ReadUInt(&plr.k_jump, line);
+            SMBX64_Read(ParseUInt, plr.k_jump, "key jump");
             nextLine();
-            SMBX64::ReadUInt(&plr.k_drop, line);
+            SMBX64_Read(ParseUInt, plr.k_drop, "key drop");
             nextLine();
-            SMBX64::ReadUInt(&plr.k_pause, line);
+            SMBX64_Read(ParseUInt, plr.k_pause, "key pause");
 
             if(ge(19))
             {
                 nextLine();
-                SMBX64::ReadUInt(&plr.k_altjump, line);
+                SMBX64_Read(ParseUInt, plr.k_altjump, "key alt-jump");
                 nextLine();
-                SMBX64::ReadUInt(&plr.k_altrun, line);
+                SMBX64_Read(ParseUInt, plr.k_altrun, "key alt-run");
             }
 
             nextLine();
-            SMBX64::ReadUInt(&plr.j_run, line);
+            SMBX64_Read(ParseUInt, plr.j_run, "joystick run");
             nextLine();
-            SMBX64::ReadUInt(&plr.j_jump, line);
+            SMBX64_Read(ParseUInt, plr.j_jump, "joystick jump");
             nextLine();
-            SMBX64::ReadUInt(&plr.j_drop, line);
+            SMBX64_Read(ParseUInt, plr.j_drop, "joystick drop");
             nextLine();
-            SMBX64::ReadUInt(&plr.j_pause, line);
+            SMBX64_Read(ParseUInt, plr.j_pause, "joystick pause");
 
             if(ge(19))
             {
                 nextLine();
-                SMBX64::ReadUInt(&plr.j_altjump, line);
+                SMBX64_Read(ParseUInt, plr.j_altjump, "joystick alt-jump");
                 nextLine();
-                SMBX64::ReadUInt(&plr.j_altrun, line);
+                SMBX64_Read(ParseUInt, plr.j_altrun, "joystick alt-run");
             }
 
             plr.id = i + 1;
@@ -153,23 +170,13 @@ bool FileFormats::ReadSMBX64ConfigFile(PGE_FileFormats_misc::TextInput &in, SMBX
     }
     catch(const std::exception &err)
     {
-        if(file_format > 0)
-            FileData.meta.ERROR_info = "Detected file format: SMBX-" + fromNum(file_format) + " is invalid\n";
-        else
-            FileData.meta.ERROR_info = "It is not an SMBX game settings file\n";
-
-#ifdef PGE_FILES_QT
-        FileData.meta.ERROR_info += QString::fromStdString(exception_to_pretty_string(err));
-#else
-        FileData.meta.ERROR_info += exception_to_pretty_string(err);
-#endif
-        FileData.meta.ERROR_linenum = in.getCurrentLineNumber();
-        FileData.meta.ERROR_linedata = std::move(line);
-        FileData.meta.ReadFileValid = false;
-        PGE_CutLength(FileData.meta.ERROR_linedata, 50);
-        PGE_FilterBinary(FileData.meta.ERROR_linedata);
+        SMBX64::SetReadError(FileData.meta, "game settings", file_format, err, in.getCurrentLineNumber(), line);
         return false;
     }
+
+badfile:
+    SMBX64::SetReadError(FileData.meta, "game settings", file_format, parse_error, in.getCurrentLineNumber(), line);
+    return false;
 }
 
 //*********************************************************
@@ -53,7 +53,7 @@ bool FileFormats::ReadSMBX64WldFileHeader(const PGESTRING &filePath, WorldData &
     return ReadSMBX64WldFileHeaderT(inf, FileData);
 }
 
-bool FileFormats::ReadSMBX64WldFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData)
+bool FileFormats::ReadSMBX64WldFileHeaderRaw(const PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData)
 {
     FileData.meta.ERROR_info.clear();
     CreateWorldHeader(FileData);
@@ -70,6 +70,23 @@ bool FileFormats::ReadSMBX64WldFileHeaderRaw(PGESTRING &rawdata, const PGESTRING
     return ReadSMBX64WldFileHeaderT(inf, FileData);
 }
 
+bool FileFormats::ReadSMBX64WldFileHeaderRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, WorldData &FileData)
+{
+    FileData.meta.ERROR_info.clear();
+    CreateWorldHeader(FileData);
+    FileData.meta.RecentFormat = LevelData::SMBX64;
+    FileData.meta.RecentFormatVersion = 64;
+    PGE_FileFormats_misc::ViewTextInput inf;
+
+    if(!inf.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ERROR_info = "Can't open file";
+        FileData.meta.ReadFileValid = false;
+        return false;
+    }
+    return ReadSMBX64WldFileHeaderT(inf, FileData);
+}
+
 bool FileFormats::ReadSMBX64WldFileHeaderT(PGE_FileFormats_misc::TextInput &inf, WorldData &FileData)
 {
     PGE_FileFormats_misc::FileInfo in_1(inf.getFilePath());
@@ -91,7 +108,7 @@ bool FileFormats::ReadSMBX64WldFileHeaderT(PGE_FileFormats_misc::TextInput &inf,
     try
     {
         nextLineH();   //Read first Line
-        SMBX64::ReadUInt(&file_format, line); //File format number
+        SMBX64_Read(ParseUInt, file_format, "file format"); //File format number
         FileData.meta.RecentFormatVersion = file_format;
 
         nextLineH();
@@ -100,17 +117,17 @@ bool FileFormats::ReadSMBX64WldFileHeaderT(PGE_FileFormats_misc::TextInput &inf,
         if(ge(55))
         {
             nextLineH();
-            SMBX64::ReadCSVBool(&FileData.nocharacter1, line);//Edisode without Mario
+            SMBX64_Read(ParseCSVBool, FileData.nocharacter1, "no Mario");//Edisode without Mario
             nextLineH();
-            SMBX64::ReadCSVBool(&FileData.nocharacter2, line);//Edisode without Luigi
+            SMBX64_Read(ParseCSVBool, FileData.nocharacter2, "no Luigi");//Edisode without Luigi
             nextLineH();
-            SMBX64::ReadCSVBool(&FileData.nocharacter3, line);//Edisode without Peach
+            SMBX64_Read(ParseCSVBool, FileData.nocharacter3, "no Peach");//Edisode without Peach
             nextLineH();
-            SMBX64::ReadCSVBool(&FileData.nocharacter4, line);//Edisode without Toad
+            SMBX64_Read(ParseCSVBool, FileData.nocharacter4, "no Toad");//Edisode without Toad
             if(ge(56))
             {
                 nextLineH();
-                SMBX64::ReadCSVBool(&FileData.nocharacter5, line);//Edisode without Link
+                SMBX64_Read(ParseCSVBool, FileData.nocharacter5, "no Link");//Edisode without Link
             }
             //Convert into the bool array
             FileData.nocharacter.push_back(FileData.nocharacter1);
@@ -125,15 +142,15 @@ bool FileFormats::ReadSMBX64WldFileHeaderT(PGE_FileFormats_misc::TextInput &inf,
             nextLineH();
             SMBX64::ReadStr(&FileData.IntroLevel_file, line);//Autostart level
             nextLineH();
-            SMBX64::ReadCSVBool(&FileData.HubStyledWorld, line); //Don't use world map on this episode
+            SMBX64_Read(ParseCSVBool, FileData.HubStyledWorld, "hub world"); //Don't use world map on this episode
             nextLineH();
-            SMBX64::ReadCSVBool(&FileData.restartlevel, line);//Restart level on playable character's death
+            SMBX64_Read(ParseCSVBool, FileData.restartlevel, "restart level on death");//Restart level on playable character's death
         }
 
         if(ge(20))
         {
             nextLineH();
-            SMBX64::ReadUInt(&FileData.stars, line);//Stars number
+            SMBX64_Read(ParseUInt, FileData.stars, "stars");//Stars number
         }
 
         if(file_format >= 17)
@@ -162,22 +179,13 @@ bool FileFormats::ReadSMBX64WldFileHeaderT(PGE_FileFormats_misc::TextInput &inf,
     }
     catch(const std::exception &err)
     {
-        if(file_format > 0)
-            FileData.meta.ERROR_info = "Detected file format: SMBX-" + fromNum(file_format) + " is invalid\n";
-        else
-            FileData.meta.ERROR_info = "It is not an SMBX world map file\n";
-#ifdef PGE_FILES_QT
-        FileData.meta.ERROR_info += QString::fromStdString(exception_to_pretty_string(err));
-#else
-        FileData.meta.ERROR_info += exception_to_pretty_string(err);
-#endif
-        FileData.meta.ERROR_linenum = inf.getCurrentLineNumber();
-        FileData.meta.ERROR_linedata = std::move(line);
-        FileData.meta.ReadFileValid = false;
-        PGE_CutLength(FileData.meta.ERROR_linedata, 50);
-        PGE_FilterBinary(FileData.meta.ERROR_linedata);
+        SMBX64::SetReadError(FileData.meta, "world map", file_format, err, inf.getCurrentLineNumber(), line);
         return false;
     }
+
+badfile:
+    SMBX64::SetReadError(FileData.meta, "world map", file_format, parse_error, inf.getCurrentLineNumber(), line);
+    return false;
 #undef nextLineH
 }
 
@@ -198,7 +206,7 @@ bool FileFormats::ReadSMBX64WldFileF(const PGESTRING &filePath, WorldData &FileD
     return ReadSMBX64WldFile(file, FileData);
 }
 
-bool FileFormats::ReadSMBX64WldFileRaw(PGESTRING &rawdata, const PGESTRING &filePath,  WorldData &FileData)
+bool FileFormats::ReadSMBX64WldFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath,  WorldData &FileData)
 {
     PGE_FileFormats_misc::RawTextInput file;
     FileData.meta.ERROR_info.clear();
@@ -213,6 +221,21 @@ bool FileFormats::ReadSMBX64WldFileRaw(PGESTRING &rawdata, const PGESTRING &file
     return ReadSMBX64WldFile(file, FileData);
 }
 
+bool FileFormats::ReadSMBX64WldFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, WorldData &FileData)
+{
+    PGE_FileFormats_misc::ViewTextInput file;
+    FileData.meta.ERROR_info.clear();
+    if(!file.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ERROR_info = "Failed to open raw string for read";
+        FileData.meta.ERROR_linedata.clear();
+        FileData.meta.ERROR_linenum = -1;
+        FileData.meta.ReadFileValid = false;
+        return false;
+    }
+    return ReadSMBX64WldFile(file, FileData);
+}
+
 bool FileFormats::ReadSMBX64WldFile(PGE_FileFormats_misc::TextInput &in, WorldData &FileData)
 {
     SMBX64_FileBegin();
@@ -248,7 +271,7 @@ bool FileFormats::ReadSMBX64WldFile(PGE_FileFormats_misc::TextInput &in, WorldDa
         ///////////////////////////////////////Begin file///////////////////////////////////////
         //File format number
         nextLine();
-        SMBX64::ReadUInt(&file_format, line);
+        SMBX64_Read(ParseUInt, file_format, "file format");
         FileData.meta.RecentFormatVersion = file_format;
 
         //Episode title
@@ -258,17 +281,17 @@ bool FileFormats::ReadSMBX64WldFile(PGE_FileFormats_misc::TextInput &in, WorldDa
         if(ge(55))
         {
             nextLine();
-            SMBX64::ReadCSVBool(&FileData.nocharacter1, line);//Edisode without Mario
+            SMBX64_Read(ParseCSVBool, FileData.nocharacter1, "no Mario");//Edisode without Mario
             nextLine();
-            SMBX64::ReadCSVBool(&FileData.nocharacter2, line);//Edisode without Luigi
+            SMBX64_Read(ParseCSVBool, FileData.nocharacter2, "no Luigi");//Edisode without Luigi
             nextLine();
-            SMBX64::ReadCSVBool(&FileData.nocharacter3, line);//Edisode without Peach
+            SMBX64_Read(ParseCSVBool, FileData.nocharacter3, "no Peach");//Edisode without Peach
             nextLine();
-            SMBX64::ReadCSVBool(&FileData.nocharacter4, line);//Edisode without Toad
+            SMBX64_Read(ParseCSVBool, FileData.nocharacter4, "no Toad");//Edisode without Toad
             if(ge(56))
             {
                 nextLine();
-                SMBX64::ReadCSVBool(&FileData.nocharacter5, line);//Edisode without Link
+                SMBX64_Read(ParseCSVBool, FileData.nocharacter5, "no Link");//Edisode without Link
             }
             //Convert into the bool array
             FileData.nocharacter.push_back(FileData.nocharacter1);
@@ -283,15 +306,15 @@ bool FileFormats::ReadSMBX64WldFile(PGE_FileFormats_misc::TextInput &in, WorldDa
             nextLine();
             SMBX64::ReadStr(&FileData.IntroLevel_file, line);//Autostart level
             nextLine();
-            SMBX64::ReadCSVBool(&FileData.HubStyledWorld, line); //Don't use world map on this episode
+            SMBX64_Read(ParseCSVBool, FileData.HubStyledWorld, "hub world"); //Don't use world map on this episode
             nextLine();
-            SMBX64::ReadCSVBool(&FileData.restartlevel, line);//Restart level on playable character's death
+            SMBX64_Read(ParseCSVBool, FileData.restartlevel, "restart level on death");//Restart level on playable character's death
         }
 
         if(ge(20))
         {
             nextLine();
-            SMBX64::ReadUInt(&FileData.stars, line);//Stars number
+            SMBX64_Read(ParseUInt, FileData.stars, "stars");//Stars number
         }
 
         if(file_format >= 17)
@@ -321,11 +344,11 @@ bool FileFormats::ReadSMBX64WldFile(PGE_FileFormats_misc::TextInput &in, WorldDa
         while((line != "next") && (!in.eof()))
         {
             tile = CreateWldTile();
-            SMBX64::ReadSIntFromFloat(&tile.x, line);//Tile x
+            SMBX64_Read(ParseSIntFromFloat, tile.x, "tile X");//Tile x
             nextLine();
-            SMBX64::ReadSIntFromFloat(&tile.y, line);//Tile y
+            SMBX64_Read(ParseSIntFromFloat, tile.y, "tile Y");//Tile y
             nextLine();
-            SMBX64::ReadUInt(&tile.id, line);//Tile ID
+            SMBX64_Read(ParseUInt, tile.id, "tile ID");//Tile ID
 
             tile.meta.array_id = FileData.tile_array_id;
             FileData.tile_array_id++;
@@ -340,11 +363,11 @@ bool FileFormats::ReadSMBX64WldFile(PGE_FileFormats_misc::TextInput &in, WorldDa
         while((line != "next")  && (!in.eof()))
         {
             scen = CreateWldScenery();
-            SMBX64::ReadSIntFromFloat(&scen.x, line);//Scenery x
+            SMBX64_Read(ParseSIntFromFloat, scen.x, "scenery X");//Scenery x
             nextLine();
-            SMBX64::ReadSIntFromFloat(&scen.y, line);//Scenery y
+            SMBX64_Read(ParseSIntFromFloat, scen.y, "scenery Y");//Scenery y
             nextLine();
-            SMBX64::ReadUInt(&scen.id, line);//Scenery ID
+            SMBX64_Read(ParseUInt, scen.id, "scenery ID");//Scenery ID
 
             scen.meta.array_id = FileData.scene_array_id;
             FileData.scene_array_id++;
@@ -360,11 +383,11 @@ bool FileFormats::ReadSMBX64WldFile(PGE_FileFormats_misc::TextInput &in, WorldDa
         while((line != "next") && (!in.eof()))
         {
             pathitem = CreateWldPath();
-            SMBX64::ReadSIntFromFloat(&pathitem.x, line);//Path x
+            SMBX64_Read(ParseSIntFromFloat, pathitem.x, "path X");//Path x
             nextLine();
-            SMBX64::ReadSIntFromFloat(&pathitem.y, line);//Path y
+            SMBX64_Read(ParseSIntFromFloat, pathitem.y, "path Y");//Path y
             nextLine();
-            SMBX64::ReadUInt(&pathitem.id, line); //Path ID
+            SMBX64_Read(ParseUInt, pathitem.id, "path ID"); //Path ID
 
             pathitem.meta.array_id = FileData.path_array_id;
             FileData.path_array_id++;
@@ -381,43 +404,43 @@ bool FileFormats::ReadSMBX64WldFile(PGE_FileFormats_misc::TextInput &in, WorldDa
         {
             lvlitem = CreateWldLevel();
 
-            SMBX64::ReadSIntFromFloat(&lvlitem.x, line);//Level x
+            SMBX64_Read(ParseSIntFromFloat, lvlitem.x, "level X");//Level x
             nextLine();
-            SMBX64::ReadSIntFromFloat(&lvlitem.y, line);//Level y
+            SMBX64_Read(ParseSIntFromFloat, lvlitem.y, "level Y");//Level y
             nextLine();
-            SMBX64::ReadUInt(&lvlitem.id, line);//Level ID
+            SMBX64_Read(ParseUInt, lvlitem.id, "level ID");//Level ID
             nextLine();
             SMBX64::ReadStr(&lvlitem.lvlfile, line);//Level file
             nextLine();
             SMBX64::ReadStr(&lvlitem.title, line);//Level title
             nextLine();
-            SMBX64::ReadSInt(&lvlitem.top_exit, line);//Top exit
+            SMBX64_Read(ParseSInt, lvlitem.top_exit, "level top exit");//Top exit
             nextLine();
-            SMBX64::ReadSInt(&lvlitem.left_exit, line);//Left exit
+            SMBX64_Read(ParseSInt, lvlitem.left_exit, "level left exit");//Left exit
             nextLine();
-            SMBX64::ReadSInt(&lvlitem.bottom_exit, line);//bottom exit
+            SMBX64_Read(ParseSInt, lvlitem.bottom_exit, "level bottom exit");//bottom exit
             nextLine();
-            SMBX64::ReadSInt(&lvlitem.right_exit, line);//right exit
+            SMBX64_Read(ParseSInt, lvlitem.right_exit, "level right exit");//right exit
             if(ge(4))
             {
                 nextLine();    //Enter via Level's warp
-                SMBX64::ReadUInt(&lvlitem.entertowarp, line);
+                SMBX64_Read(ParseUInt, lvlitem.entertowarp, "level entrance warp");
             }
 
             if(ge(22))
             {
                 nextLine();
-                SMBX64::ReadCSVBool(&lvlitem.alwaysVisible, line);//Always Visible
+                SMBX64_Read(ParseCSVBool, lvlitem.alwaysVisible, "level always visible");//Always Visible
                 nextLine();
-                SMBX64::ReadCSVBool(&lvlitem.pathbg, line);//Path background
+                SMBX64_Read(ParseCSVBool, lvlitem.pathbg, "level path background");//Path background
                 nextLine();
-                SMBX64::ReadCSVBool(&lvlitem.gamestart, line);//Game start point
+                SMBX64_Read(ParseCSVBool, lvlitem.gamestart, "level game start");//Game start point
                 nextLine();
-                SMBX64::ReadSInt(&lvlitem.gotox, line);//Goto x on World map
+                SMBX64_Read(ParseSInt, lvlitem.gotox, "level go-to X");//Goto x on World map
                 nextLine();
-                SMBX64::ReadSInt(&lvlitem.gotoy, line);//Goto y on World map
+                SMBX64_Read(ParseSInt, lvlitem.gotoy, "level go-to Y");//Goto y on World map
                 nextLine();
-                SMBX64::ReadCSVBool(&lvlitem.bigpathbg, line);//Big Path background
+                SMBX64_Read(ParseCSVBool, lvlitem.bigpathbg, "level big path background");//Big Path background
             }
             else
             {
@@ -439,11 +462,11 @@ bool FileFormats::ReadSMBX64WldFile(PGE_FileFormats_misc::TextInput &in, WorldDa
         while((line != "next") && (!IsEmpty(line)) && (!in.eof()))
         {
             musicbox = CreateWldMusicbox();
-            SMBX64::ReadSIntFromFloat(&musicbox.x, line);//MusicBox x
+            SMBX64_Read(ParseSIntFromFloat, musicbox.x, "music box X");//MusicBox x
             nextLine();
-            SMBX64::ReadSIntFromFloat(&musicbox.y, line);//MusicBox y
+            SMBX64_Read(ParseSIntFromFloat, musicbox.y, "music box Y");//MusicBox y
             nextLine();
-            SMBX64::ReadUInt(&musicbox.id, line);//MusicBox ID
+            SMBX64_Read(ParseUInt, musicbox.id, "music box ID");//MusicBox ID
 
             musicbox.meta.array_id = FileData.musicbox_array_id;
             FileData.musicbox_array_id++;
@@ -460,22 +483,13 @@ bool FileFormats::ReadSMBX64WldFile(PGE_FileFormats_misc::TextInput &in, WorldDa
     }
     catch(const std::exception &err)
     {
-        if(file_format > 0)
-            FileData.meta.ERROR_info = "Detected file format: SMBX-" + fromNum(file_format) + " is invalid\n";
-        else
-            FileData.meta.ERROR_info = "It is not an SMBX world map file\n";
-#ifdef PGE_FILES_QT
-        FileData.meta.ERROR_info += QString::fromStdString(exception_to_pretty_string(err));
-#else
-        FileData.meta.ERROR_info += exception_to_pretty_string(err);
-#endif
-        FileData.meta.ERROR_linenum  = in.getCurrentLineNumber();
-        FileData.meta.ERROR_linedata = std::move(line);
-        FileData.meta.ReadFileValid  = false;
-        PGE_CutLength(FileData.meta.ERROR_linedata, 50);
-        PGE_FilterBinary(FileData.meta.ERROR_linedata);
+        SMBX64::SetReadError(FileData.meta, "world map", file_format, err, in.getCurrentLineNumber(), line);
         return false;
     }
+
+badfile:
+    SMBX64::SetReadError(FileData.meta, "world map", file_format, parse_error, in.getCurrentLineNumber(), line);
+    return false;
 }
 
 
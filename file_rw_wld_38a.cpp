@@ -51,7 +51,7 @@ bool FileFormats::ReadSMBX38AWldFileHeader(const PGESTRING &filePath, WorldData&
     return ReadSMBX38AWldFileHeaderT(inf, FileData);
 }
 
-bool FileFormats::ReadSMBX38AWldFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData)
+bool FileFormats::ReadSMBX38AWldFileHeaderRaw(const PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData)
 {
     FileData.meta.ERROR_info.clear();
     CreateWorldHeader(FileData);
@@ -68,6 +68,23 @@ bool FileFormats::ReadSMBX38AWldFileHeaderRaw(PGESTRING &rawdata, const PGESTRIN
     return ReadSMBX38AWldFileHeaderT(inf, FileData);
 }
 
+bool FileFormats::ReadSMBX38AWldFileHeaderRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, WorldData &FileData)
+{
+    FileData.meta.ERROR_info.clear();
+    CreateWorldHeader(FileData);
+    FileData.meta.RecentFormat = LevelData::SMBX38A;
+    PGE_FileFormats_misc::ViewTextInput inf;
+
+    if(!inf.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ERROR_info = "Can't open file";
+        FileData.meta.ReadFileValid = false;
+        return false;
+    }
+
+    return ReadSMBX38AWldFileHeaderT(inf, FileData);
+}
+
 bool FileFormats::ReadSMBX38AWldFileHeaderT(PGE_FileFormats_misc::TextInput &inf, WorldData &FileData)
 {
 #if !defined(_MSC_VER) || _MSC_VER > 1800
@@ -99,7 +116,7 @@ bool FileFormats::ReadSMBX38AWldFileHeaderT(PGE_FileFormats_misc::TextInput &inf
 
         while(!inf.eof())
         {
-            PGESTRING identifier = dataReader.ReadField<PGESTRING>(1);
+            CSVPGESTRINGField identifier = dataReader.ReadField<CSVPGESTRINGField>(1);
 
             if(identifier == "WS1")
             {
@@ -182,8 +199,8 @@ bool FileFormats::ReadSMBX38AWldFileHeaderT(PGE_FileFormats_misc::TextInput &inf
                                         //          xxxxxx=string1,string2...stringn
                                         MakeCSVPostProcessor(&cheatsList, [&](PGESTRING& value)
                                         {
-                                            PGESTRING list = PGE_URLDEC(value);
-                                            PGE_SPLITSTRING(FileData.cheatsList, list, ",");
+                                            PGE_URLDEC_INPLACE(value);
+                                            PGE_SPLITSTRING(FileData.cheatsList, value, ",");
                                         })
                                         );
             }
@@ -240,7 +257,7 @@ bool FileFormats::ReadSMBX38AWldFileF(const PGESTRING &filePath, WorldData& File
     return ReadSMBX38AWldFile(file, FileData);
 }
 
-bool FileFormats::ReadSMBX38AWldFileRaw(PGESTRING& rawdata, const PGESTRING &filePath, WorldData& FileData)
+bool FileFormats::ReadSMBX38AWldFileRaw(const PGESTRING& rawdata, const PGESTRING &filePath, WorldData& FileData)
 {
     PGE_FileFormats_misc::RawTextInput file;
     FileData.meta.ERROR_info.clear();
@@ -257,6 +274,23 @@ bool FileFormats::ReadSMBX38AWldFileRaw(PGESTRING& rawdata, const PGESTRING &fil
     return ReadSMBX38AWldFile(file, FileData);
 }
 
+bool FileFormats::ReadSMBX38AWldFileRaw(const char* rawdata, size_t rawdataSize, const PGESTRING &filePath, WorldData& FileData)
+{
+    PGE_FileFormats_misc::ViewTextInput file;
+    FileData.meta.ERROR_info.clear();
+
+    if(!file.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ERROR_info = "Failed to open raw string for read";
+        FileData.meta.ERROR_linedata.clear();
+        FileData.meta.ERROR_linenum = -1;
+        FileData.meta.ReadFileValid = false;
+        return false;
+    }
+
+    return ReadSMBX38AWldFile(file, FileData);
+}
+
 bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldData& FileData)
 {
     SMBX38A_FileBeginN();
@@ -297,7 +331,7 @@ bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldD
     WorldEvent38A       event;
     WorldItemSetup38A   customcfg;
 
-    PGESTRING           identifier;
+    uint32_t            recordId = 0;
 
     //Add path data
     if(!IsEmpty(filePath))
@@ -326,9 +360,11 @@ bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldD
 
         while(!in.eof())
         {
-            identifier = dataReader.ReadField<PGESTRING>(1);
+            recordId = SMBX38A_RecordId(dataReader.ReadField<CSVPGESTRINGField>(1));
 
-            if(identifier == "WS1")
+            switch(recordId)
+            {
+            case SMBX38A_RecordId("WS1"):
             {
                 dataReader.ReadDataLine(CSVDiscard(), // Skip the first field (this is already "identifier")
                                         //  wn=episode name[***urlencode!***]
@@ -379,8 +415,9 @@ bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldD
                                                         &FileData.saveLocker
                                         );
                 FileData.charactersFromS64();
+                break;
             }
-            else if(identifier == "WS2")
+            case SMBX38A_RecordId("WS2"):
             {
                 dataReader.ReadDataLine(CSVDiscard(),
                                         //  credits=[1]
@@ -398,8 +435,9 @@ bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldD
                                         }),
                                         MakeCSVOptionalEmpty(&FileData.authors_music, "", nullptr, PGEUrlDecodeFunc)
                 );
+                break;
             }
-            else if(identifier == "WS3")
+            case SMBX38A_RecordId("WS3"):
             {
                 PGESTRING cheatsList;
                 dataReader.ReadDataLine(CSVDiscard(),
@@ -407,12 +445,13 @@ bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldD
                                         //          xxxxxx=string1,string2...stringn
                                         MakeCSVPostProcessor(&cheatsList, [&](PGESTRING& value)
                                         {
-                                            PGESTRING list = PGE_URLDEC(value);
-                                            PGE_SPLITSTRING(FileData.cheatsList, list, ",");
+                                            PGE_URLDEC_INPLACE(value);
+                                            PGE_SPLITSTRING(FileData.cheatsList, value, ",");
                                         })
                                         );
+                break;
             }
-            else if(identifier == "WS4")
+            case SMBX38A_RecordId("WS4"):
             {
                 dataReader.ReadDataLine(CSVDiscard(),
                                         //    se=save locker syntax[***urlencode!***][syntax]
@@ -420,8 +459,9 @@ bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldD
                                         //    msg=message when save was locked[***urlencode!***]
                                         MakeCSVPostProcessor(&FileData.saveLockerMsg, PGEUrlDecodeFunc)
                                         );
+                break;
             }
-            else if(identifier == "T")
+            case SMBX38A_RecordId("T"):
             {
                 tile = WorldTerrainTile();
                 dataReader.ReadDataLine(CSVDiscard(),
@@ -436,8 +476,9 @@ bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldD
                                         );
                 tile.meta.array_id = FileData.tile_array_id++;
                 FileData.tiles.push_back(tile);
+                break;
             }
-            else if(identifier == "S")
+            case SMBX38A_RecordId("S"):
             {
                 scen = WorldScenery();
                 dataReader.ReadDataLine(CSVDiscard(),
@@ -452,8 +493,9 @@ bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldD
                                         );
                 scen.meta.array_id = FileData.scene_array_id++;
                 FileData.scenery.push_back(scen);
+                break;
             }
-            else if(identifier == "P")
+            case SMBX38A_RecordId("P"):
             {
                 pathitem = WorldPathTile();
                 dataReader.ReadDataLine(CSVDiscard(),
@@ -468,8 +510,9 @@ bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldD
                                         );
                 pathitem.meta.array_id = FileData.path_array_id++;
                 FileData.paths.push_back(pathitem);
+                break;
             }
-            else if(identifier == "M")
+            case SMBX38A_RecordId("M"):
             {
                 musicbox = WorldMusicBox();
                 arearect = WorldAreaRect();
@@ -535,8 +578,9 @@ bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldD
                     arearect.meta.array_id = FileData.arearect_array_id++;
                     FileData.arearects.push_back(arearect);
                 }
+                break;
             }
-            else if(identifier == "L")
+            case SMBX38A_RecordId("L"):
             {
                 //L|id[,dx,dy]|x|y|fn|n|eu\el\ed\er|wx|wy|wlz|bg,pb,av,ls,f,nsc,otl,li,lcm|s|Layer|Lmt
                 lvlitem = WorldLevelTile();
@@ -672,8 +716,9 @@ bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldD
                                         );
                 lvlitem.meta.array_id = FileData.level_array_id++;
                 FileData.levels.push_back(lvlitem);
+                break;
             }
-            else if(identifier == "WL")
+            case SMBX38A_RecordId("WL"):
             {
                 layer = WorldLayer();
                 dataReader.ReadDataLine(CSVDiscard(),
@@ -682,8 +727,9 @@ bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldD
                                         );
                 layer.meta.array_id = FileData.layers_array_id++;
                 FileData.layers.push_back(layer);
+                break;
             }
-            else if(identifier == "WE")
+            case SMBX38A_RecordId("WE"):
             {
                 event = WorldEvent38A();
                 //TODO: Implement world map events support
@@ -731,8 +777,11 @@ bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldD
                                                             );
                 event.meta.array_id = FileData.events38A_array_id++;
                 FileData.events38A.push_back(event);
+                break;
             }
-            else if((identifier == "WCT") || (identifier == "WCS") || (identifier == "WCL") )
+            case SMBX38A_RecordId("WCT"):
+            case SMBX38A_RecordId("WCS"):
+            case SMBX38A_RecordId("WCL"):
             {
                 //custom object data:
                 //    WCT|id|data	:custom tile
@@ -744,9 +793,9 @@ bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldD
                 //    [HEX]=0002	:gfxheight
                 //    [HEX]=0003	:frames
                 customcfg = WorldItemSetup38A();
-                if(identifier == "WCT")
+                if(recordId == SMBX38A_RecordId("WCT"))
                     customcfg.type = WorldItemSetup38A::TERRAIN;
-                else if(identifier == "WCS")
+                else if(recordId == SMBX38A_RecordId("WCS"))
                     customcfg.type = WorldItemSetup38A::SCENERY;
                 else
                     customcfg.type = WorldItemSetup38A::LEVEL;
@@ -761,13 +810,16 @@ bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldD
                                                         })
                                        );
                 FileData.custom38A_configs.push_back(customcfg);
+                break;
             }
-            else
+            default:
             {
                 // Unsupported line, just keep it
                 PGESTRING str;
                 dataReader.ReadRawLine(str);
                 FileData.unsupported_38a_lines.push_back(str);
+                break;
+            }
             }
         }//while is not EOF
     }
@@ -814,8 +866,8 @@ bool FileFormats::ReadSMBX38AWldFile(PGE_FileFormats_misc::TextInput& in, WorldD
         FileData.meta.ReadFileValid = false;
         FileData.meta.ERROR_info = "Invalid file format, detected file SMBX-38A-" + fromNum(FileData.meta.RecentFormatVersion) + " format\n"
                                    "Caused by unknown exception\n";
-        if(!IsEmpty(identifier))
-            FileData.meta.ERROR_info += "\n Field type " + identifier;
+        if(recordId != 0)
+            FileData.meta.ERROR_info += "\n Field type " + SMBX38A_RecordIdToString(recordId);
         // If we were unable to find error line number from the exception, then get the line number from the file reader.
         if(FileData.meta.ERROR_linenum == 0)
             FileData.meta.ERROR_linenum = in.getCurrentLineNumber();
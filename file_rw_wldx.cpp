@@ -59,7 +59,7 @@ bool FileFormats::ReadExtendedWldFileHeader(const PGESTRING &filePath, WorldData
     return ReadExtendedWldFileHeaderT(inf, FileData);
 }
 
-bool FileFormats::ReadExtendedWldFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData)
+bool FileFormats::ReadExtendedWldFileHeaderRaw(const PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData)
 {
     CreateWorldHeader(FileData);
     FileData.meta.RecentFormat = LevelData::PGEX;
@@ -75,6 +75,22 @@ bool FileFormats::ReadExtendedWldFileHeaderRaw(PGESTRING &rawdata, const PGESTRI
     return ReadExtendedWldFileHeaderT(inf, FileData);
 }
 
+bool FileFormats::ReadExtendedWldFileHeaderRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, WorldData &FileData)
+{
+    CreateWorldHeader(FileData);
+    FileData.meta.RecentFormat = LevelData::PGEX;
+    PGE_FileFormats_misc::ViewTextInput inf;
+
+    if(!inf.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ERROR_info = "Can't open file";
+        FileData.meta.ReadFileValid = false;
+        return false;
+    }
+
+    return ReadExtendedWldFileHeaderT(inf, FileData);
+}
+
 bool FileFormats::ReadExtendedWldFileHeaderT(PGE_FileFormats_misc::TextInput &inf, WorldData &FileData)
 {
     PGESTRING line;
@@ -135,9 +151,7 @@ bool FileFormats::ReadExtendedWldFileHeaderT(PGE_FileFormats_misc::TextInput &in
             }
             else if(data[i][0] == "DC") //Disabled characters
             {
-                if(PGEFile::IsBoolArray(data[i][1]))
-                    FileData.nocharacter = PGEFile::X2BollArr(data[i][1]);
-                else
+                if(!PGEFile::X2BollArr(data[i][1], FileData.nocharacter))
                     goto badfile;
             }
             else if(data[i][0] == "IT") //Intro level
@@ -245,7 +259,7 @@ bool FileFormats::ReadExtendedWldFileF(const PGESTRING &filePath, WorldData &Fil
     return ReadExtendedWldFile(file, FileData);
 }
 
-bool FileFormats::ReadExtendedWldFileRaw(PGESTRING &rawdata, const PGESTRING &filePath,  WorldData &FileData)
+bool FileFormats::ReadExtendedWldFileRaw(const PGESTRING &rawdata, const PGESTRING &filePath,  WorldData &FileData)
 {
     PGE_FileFormats_misc::RawTextInput file;
     FileData.meta.ERROR_info.clear();
@@ -262,6 +276,23 @@ bool FileFormats::ReadExtendedWldFileRaw(PGESTRING &rawdata, const PGESTRING &fi
     return ReadExtendedWldFile(file, FileData);
 }
 
+bool FileFormats::ReadExtendedWldFileRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, WorldData &FileData)
+{
+    PGE_FileFormats_misc::ViewTextInput file;
+    FileData.meta.ERROR_info.clear();
+
+    if(!file.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ERROR_info = "Failed to open raw string for read";
+        FileData.meta.ERROR_linedata.clear();
+        FileData.meta.ERROR_linenum = -1;
+        FileData.meta.ReadFileValid = false;
+        return false;
+    }
+
+    return ReadExtendedWldFile(file, FileData);
+}
+
 bool FileFormats::ReadExtendedWldFile(PGE_FileFormats_misc::TextInput &in, WorldData &FileData)
 {
     PGESTRING errorString;
@@ -287,7 +318,7 @@ bool FileFormats::ReadExtendedWldFile(PGE_FileFormats_misc::TextInput &in, World
     WorldAreaRect arearect;
     WorldLevelTile lvlitem;
     ///////////////////////////////////////Begin file///////////////////////////////////////
-    PGEX_FileParseTree(in.readAll());
+    PGEX_FileParseStream(in);
     PGEX_FetchSection() //look sections
     {
         PGEX_FetchSection_begin()
@@ -350,9 +381,10 @@ bool FileFormats::ReadExtendedWldFile(PGE_FileFormats_misc::TextInput &in, World
             {
                 str_count++;
                 PGEX_ItemBegin(PGEFile::PGEX_Struct);
+                if(!x.values.empty())
+                    FileData.metaData.crash.used = true;
                 PGEX_Values() //Look markers and values
                 {
-                    FileData.metaData.crash.used = true;
                     PGEX_ValueBegin()
                     PGEX_BoolVal("UT", FileData.metaData.crash.untitled) //Untitled
                     PGEX_BoolVal("MD", FileData.metaData.crash.modifyed) //Modyfied
@@ -536,6 +568,7 @@ bool FileFormats::ReadExtendedWldFile(PGE_FileFormats_misc::TextInput &in, World
     FileData.meta.ReadFileValid = true;
     return true;
 badfile:    //If file format not corrects
+    PGEX_ValueError()
     FileData.meta.ERROR_info = errorString;
     FileData.meta.ERROR_linenum = str_count;
     FileData.meta.ERROR_linedata = line;
@@ -547,6 +580,67 @@ badfile:    //If file format not corrects
 
 
 
+bool FileFormats::ReadExtendedWldFile(PGE_FileFormats_misc::TextInput &in, WorldData &FileData, unsigned int threads)
+{
+    threads = PGEFile::parallelThreads(threads);
+    if(threads <= 1)
+        return ReadExtendedWldFile(in, FileData);
+
+    PGESTRING filePath = in.getFilePath();
+    PGESTRING rawData = in.readAll();
+    PGE_FileFormats_misc::RawTextInput file;
+    PGELIST<PGEFile::PGEX_Chunk> chunks;
+    PGESTRINGList sections;
+    //Sections which items are not depend on other data
+    sections.push_back("TILES");
+    sections.push_back("SCENERY");
+    sections.push_back("PATHS");
+    sections.push_back("MUSICBOXES");
+    sections.push_back("AREARECTS");
+    sections.push_back("LEVELS");
+
+    if(!PGEFile::splitToChunks(rawData, sections, threads, chunks) || (chunks.size() <= 2))
+    {
+        file.open(&rawData, filePath);
+        return ReadExtendedWldFile(file, FileData);
+    }
+
+    std::vector<WorldData> parts(static_cast<size_t>(chunks.size()));
+    std::vector<char> valid(static_cast<size_t>(chunks.size()), 0);
+
+    PGEFile::runParallel(chunks.size(), threads, [&](pge_size_t i)
+    {
+        PGE_FileFormats_misc::RawTextInput chunk;
+        chunk.open(&chunks[i].data, filePath);
+        valid[i] = ReadExtendedWldFile(chunk, i == 0 ? FileData : parts[i]);
+    });
+
+    for(size_t i = 0; i < valid.size(); i++)
+    {
+        if(!valid[i])
+        {
+            //Decode whole data again to report the error exactly like the serial reader does
+            file.open(&rawData, filePath);
+            return ReadExtendedWldFile(file, FileData);
+        }
+    }
+
+    for(size_t i = 1; i < parts.size(); i++)
+    {
+        WorldData &part = parts[i];
+        PGEFile::mergeChunkItems(FileData.tiles, part.tiles, FileData.tile_array_id);
+        PGEFile::mergeChunkItems(FileData.scenery, part.scenery, FileData.scene_array_id);
+        PGEFile::mergeChunkItems(FileData.paths, part.paths, FileData.path_array_id);
+        PGEFile::mergeChunkItems(FileData.music, part.music, FileData.musicbox_array_id);
+        PGEFile::mergeChunkItems(FileData.arearects, part.arearects, FileData.arearect_array_id);
+        PGEFile::mergeChunkItems(FileData.levels, part.levels, FileData.level_array_id);
+    }
+
+    return true;
+}
+
+
+
 //*********************************************************
 //****************WRITE FILE FORMAT************************
 //*********************************************************
@@ -581,15 +675,17 @@ bool FileFormats::WriteExtendedWldFileRaw(WorldData &FileData, PGESTRING &rawdat
 
 bool FileFormats::WriteExtendedWldFile(PGE_FileFormats_misc::TextOutput &out, WorldData &FileData)
 {
+    PGEXWriter w(out);
     pge_size_t i = 0;
     FileData.meta.RecentFormat = WorldData::PGEX;
 
     //HEAD section
     {
         PGESTRING outHeader;
+        PGEXWriter outHeaderWriter(outHeader);
 
         if(!IsEmpty(FileData.EpisodeTitle))
-            outHeader += PGEFile::value("TL", PGEFile::WriteStr(FileData.EpisodeTitle)); // Episode title
+            outHeaderWriter.writeStr("TL", FileData.EpisodeTitle); // Episode title
 
         {
             bool needToAdd = false;
@@ -600,228 +696,228 @@ bool FileFormats::WriteExtendedWldFile(PGE_FileFormats_misc::TextOutput &out, Wo
             }
 
             if(needToAdd)
-                outHeader += PGEFile::value("DC", PGEFile::WriteBoolArr(FileData.nocharacter)); // Disabled characters
+                outHeaderWriter.writeBoolArr("DC", FileData.nocharacter); // Disabled characters
         }
 
         if(!IsEmpty(FileData.IntroLevel_file))
-            outHeader += PGEFile::value("IT", PGEFile::WriteStr(FileData.IntroLevel_file)); // Intro level
+            outHeaderWriter.writeStr("IT", FileData.IntroLevel_file); // Intro level
         if(!IsEmpty(FileData.GameOverLevel_file))
-            outHeader += PGEFile::value("GO", PGEFile::WriteStr(FileData.GameOverLevel_file)); // Game Over level
+            outHeaderWriter.writeStr("GO", FileData.GameOverLevel_file); // Game Over level
         if(FileData.HubStyledWorld)
-            outHeader += PGEFile::value("HB", PGEFile::WriteBool(FileData.HubStyledWorld)); // Hub-styled episode
+            outHeaderWriter.writeBool("HB", FileData.HubStyledWorld); // Hub-styled episode
         if(FileData.restartlevel)
-            outHeader += PGEFile::value("RL", PGEFile::WriteBool(FileData.restartlevel)); // Restart on fail
+            outHeaderWriter.writeBool("RL", FileData.restartlevel); // Restart on fail
         if(FileData.stars > 0)
-            outHeader += PGEFile::value("SZ", PGEFile::WriteInt(FileData.stars));      // Total stars number
+            outHeaderWriter.writeInt("SZ", FileData.stars);      // Total stars number
         if(!IsEmpty(FileData.authors))
-            outHeader += PGEFile::value("CD", PGEFile::WriteStr(FileData.authors));   // Credits
+            outHeaderWriter.writeStr("CD", FileData.authors);   // Credits
         if(!IsEmpty(FileData.authors_music))
-            outHeader += PGEFile::value("CM", PGEFile::WriteStr(FileData.authors_music));   // Credits scene background music
+            outHeaderWriter.writeStr("CM", FileData.authors_music);   // Credits scene background music
         if(FileData.starsShowPolicy != WorldData::STARS_UNSPECIFIED)
-            outHeader += PGEFile::value("SSS", PGEFile::WriteInt(FileData.starsShowPolicy));
+            outHeaderWriter.writeInt("SSS", FileData.starsShowPolicy);
         if(!IsEmpty(FileData.custom_params))
-            outHeader += PGEFile::value("XTRA", PGEFile::WriteStr(FileData.custom_params));   // World-wide extra settings
+            outHeaderWriter.writeStr("XTRA", FileData.custom_params);   // World-wide extra settings
         if(!IsEmpty(FileData.meta.configPackId))
-            outHeader += PGEFile::value("CPID", PGEFile::WriteStr(FileData.meta.configPackId));
+            outHeaderWriter.writeStr("CPID", FileData.meta.configPackId);
 
         if(!IsEmpty(outHeader))
-            out << "HEAD\n" << outHeader << "\n" << "HEAD_END\n";
+            w << "HEAD\n" << outHeader << "\n" << "HEAD_END\n";
     }
 
     //////////////////////////////////////MetaData////////////////////////////////////////////////
     //Bookmarks
     if(!FileData.metaData.bookmarks.empty())
     {
-        out << "META_BOOKMARKS\n";
+        w << "META_BOOKMARKS\n";
 
         for(i = 0; i < FileData.metaData.bookmarks.size(); i++)
         {
             Bookmark &bm = FileData.metaData.bookmarks[i];
             //Bookmark name
-            out << PGEFile::value("BM", PGEFile::WriteStr(bm.bookmarkName));
-            out << PGEFile::value("X", PGEFile::WriteRoundFloat(bm.x));
-            out << PGEFile::value("Y", PGEFile::WriteRoundFloat(bm.y));
-            out << "\n";
+            w.writeStr("BM", bm.bookmarkName);
+            w.writeRoundFloat("X", bm.x);
+            w.writeRoundFloat("Y", bm.y);
+            w << "\n";
         }
 
-        out << "META_BOOKMARKS_END\n";
+        w << "META_BOOKMARKS_END\n";
     }
 
     //Some System information
     if(FileData.metaData.crash.used)
     {
-        out << "META_SYS_CRASH\n";
-        out << PGEFile::value("UT", PGEFile::WriteBool(FileData.metaData.crash.untitled));
-        out << PGEFile::value("MD", PGEFile::WriteBool(FileData.metaData.crash.modifyed));
-        out << PGEFile::value("FF", PGEFile::WriteInt(FileData.metaData.crash.fmtID));
-        out << PGEFile::value("FV", PGEFile::WriteInt(FileData.metaData.crash.fmtVer));
-        out << PGEFile::value("N",  PGEFile::WriteStr(FileData.metaData.crash.filename));
-        out << PGEFile::value("P",  PGEFile::WriteStr(FileData.metaData.crash.path));
-        out << PGEFile::value("FP", PGEFile::WriteStr(FileData.metaData.crash.fullPath));
-        out << "\n";
-        out << "META_SYS_CRASH_END\n";
+        w << "META_SYS_CRASH\n";
+        w.writeBool("UT", FileData.metaData.crash.untitled);
+        w.writeBool("MD", FileData.metaData.crash.modifyed);
+        w.writeInt("FF", FileData.metaData.crash.fmtID);
+        w.writeInt("FV", FileData.metaData.crash.fmtVer);
+        w.writeStr("N", FileData.metaData.crash.filename);
+        w.writeStr("P", FileData.metaData.crash.path);
+        w.writeStr("FP", FileData.metaData.crash.fullPath);
+        w << "\n";
+        w << "META_SYS_CRASH_END\n";
     }
     //////////////////////////////////////MetaData///END//////////////////////////////////////////
 
     if(!FileData.tiles.empty())
     {
-        out << "TILES\n";
+        w << "TILES\n";
 
         for(i = 0; i < FileData.tiles.size(); i++)
         {
             WorldTerrainTile &tt = FileData.tiles[i];
-            out << PGEFile::value("ID", PGEFile::WriteInt(tt.id));
-            out << PGEFile::value("X", PGEFile::WriteInt(tt.x));
-            out << PGEFile::value("Y", PGEFile::WriteInt(tt.y));
+            w.writeInt("ID", tt.id);
+            w.writeInt("X", tt.x);
+            w.writeInt("Y", tt.y);
             if(!IsEmpty(tt.meta.custom_params))
-                out << PGEFile::value("XTRA", PGEFile::WriteStr(tt.meta.custom_params));
-            out << "\n";
+                w.writeStr("XTRA", tt.meta.custom_params);
+            w << "\n";
         }
 
-        out << "TILES_END\n";
+        w << "TILES_END\n";
     }
 
     if(!FileData.scenery.empty())
     {
-        out << "SCENERY\n";
+        w << "SCENERY\n";
 
         for(i = 0; i < FileData.scenery.size(); i++)
         {
             WorldScenery &ws = FileData.scenery[i];
-            out << PGEFile::value("ID", PGEFile::WriteInt(ws.id));
-            out << PGEFile::value("X", PGEFile::WriteInt(ws.x));
-            out << PGEFile::value("Y", PGEFile::WriteInt(ws.y));
+            w.writeInt("ID", ws.id);
+            w.writeInt("X", ws.x);
+            w.writeInt("Y", ws.y);
             if(!IsEmpty(ws.meta.custom_params))
-                out << PGEFile::value("XTRA", PGEFile::WriteStr(ws.meta.custom_params));
-            out << "\n";
+                w.writeStr("XTRA", ws.meta.custom_params);
+            w << "\n";
         }
 
-        out << "SCENERY_END\n";
+        w << "SCENERY_END\n";
     }
 
     if(!FileData.paths.empty())
     {
-        out << "PATHS\n";
+        w << "PATHS\n";
 
         for(i = 0; i < FileData.paths.size(); i++)
         {
             WorldPathTile &wp = FileData.paths[i];
-            out << PGEFile::value("ID", PGEFile::WriteInt(wp.id));
-            out << PGEFile::value("X", PGEFile::WriteInt(wp.x));
-            out << PGEFile::value("Y", PGEFile::WriteInt(wp.y));
+            w.writeInt("ID", wp.id);
+            w.writeInt("X", wp.x);
+            w.writeInt("Y", wp.y);
             if(!IsEmpty(wp.meta.custom_params))
-                out << PGEFile::value("XTRA", PGEFile::WriteStr(wp.meta.custom_params));
-            out << "\n";
+                w.writeStr("XTRA", wp.meta.custom_params);
+            w << "\n";
         }
 
-        out << "PATHS_END\n";
+        w << "PATHS_END\n";
     }
 
     if(!FileData.music.empty())
     {
-        out << "MUSICBOXES\n";
+        w << "MUSICBOXES\n";
 
         for(i = 0; i < FileData.music.size(); i++)
         {
             WorldMusicBox &wm = FileData.music[i];
-            out << PGEFile::value("ID", PGEFile::WriteInt(wm.id));
-            out << PGEFile::value("X", PGEFile::WriteInt(wm.x));
-            out << PGEFile::value("Y", PGEFile::WriteInt(wm.y));
+            w.writeInt("ID", wm.id);
+            w.writeInt("X", wm.x);
+            w.writeInt("Y", wm.y);
             if(!IsEmpty(wm.music_file))
-                out << PGEFile::value("MF", PGEFile::WriteStr(wm.music_file));
+                w.writeStr("MF", wm.music_file);
             if(!IsEmpty(wm.meta.custom_params))
-                out << PGEFile::value("XTRA", PGEFile::WriteStr(wm.meta.custom_params));
-            out << "\n";
+                w.writeStr("XTRA", wm.meta.custom_params);
+            w << "\n";
         }
 
-        out << "MUSICBOXES_END\n";
+        w << "MUSICBOXES_END\n";
     }
 
     if(!FileData.arearects.empty())
     {
-        out << "AREARECTS\n";
+        w << "AREARECTS\n";
 
         WorldAreaRect defA;
 
         for(i = 0; i < FileData.arearects.size(); i++)
         {
             WorldAreaRect &a = FileData.arearects[i];
-            out << PGEFile::value("F", PGEFile::WriteInt(a.flags));
-            out << PGEFile::value("X", PGEFile::WriteInt(a.x));
-            out << PGEFile::value("Y", PGEFile::WriteInt(a.y));
-            out << PGEFile::value("W", PGEFile::WriteInt(a.w));
-            out << PGEFile::value("H", PGEFile::WriteInt(a.h));
+            w.writeInt("F", a.flags);
+            w.writeInt("X", a.x);
+            w.writeInt("Y", a.y);
+            w.writeInt("W", a.w);
+            w.writeInt("H", a.h);
 
             // unused stuff
             if(a.music_id)
-                out << PGEFile::value("MI", PGEFile::WriteInt(a.music_id));
+                w.writeInt("MI", a.music_id);
             if(!IsEmpty(a.music_file))
-                out << PGEFile::value("MF", PGEFile::WriteStr(a.music_file));
+                w.writeStr("MF", a.music_file);
             if(!IsEmpty(a.layer) && a.layer != defA.layer)
-                out << PGEFile::value("LR", PGEFile::WriteStr(a.layer));
+                w.writeStr("LR", a.layer);
             if(!IsEmpty(a.eventBreak))
-                out << PGEFile::value("EB", PGEFile::WriteStr(a.eventBreak));
+                w.writeStr("EB", a.eventBreak);
             if(!IsEmpty(a.eventWarp))
-                out << PGEFile::value("EW", PGEFile::WriteStr(a.eventWarp));
+                w.writeStr("EW", a.eventWarp);
             if(!IsEmpty(a.eventAnchor))
-                out << PGEFile::value("EA", PGEFile::WriteStr(a.eventAnchor));
+                w.writeStr("EA", a.eventAnchor);
             if(!IsEmpty(a.eventTouch))
-                out << PGEFile::value("ET", PGEFile::WriteStr(a.eventTouch));
+                w.writeStr("ET", a.eventTouch);
             if(a.eventTouchPolicy != defA.eventTouchPolicy)
-                out << PGEFile::value("TP", PGEFile::WriteInt(a.eventTouchPolicy));
+                w.writeInt("TP", a.eventTouchPolicy);
             if(!IsEmpty(a.meta.custom_params))
-                out << PGEFile::value("XTRA", PGEFile::WriteStr(a.meta.custom_params));
-            out << "\n";
+                w.writeStr("XTRA", a.meta.custom_params);
+            w << "\n";
         }
 
-        out << "AREARECTS_END\n";
+        w << "AREARECTS_END\n";
     }
 
     if(!FileData.levels.empty())
     {
-        out << "LEVELS\n";
+        w << "LEVELS\n";
         WorldLevelTile defLvl = CreateWldLevel();
 
         for(i = 0; i < FileData.levels.size(); i++)
         {
             WorldLevelTile &lt = FileData.levels[i];
-            out << PGEFile::value("ID", PGEFile::WriteInt(lt.id));
-            out << PGEFile::value("X",  PGEFile::WriteInt(lt.x));
-            out << PGEFile::value("Y",  PGEFile::WriteInt(lt.y));
+            w.writeInt("ID", lt.id);
+            w.writeInt("X", lt.x);
+            w.writeInt("Y", lt.y);
             if(!IsEmpty(lt.title))
-                out << PGEFile::value("LT", PGEFile::WriteStr(lt.title));
+                w.writeStr("LT", lt.title);
             if(!IsEmpty(lt.lvlfile))
-                out << PGEFile::value("LF", PGEFile::WriteStr(lt.lvlfile));
+                w.writeStr("LF", lt.lvlfile);
             if(lt.entertowarp != defLvl.entertowarp)
-                out << PGEFile::value("EI", PGEFile::WriteInt(lt.entertowarp));
+                w.writeInt("EI", lt.entertowarp);
             if(lt.left_exit != defLvl.left_exit)
-                out << PGEFile::value("EL", PGEFile::WriteInt(lt.left_exit));
+                w.writeInt("EL", lt.left_exit);
             if(lt.top_exit != defLvl.top_exit)
-                out << PGEFile::value("ET", PGEFile::WriteInt(lt.top_exit));
+                w.writeInt("ET", lt.top_exit);
             if(lt.right_exit != defLvl.right_exit)
-                out << PGEFile::value("ER", PGEFile::WriteInt(lt.right_exit));
+                w.writeInt("ER", lt.right_exit);
             if(lt.bottom_exit != defLvl.bottom_exit)
-                out << PGEFile::value("EB", PGEFile::WriteInt(lt.bottom_exit));
+                w.writeInt("EB", lt.bottom_exit);
             if(lt.gotox != defLvl.gotox)
-                out << PGEFile::value("WX", PGEFile::WriteInt(lt.gotox));
+                w.writeInt("WX", lt.gotox);
             if(lt.gotoy != defLvl.gotoy)
-                out << PGEFile::value("WY", PGEFile::WriteInt(lt.gotoy));
+                w.writeInt("WY", lt.gotoy);
             if(lt.alwaysVisible)
-                out << PGEFile::value("AV", PGEFile::WriteBool(lt.alwaysVisible));
+                w.writeBool("AV", lt.alwaysVisible);
             if(lt.gamestart)
-                out << PGEFile::value("SP", PGEFile::WriteBool(lt.gamestart));
+                w.writeBool("SP", lt.gamestart);
             if(lt.pathbg)
-                out << PGEFile::value("BP", PGEFile::WriteBool(lt.pathbg));
+                w.writeBool("BP", lt.pathbg);
             if(lt.bigpathbg)
-                out << PGEFile::value("BG", PGEFile::WriteBool(lt.bigpathbg));
+                w.writeBool("BG", lt.bigpathbg);
             if(lt.starsShowPolicy != WorldLevelTile::STARS_UNSPECIFIED)
-                out << PGEFile::value("SSS", PGEFile::WriteInt(lt.starsShowPolicy));
+                w.writeInt("SSS", lt.starsShowPolicy);
             if(!IsEmpty(lt.meta.custom_params))
-                out << PGEFile::value("XTRA", PGEFile::WriteStr(lt.meta.custom_params));
-            out << "\n";
+                w.writeStr("XTRA", lt.meta.custom_params);
+            w << "\n";
         }
 
-        out << "LEVELS_END\n";
+        w << "LEVELS_END\n";
     }
 
     return true;
@@ -34,6 +34,11 @@
 
 bool FileFormats::OpenLevelFile(const PGESTRING &filePath, LevelData &FileData)
 {
+    PGE_FileFormats_misc::MappedTextFileInput mappedFile;
+
+    if(mappedFile.open(filePath, true))
+        return OpenLevelFileT(mappedFile, FileData);
+
     PGE_FileFormats_misc::TextFileInput file;
 
     if(!file.open(filePath, true))
@@ -48,7 +53,7 @@ bool FileFormats::OpenLevelFile(const PGESTRING &filePath, LevelData &FileData)
     return OpenLevelFileT(file, FileData);
 }
 
-bool FileFormats::OpenLevelRaw(PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData)
+bool FileFormats::OpenLevelRaw(const PGESTRING &rawdata, const PGESTRING &filePath, LevelData &FileData)
 {
     PGE_FileFormats_misc::RawTextInput file;
 
@@ -64,6 +69,22 @@ bool FileFormats::OpenLevelRaw(PGESTRING &rawdata, const PGESTRING &filePath, Le
     return OpenLevelFileT(file, FileData);
 }
 
+bool FileFormats::OpenLevelRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, LevelData &FileData)
+{
+    PGE_FileFormats_misc::ViewTextInput file;
+
+    if(!file.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ReadFileValid = false;
+        FileData.meta.ERROR_info = "Can't open file";
+        FileData.meta.ERROR_linedata.clear();
+        FileData.meta.ERROR_linenum = -1;
+        return false;
+    }
+
+    return OpenLevelFileT(file, FileData);
+}
+
 bool FileFormats::OpenLevelFileT(PGE_FileFormats_misc::TextInput &file, LevelData &FileData)
 {
     PGESTRING firstLine;
@@ -123,7 +144,7 @@ bool FileFormats::OpenLevelFileHeader(const PGESTRING &filePath, LevelData &data
     return OpenLevelFileHeaderT(file, data);
 }
 
-bool FileFormats::OpenLevelFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &filePath, LevelData &data)
+bool FileFormats::OpenLevelFileHeaderRaw(const PGESTRING &rawdata, const PGESTRING &filePath, LevelData &data)
 {
     PGE_FileFormats_misc::RawTextInput file;
     data.meta.ERROR_info.clear();
@@ -139,6 +160,22 @@ bool FileFormats::OpenLevelFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &fi
     return OpenLevelFileHeaderT(file, data);
 }
 
+bool FileFormats::OpenLevelFileHeaderRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, LevelData &data)
+{
+    PGE_FileFormats_misc::ViewTextInput file;
+    data.meta.ERROR_info.clear();
+
+    if(!file.open(rawdata, rawdataSize, filePath))
+    {
+        data.meta.ReadFileValid = false;
+        data.meta.ERROR_info = "Can't open file";
+        data.meta.ERROR_linedata.clear();
+        data.meta.ERROR_linenum = -1;
+        return false;
+    }
+    return OpenLevelFileHeaderT(file, data);
+}
+
 bool FileFormats::OpenLevelFileHeaderT(PGE_FileFormats_misc::TextInput &file, LevelData &data)
 {
     PGESTRING firstLine;
@@ -261,6 +298,11 @@ bool FileFormats::SaveLevelData(LevelData &FileData, PGESTRING &RawData, LevelFi
 
 bool FileFormats::OpenWorldFile(const PGESTRING &filePath, WorldData &data)
 {
+    PGE_FileFormats_misc::MappedTextFileInput mappedFile;
+
+    if(mappedFile.open(filePath, true))
+        return OpenWorldFileT(mappedFile, data);
+
     PGE_FileFormats_misc::TextFileInput file;
 
     if(!file.open(filePath, true))
@@ -275,7 +317,7 @@ bool FileFormats::OpenWorldFile(const PGESTRING &filePath, WorldData &data)
     return OpenWorldFileT(file, data);
 }
 
-bool FileFormats::OpenWorldRaw(PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData)
+bool FileFormats::OpenWorldRaw(const PGESTRING &rawdata, const PGESTRING &filePath, WorldData &FileData)
 {
     PGE_FileFormats_misc::RawTextInput file;
 
@@ -291,6 +333,22 @@ bool FileFormats::OpenWorldRaw(PGESTRING &rawdata, const PGESTRING &filePath, Wo
     return OpenWorldFileT(file, FileData);
 }
 
+bool FileFormats::OpenWorldRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, WorldData &FileData)
+{
+    PGE_FileFormats_misc::ViewTextInput file;
+
+    if(!file.open(rawdata, rawdataSize, filePath))
+    {
+        FileData.meta.ReadFileValid = false;
+        FileData.meta.ERROR_info = "Can't open file";
+        FileData.meta.ERROR_linedata.clear();
+        FileData.meta.ERROR_linenum = -1;
+        return false;
+    }
+
+    return OpenWorldFileT(file, FileData);
+}
+
 bool FileFormats::OpenWorldFileT(PGE_FileFormats_misc::TextInput &file, WorldData &data)
 {
     PGESTRING firstLine;
@@ -352,7 +410,7 @@ bool FileFormats::OpenWorldFileHeader(const PGESTRING &filePath, WorldData &data
     return OpenWorldFileHeaderT(file, data);
 }
 
-bool FileFormats::OpenWorldFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &filePath, WorldData &data)
+bool FileFormats::OpenWorldFileHeaderRaw(const PGESTRING &rawdata, const PGESTRING &filePath, WorldData &data)
 {
     PGE_FileFormats_misc::RawTextInput file;
     data.meta.ERROR_info.clear();
@@ -369,6 +427,23 @@ bool FileFormats::OpenWorldFileHeaderRaw(PGESTRING &rawdata, const PGESTRING &fi
     return OpenWorldFileHeaderT(file, data);
 }
 
+bool FileFormats::OpenWorldFileHeaderRaw(const char *rawdata, size_t rawdataSize, const PGESTRING &filePath, WorldData &data)
+{
+    PGE_FileFormats_misc::ViewTextInput file;
+    data.meta.ERROR_info.clear();
+
+    if(!file.open(rawdata, rawdataSize, filePath))
+    {
+        data.meta.ReadFileValid = false;
+        data.meta.ERROR_info = "Can't open file";
+        data.meta.ERROR_linedata.clear();
+        data.meta.ERROR_linenum = -1;
+        return false;
+    }
+
+    return OpenWorldFileHeaderT(file, data);
+}
+
 bool FileFormats::OpenWorldFileHeaderT(PGE_FileFormats_misc::TextInput &file, WorldData &data)
 {
     PGESTRING firstLine;
@@ -26,6 +26,7 @@
 
 #include "pge_file_lib_sys.h"
 #include "pge_file_lib_private.h"
+#include "pge_file_lib_simd.h"
 #include "file_strlist.h"
 
 FileStringList::FileStringList()
@@ -49,7 +50,9 @@ void FileStringList::addData(const PGESTRING &fileData)
 #ifdef PGE_FILES_QT
     buffer = fileData.split(PGEFL_QRegExp("[\r\n]"), QSTR_SKIP_EMPTY_PARTS);
 #else
-    PGE_SPLITSTRING(buffer, fileData, "\n");
+    PGESTRING data = fileData;
+    data.resize(PGE_FileFormats_misc::removeCR(&data[0], data.size()));
+    PGE_SPLITSTRING(buffer, data, "\n");
 #endif
     lineID = 0;
 }
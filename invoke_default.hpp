@@ -64,8 +64,8 @@ namespace idef
         template<typename Func>
         struct invoke_or_noop_impl
         {
-            template<typename Ret, typename... Args>
-            static Ret invoke(Func &&f, Args &&... args)
+            template<typename Ret, typename F, typename... Args>
+            static Ret invoke(F &&f, Args &&... args)
             {
                 return f(std::forward<Args>(args)...);
             }
@@ -90,11 +90,13 @@ namespace idef
         return impl_type::Get(pf, df);
     }
 
+    // The callable is taken by reference: copying it per call is not free (captures, std::function)
     template<typename Ret, typename Func, typename... Args>
-    Ret invoke_or_noop(Func f, Args &&... args)
+    Ret invoke_or_noop(Func &&f, Args &&... args)
     {
         static_assert(std::is_default_constructible<Ret>::value || std::is_same<Ret, void>::value, "Return value must be default constructible!");
-        return detail::invoke_or_noop_impl<Func>::template invoke<Ret>(std::forward<Func>(f), std::forward<Args>(args)...);
+        using impl_type = detail::invoke_or_noop_impl<typename std::decay<Func>::type>;
+        return impl_type::template invoke<Ret>(std::forward<Func>(f), std::forward<Args>(args)...);
     }
 }
 
@@ -26,6 +26,7 @@
 
 #include "pge_file_lib_globs.h"
 #include "pge_file_lib_private.h"
+#include "pge_file_lib_simd.h"
 #ifdef _WIN32
 #include "windows.h"
 #endif
@@ -34,7 +35,6 @@
 #include <sstream>
 #include <algorithm>
 #include <string>
-#include "charsetconvert.h"
 #ifndef PATH_MAX
 /*
  * Needed to shut up CLang's static analyzer that showing usage of this
@@ -46,7 +46,22 @@
 #else
 #include <QFileInfo>
 #endif
-#include <memory>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <climits>
+
+#if !defined(PGE_FILES_QT) && !defined(_WIN32) && \
+    !defined(PGE_NO_MMAP) && !defined(PGE_MIN_PORT) && !defined(__3DS__) && \
+    !defined(VITA) && !defined(__SWITCH__) && !defined(__WII__) && !defined(__WIIU__) && \
+    !defined(__EMSCRIPTEN__)
+#   define PGE_FILES_POSIX_MMAP
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#endif
 
 namespace PGE_FileFormats_misc
 {
@@ -172,34 +187,217 @@ bool hasEnding(std::string const &fullString, std::string const &ending)
 }
 #endif
 
-PGESTRING url_encode(const PGESTRING &sSrc)
+bool parseDecimal(const char *begin, const char *end, bool &negative,
+                  unsigned long long &magnitude, bool &overflow)
 {
-    if(IsEmpty(sSrc))
-        return sSrc;
-    const char DEC2HEX[16 + 1] = "0123456789ABCDEF";
-#ifndef PGE_FILES_QT
-    const uint8_t *pSrc = reinterpret_cast<const uint8_t *>(sSrc.c_str());
+    const unsigned long long cutoff = ULLONG_MAX / 10;
+    const unsigned int cutlim = static_cast<unsigned int>(ULLONG_MAX % 10);
+    unsigned long long value = 0;
+
+    while((begin < end) && ((*begin == ' ') || ((*begin >= '\t') && (*begin <= '\r'))))
+        ++begin;
+
+    negative = (begin < end) && (*begin == '-');
+    if(negative || ((begin < end) && (*begin == '+')))
+        ++begin;
+
+    if((begin == end) || (*begin < '0') || (*begin > '9'))
+        return false;
+
+    overflow = false;
+    for(; (begin < end) && (*begin >= '0') && (*begin <= '9'); ++begin)
+    {
+        unsigned int d = static_cast<unsigned int>(*begin - '0');
+        if((value > cutoff) || ((value == cutoff) && (d > cutlim)))
+            overflow = true;
+        else
+            value = value * 10 + d;
+    }
+
+    magnitude = value;
+    return true;
+}
+
+size_t uintToChars(char *buf, unsigned long long value)
+{
+    char tmp[NUM_BUFFER_SIZE];
+    char *p = tmp + NUM_BUFFER_SIZE;
+
+    do
+    {
+        *--p = static_cast<char>('0' + (value % 10));
+        value /= 10;
+    } while(value > 0);
+
+    size_t len = static_cast<size_t>((tmp + NUM_BUFFER_SIZE) - p);
+    std::memcpy(buf, p, len);
+    buf[len] = '\0';
+    return len;
+}
+
+size_t intToChars(char *buf, long long value)
+{
+    if(value >= 0)
+        return uintToChars(buf, static_cast<unsigned long long>(value));
+    buf[0] = '-';
+    return uintToChars(buf + 1, 0ull - static_cast<unsigned long long>(value)) + 1;
+}
+
+static inline double readFloatBack(const char *buf, double *)
+{
+    return std::strtod(buf, nullptr);
+}
+
+static inline float readFloatBack(const char *buf, float *)
+{
+    return std::strtof(buf, nullptr);
+}
+
+/*
+ * Looks for the shortest "%g" output that reads back into the same value. The
+ * default precision of 6 digits is enough for most of values, so, it goes first:
+ * when it round-trips, no shorter output exists because "%g" drops trailing zeros.
+ */
+template<typename T>
+static size_t floatToCharsT(char *buf, T value, int maxPrecision)
+{
+    int len;
+
+    if(!std::isfinite(value))
+    {
+        len = std::snprintf(buf, NUM_BUFFER_SIZE, "%g", static_cast<double>(value));
+        return len > 0 ? static_cast<size_t>(len) : 0;
+    }
+
+    for(int precision = 6; ; ++precision)
+    {
+        len = std::snprintf(buf, NUM_BUFFER_SIZE, "%.*g", precision, static_cast<double>(value));
+        if(len <= 0)
+            return 0;
+        if((precision >= maxPrecision) || (readFloatBack(buf, static_cast<T*>(nullptr)) == value))
+            break;
+    }
+
+    // snprintf() follows the LC_NUMERIC locale, but files always use a dot
+    size_t out = 0;
+    bool point = false;
+    for(int i = 0; i < len; ++i)
+    {
+        char c = buf[i];
+        if(((c >= '0') && (c <= '9')) || (c == '-') || (c == '+') || (c == 'e') || (c == '.'))
+            buf[out++] = c;
+        else if(!point)
+        {
+            buf[out++] = '.';
+            point = true;
+        }
+    }
+    buf[out] = '\0';
+
+    return out;
+}
+
+size_t floatToChars(char *buf, double value)
+{
+    return floatToCharsT(buf, value, 17);
+}
+
+size_t floatToChars(char *buf, float value)
+{
+    return floatToCharsT(buf, value, 9);
+}
+
+static const char DEC2HEX[16 + 1] = "0123456789ABCDEF";
+
+size_t url_encode(char *dst, const char *src, size_t len, bool minimal)
+{
+    const char *const end = src + len;
+    char *out = dst;
+
+    while(src < end)
+    {
+        if(minimal)
+        {
+            // Copy the run of characters which don't need encoding at once
+            const size_t plain = findUrlEncodable(src, static_cast<size_t>(end - src));
+            std::memcpy(out, src, plain);
+            out += plain;
+            src += plain;
+            if(src == end)
+                break;
+        }
+
+        const uint8_t c = static_cast<uint8_t>(*src++);
+        out[0] = '%';
+        out[1] = DEC2HEX[c >> 4];
+        out[2] = DEC2HEX[c & 0x0F];
+        out += 3;
+    }
+
+    return static_cast<size_t>(out - dst);
+}
+
+void url_encode_append(std::string &dst, const char *src, size_t len, bool minimal)
+{
+    size_t out_len = len * 3;
+
+    if(minimal)
+    {
+        // Every character to encode takes two more bytes
+        out_len = len;
+        for(size_t pos = findUrlEncodable(src, len); pos < len; pos += findUrlEncodable(src + pos, len - pos))
+        {
+            out_len += 2;
+            ++pos;
+        }
+    }
+
+    if(out_len == 0)
+        return;
+
+    const size_t old_len = dst.size();
+    dst.resize(old_len + out_len);
+    url_encode(&dst[old_len], src, len, minimal);
+}
+
+TextOutput &operator<<(TextOutput &out, const UrlEncoded &data)
+{
+#ifdef PGE_FILES_QT
+    const QByteArray src_data = data.src.toUtf8();
+    const char *src = src_data.data();
+    size_t left = static_cast<size_t>(src_data.size());
 #else
-    std::string ssSrc = sSrc.toStdString();
-    const uint8_t *pSrc = reinterpret_cast<const uint8_t *>(ssSrc.c_str());
+    const char *src = data.src.data();
+    size_t left = data.src.size();
 #endif
-    const size_t SRC_LEN = static_cast<size_t>(sSrc.length());
-    std::unique_ptr<uint8_t[]> pStart(new uint8_t[SRC_LEN * 3]);
-    uint8_t *pEnd = pStart.get();
-    const uint8_t *const SRC_END = pSrc + SRC_LEN;
-    for(; pSrc < SRC_END; ++pSrc)
+    const size_t chunk_len = 256;
+    char buf[chunk_len * 3];
+
+    while(left > 0)
     {
-        //Do full encoding!
-        *pEnd++ = '%';
-        *pEnd++ = static_cast<uint8_t>(DEC2HEX[*pSrc >> 4]);
-        *pEnd++ = static_cast<uint8_t>(DEC2HEX[*pSrc & 0x0F]);
+        const size_t chunk = (left < chunk_len) ? left : chunk_len;
+        out.write(buf, url_encode(buf, src, chunk, data.minimal));
+        src += chunk;
+        left -= chunk;
     }
+
+    return out;
+}
+
+PGESTRING url_encode(const PGESTRING &sSrc, bool minimal)
+{
+    if(IsEmpty(sSrc))
+        return sSrc;
 #ifndef PGE_FILES_QT
-    PGESTRING sResult(reinterpret_cast<char *>(pStart.get()), reinterpret_cast<char *>(pEnd));
+    PGESTRING sResult;
+    url_encode_append(sResult, sSrc.data(), sSrc.size(), minimal);
+    return sResult;
 #else
-    PGESTRING sResult = QString::fromUtf8(reinterpret_cast<char *>(pStart.get()), static_cast<int>(pEnd - pStart.get()));
+    const QByteArray src = sSrc.toUtf8();
+    std::string sResult;
+    url_encode_append(sResult, src.data(), static_cast<size_t>(src.size()), minimal);
+    return QString::fromLatin1(sResult.data(), static_cast<int>(sResult.size()));
 #endif
-    return sResult;
 }
 
 #ifndef PGE_FILES_QT
@@ -227,63 +425,92 @@ const int_fast8_t HEX2DEC[256] =
     /* F */ -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
 };
 
-PGESTRING url_decode(const std::string &sSrc)
+size_t url_decode(char *dst, const char *src, size_t len)
 {
-    if(sSrc.empty())
-        return sSrc;
     // Note from RFC1630: "Sequences which start with a percent
     // sign but are not followed by two hexadecimal characters
     // (0-9, A-F) are reserved for future extension"
-    const uint8_t *pSrc = reinterpret_cast<const uint8_t *>(sSrc.c_str());
-    const size_t SRC_LEN = sSrc.length();
-    const uint8_t *const SRC_END = pSrc + SRC_LEN;
-    // last decodable '%'
-    const uint8_t *const SRC_LAST_DEC = SRC_END - 2;
-
-    char *pStart = reinterpret_cast<char *>(std::malloc(SRC_LEN + 1));
-    if(!pStart)
-        return "";
-    std::memset(pStart, 0, SRC_LEN + 1);
-    char *pEnd = pStart;
+    const uint8_t *pSrc = reinterpret_cast<const uint8_t *>(src);
+    const uint8_t *const SRC_END = pSrc + len;
+    char *pEnd = dst;
 
-    while(pSrc < SRC_LAST_DEC)
+    // Decoded data is never longer than the source, so, it's safe to decode in place
+    while(pSrc < SRC_END)
     {
-        if(*pSrc == '%')
+        const uint8_t *pct = reinterpret_cast<const uint8_t *>(std::memchr(pSrc, '%', static_cast<size_t>(SRC_END - pSrc)));
+        if(!pct)
+            pct = SRC_END;
+
+        // Copy the plain run at once
+        const size_t plain = static_cast<size_t>(pct - pSrc);
+        if(plain > 0 && pEnd != reinterpret_cast<const char *>(pSrc))
+            std::memmove(pEnd, pSrc, plain);
+        pEnd += plain;
+        pSrc = pct;
+
+        if(pSrc == SRC_END)
+            break;
+
+        int_fast8_t dec1, dec2;
+        if(SRC_END - pSrc > 2
+           && -1 != (dec1 = HEX2DEC[*(pSrc + 1)])
+           && -1 != (dec2 = HEX2DEC[*(pSrc + 2)]))
         {
-            int_fast8_t dec1, dec2;
-            if(-1 != (dec1 = HEX2DEC[*(pSrc + 1)])
-               && -1 != (dec2 = HEX2DEC[*(pSrc + 2)]))
-            {
-                *pEnd++ = static_cast<char>((dec1 << 4) + dec2);
-                pSrc += 3;
-                continue;
-            }
+            *pEnd++ = static_cast<char>((dec1 << 4) + dec2);
+            pSrc += 3;
+            continue;
         }
 
         *pEnd++ = static_cast<char>(*pSrc++);
     }
 
-    // the last 2- chars
-    while(pSrc < SRC_END)
-        *pEnd++ = static_cast<char>(*pSrc++);
+    return static_cast<size_t>(pEnd - dst);
+}
+
+void url_decode_inplace(std::string &str)
+{
+    // Nothing to decode when there are no escape sequences
+    if(str.find('%') == std::string::npos)
+        return;
+    str.resize(url_decode(&str[0], str.data(), str.size()));
+}
 
-    std::string::size_type pLen = static_cast<std::string::size_type>(pEnd - pStart);
-    std::string sResult(pStart, pLen);
-    std::free(pStart);
+PGESTRING url_decode(const std::string &sSrc)
+{
+    if(sSrc.find('%') == std::string::npos)
+        return sSrc;
+    std::string sResult(sSrc.size(), '\0');
+    sResult.resize(url_decode(&sResult[0], sSrc.data(), sSrc.size()));
     return sResult;
 }
 #endif
 
 
-static const std::string base64_chars =
+static const char base64_chars[64 + 1] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
     "abcdefghijklmnopqrstuvwxyz"
     "0123456789+/";
 
-static inline bool is_base64(unsigned char c)
+// Values of base64 characters, -1 for characters out of the alphabet
+static const int_fast8_t BASE64_DEC[256] =
 {
-    return (isalnum(c) || (c == '+') || (c == '/'));
-}
+    /* 0 */ -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    /* 1 */ -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    /* 2 */ -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 62, -1, -1, -1, 63,
+    /* 3 */ 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, -1, -1, -1,
+    /* 4 */ -1,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    /* 5 */ 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1,
+    /* 6 */ -1, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    /* 7 */ 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, -1, -1, -1, -1, -1,
+    /* 8 */ -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    /* 9 */ -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    /* A */ -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    /* B */ -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    /* C */ -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    /* D */ -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    /* E */ -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    /* F */ -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
 
 #ifdef PGE_FILES_QT
 /*
@@ -301,6 +528,9 @@ QString      base64_encodeW(QString &source, bool no_padding)
 QString      base64_decodeW(QString &source)
 {
     std::string sout = base64_decode(source.toStdString());
+    // The trailing zero byte has been removed by the base64_decode()
+    if(sout.size() % 2)
+        sout.push_back('\0');
     QString out;
     out.setUtf16(reinterpret_cast<const uint16_t *>(sout.data()), static_cast<int>(sout.size() / 2));
     return out;
@@ -337,43 +567,131 @@ QString      base64_decode(QString &source)
 }
 
 #else
-std::string  base64_encodeW(std::string &source, bool no_padding)
+/*
+ * SMBX-38A stores wide strings as UTF-16LE, so, they are converted directly
+ * instead of going through the platform-dependent wchar_t.
+ */
+static void utf8ToUtf16LE(std::string &out, const std::string &in)
 {
-    SI_ConvertW<wchar_t> utf8(true);
-    size_t new_len = utf8.SizeFromStore(source.c_str(), source.length());
-    std::wstring t;
-    t.resize(new_len);
-    if(utf8.ConvertFromStore(source.c_str(), source.length(), &t[0], new_len))
-        return base64_encode(reinterpret_cast<const unsigned char *>(t.c_str()), t.size(), no_padding);
-    return "<fail to convert charset>";
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(in.data());
+    const uint8_t *end = src + in.size();
+    out.clear();
+    out.reserve(in.size() * 2);
+
+    while(src < end)
+    {
+        uint32_t cp = *src;
+        size_t extra = 0;
+        if(cp >= 0xF0 && cp <= 0xF4)
+        {
+            cp &= 0x07;
+            extra = 3;
+        }
+        else if(cp >= 0xE0 && cp <= 0xEF)
+        {
+            cp &= 0x0F;
+            extra = 2;
+        }
+        else if(cp >= 0xC2 && cp < 0xE0)
+        {
+            cp &= 0x1F;
+            extra = 1;
+        }
+        else if(cp >= 0x80)
+            cp = 0xFFFD; // Invalid leading byte
+
+        ++src;
+        if(cp != 0xFFFD)
+        {
+            size_t k = 0;
+            for(; k < extra && src < end && (*src & 0xC0) == 0x80; ++k)
+                cp = (cp << 6) | (*src++ & 0x3F);
+            if(k < extra || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF) ||
+               (extra == 2 && cp < 0x800) || (extra == 3 && cp < 0x10000))
+                cp = 0xFFFD; // Truncated, overlong, or out of range sequence
+        }
+
+        if(cp >= 0x10000)
+        {
+            cp -= 0x10000;
+            const uint32_t hi = 0xD800 + (cp >> 10), lo = 0xDC00 + (cp & 0x3FF);
+            out.push_back(static_cast<char>(hi & 0xFF));
+            out.push_back(static_cast<char>(hi >> 8));
+            out.push_back(static_cast<char>(lo & 0xFF));
+            out.push_back(static_cast<char>(lo >> 8));
+        }
+        else
+        {
+            out.push_back(static_cast<char>(cp & 0xFF));
+            out.push_back(static_cast<char>(cp >> 8));
+        }
+    }
 }
 
-std::string base64_decodeW(std::string &source)
+static void utf16LEToUtf8(std::string &out, const std::string &in)
 {
-    std::string out = base64_decode(source);
-#if 0 // def DEBUG_BUILD // Clunky debug code
-    if(!out.empty())
+    const size_t units = in.size() / 2;
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(in.data());
+    out.clear();
+    out.reserve(units * 3);
+
+    for(size_t i = 0; i < units; ++i)
     {
-        FILE *x = utf8_fopen("test.txt", "ab");
-        //        for(size_t i=0; i<out.size(); i++)
-        //             printf("%i ", (int)out[i]);
-        //        printf("%s", out.c_str());
-        if(x)
+        uint32_t cp = static_cast<uint32_t>(src[i * 2]) | (static_cast<uint32_t>(src[i * 2 + 1]) << 8);
+        if(cp == 0)
+            break; // Null-terminated data
+
+        if(cp >= 0xD800 && cp <= 0xDBFF && i + 1 < units)
+        {
+            uint32_t lo = static_cast<uint32_t>(src[i * 2 + 2]) | (static_cast<uint32_t>(src[i * 2 + 3]) << 8);
+            if(lo >= 0xDC00 && lo <= 0xDFFF)
+            {
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                ++i;
+            }
+        }
+        if(cp >= 0xD800 && cp <= 0xDFFF)
+            cp = 0xFFFD; // Unpaired surrogate
+
+        if(cp < 0x80)
+            out.push_back(static_cast<char>(cp));
+        else if(cp < 0x800)
+        {
+            out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+        else if(cp < 0x10000)
+        {
+            out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+        else
         {
-            fwrite((void *) out.c_str(), sizeof(char), out.size(), x);
-            fflush(x);
-            fclose(x);
+            out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
         }
     }
-#endif
-    std::wstring outw(reinterpret_cast<const wchar_t *>(out.c_str()));
-    SI_ConvertW<wchar_t> utf8(true);
-    size_t new_len = outw.length() * 2; //utf8.SizeToStore(outw.c_str());
-    std::string out2;
-    out2.resize(new_len);
-    if(utf8.ConvertToStore(outw.c_str(), &out2[0], new_len))
-        return out2;
-    return "<fail to convert charset>";
+}
+
+std::string  base64_encodeW(std::string &source, bool no_padding)
+{
+    std::string utf16;
+    utf8ToUtf16LE(utf16, source);
+    return base64_encode(reinterpret_cast<const unsigned char *>(utf16.data()), utf16.size(), no_padding);
+}
+
+std::string base64_decodeW(std::string &source)
+{
+    std::string utf16 = base64_decode(source);
+    // The trailing zero byte has been removed by the base64_decode()
+    if(utf16.size() % 2)
+        utf16.push_back('\0');
+    std::string out;
+    utf16LEToUtf8(out, utf16);
+    return out;
 }
 
 std::string base64_encodeA(std::string &source, bool no_padding)
@@ -394,45 +712,38 @@ std::string base64_encode(std::string const &source, bool no_padding)
 
 std::string base64_encode(const uint8_t *bytes_to_encode, size_t in_len, bool no_padding)
 {
-    std::string ret;
-    int i = 0;
-    int j = 0;
-    unsigned char char_array_3[3];
-    unsigned char char_array_4[4];
+    const size_t full = in_len / 3, rest = in_len % 3;
+    size_t out_len = full * 4;
+    if(rest)
+        out_len += no_padding ? rest + 1 : 4;
+
+    std::string ret(out_len, '=');
+    if(out_len == 0)
+        return ret;
 
-    while(in_len--)
+    const uint8_t *src = bytes_to_encode;
+    const uint8_t *const src_end = src + full * 3;
+    char *dst = &ret[0];
+
+    for(; src < src_end; src += 3, dst += 4)
     {
-        char_array_3[i++] = *(bytes_to_encode++);
-        if(i == 3)
-        {
-            char_array_4[0] = static_cast<uint8_t>((char_array_3[0] & 0xfc) >> 2);
-            char_array_4[1] = static_cast<uint8_t>(((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4));
-            char_array_4[2] = static_cast<uint8_t>(((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6));
-            char_array_4[3] = static_cast<uint8_t>(char_array_3[2] & 0x3f);
-
-            for(i = 0; (i < 4) ; i++)
-                ret += base64_chars[char_array_4[i]];
-            i = 0;
-        }
+        const uint32_t v = (static_cast<uint32_t>(src[0]) << 16) | (static_cast<uint32_t>(src[1]) << 8) | src[2];
+        dst[0] = base64_chars[v >> 18];
+        dst[1] = base64_chars[(v >> 12) & 0x3F];
+        dst[2] = base64_chars[(v >> 6) & 0x3F];
+        dst[3] = base64_chars[v & 0x3F];
     }
 
-    if(i)
+    if(rest)
     {
-        for(j = i; j < 3; j++)
-            char_array_3[j] = '\0';
-
-        char_array_4[0] = static_cast<uint8_t>((char_array_3[0] & 0xfc) >> 2);
-        char_array_4[1] = static_cast<uint8_t>(((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4));
-        char_array_4[2] = static_cast<uint8_t>(((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6));
-        char_array_4[3] = static_cast<uint8_t>(char_array_3[2] & 0x3f);
-
-        for(j = 0; (j < i + 1); j++)
-            ret += base64_chars[char_array_4[j]];
-
-        while(i++ < 3)
-        {
-            if(!no_padding) ret += '=';
-        }
+        // Padding characters are already in place
+        uint32_t v = static_cast<uint32_t>(src[0]) << 16;
+        if(rest == 2)
+            v |= static_cast<uint32_t>(src[1]) << 8;
+        dst[0] = base64_chars[v >> 18];
+        dst[1] = base64_chars[(v >> 12) & 0x3F];
+        if(rest == 2)
+            dst[2] = base64_chars[(v >> 6) & 0x3F];
     }
 
     return ret;
@@ -440,52 +751,43 @@ std::string base64_encode(const uint8_t *bytes_to_encode, size_t in_len, bool no
 
 std::string base64_decode(std::string const &encoded_string)
 {
-    size_t in_len = encoded_string.size();
-    size_t i = 0;
-    size_t j = 0;
-    size_t in_ = 0;
-    unsigned char char_array_4[4], char_array_3[3];
-    std::string ret;
+    // Decoding stops at the padding or at the first character out of the alphabet
+    const size_t in_len = findNonBase64(encoded_string.data(), encoded_string.size());
+    const size_t full = in_len / 4, rest = in_len % 4;
 
-    while(in_len-- && (encoded_string[in_] != '=') && is_base64(static_cast<uint8_t>(encoded_string[in_])))
+    std::string ret(full * 3 + (rest > 1 ? rest - 1 : 0), '\0');
+    if(ret.empty())
+        return ret;
+
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(encoded_string.data());
+    const uint8_t *const src_end = src + full * 4;
+    char *dst = &ret[0];
+
+    for(; src < src_end; src += 4, dst += 3)
     {
-        char_array_4[i++] = static_cast<uint8_t>(encoded_string[in_]);
-        in_++;
-        if(i == 4)
-        {
-            for(i = 0; i < 4; i++)
-                char_array_4[i] = static_cast<uint8_t>(base64_chars.find(static_cast<char>(char_array_4[i])));
-            char_array_3[0] = static_cast<uint8_t>((char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4));
-            char_array_3[1] = static_cast<uint8_t>(((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2));
-            char_array_3[2] = static_cast<uint8_t>(((char_array_4[2] & 0x3) << 6) + char_array_4[3]);
-            for(i = 0; (i < 3); i++)
-                ret += static_cast<char>(char_array_3[i]);
-            i = 0;
-        }
+        const uint32_t v = (static_cast<uint32_t>(BASE64_DEC[src[0]]) << 18) |
+                           (static_cast<uint32_t>(BASE64_DEC[src[1]]) << 12) |
+                           (static_cast<uint32_t>(BASE64_DEC[src[2]]) << 6) |
+                           static_cast<uint32_t>(BASE64_DEC[src[3]]);
+        dst[0] = static_cast<char>(v >> 16);
+        dst[1] = static_cast<char>((v >> 8) & 0xFF);
+        dst[2] = static_cast<char>(v & 0xFF);
     }
 
-    if(i)
+    if(rest > 1)
     {
-        for(j = i; j < 4; j++)
-            char_array_4[j] = 0;
-
-        for(j = 0; j < 4; j++)
-            char_array_4[j] = static_cast<uint8_t>(base64_chars.find(static_cast<char>(char_array_4[j])));
-
-        char_array_3[0] = static_cast<uint8_t>((char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4));
-        char_array_3[1] = static_cast<uint8_t>(((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2));
-        char_array_3[2] = static_cast<uint8_t>(((char_array_4[2] & 0x3) << 6) + char_array_4[3]);
-
-        for(j = 0; (j < i - 1); j++)
-            ret += static_cast<char>(char_array_3[j]);
+        uint32_t v = (static_cast<uint32_t>(BASE64_DEC[src[0]]) << 18) |
+                     (static_cast<uint32_t>(BASE64_DEC[src[1]]) << 12);
+        if(rest == 3)
+            v |= static_cast<uint32_t>(BASE64_DEC[src[2]]) << 6;
+        dst[0] = static_cast<char>(v >> 16);
+        if(rest == 3)
+            dst[1] = static_cast<char>((v >> 8) & 0xFF);
     }
 
     //Remove zero from end
-    if(ret.size() > 0)
-    {
-        if(ret[ret.size() - 1] == '\0')
-            ret.resize(ret.size() - 1);
-    }
+    if(ret[ret.size() - 1] == '\0')
+        ret.resize(ret.size() - 1);
 
     return ret;
 }
@@ -521,6 +823,103 @@ bool TextFileOutput::exists(const PGESTRING &filePath)
 }
 
 
+/*****************TEXT SCANNING HELPERS***************************/
+/*
+ * Appends the [begin, end) range into the output string, dropping all CR characters
+ */
+static void appendWithoutCR(std::string &out, const char *begin, const char *end)
+{
+    while(begin < end)
+    {
+        const char *cr = reinterpret_cast<const char *>(std::memchr(begin, '\r', static_cast<size_t>(end - begin)));
+        if(!cr)
+        {
+            out.append(begin, static_cast<size_t>(end - begin));
+            return;
+        }
+        out.append(begin, static_cast<size_t>(cr - begin));
+        begin = cr + 1;
+    }
+}
+
+/*
+ * Scans a line from the [begin, end) range into the output string.
+ * Sets "finished" if line feed has been reached. Returns the position after the scanned data.
+ */
+static const char *scanLine(const char *begin, const char *end, std::string &out, bool &finished)
+{
+    const char *lf = reinterpret_cast<const char *>(std::memchr(begin, '\n', static_cast<size_t>(end - begin)));
+    finished = (lf != nullptr);
+    appendWithoutCR(out, begin, lf ? lf : end);
+    return lf ? lf + 1 : end;
+}
+
+/*
+ * Scans a CSV field from the [begin, end) range into the output string: quotes are
+ * toggling the quoted state and being dropped, CR characters are dropped, unquoted
+ * comma or line feed are finishing the field, every line feed increases the line number.
+ * Sets "finished" if the end of the field has been reached. Returns the position after the scanned data.
+ */
+static const char *scanCVSField(const char *begin, const char *end, std::string &out,
+                                bool &quoteIsOpen, long &lineNumber, bool &finished)
+{
+    const char *p = begin;
+    finished = false;
+
+    while(p < end)
+    {
+        const char *run = p;
+        p += findCSVDelimiter(p, static_cast<size_t>(end - p));
+        out.append(run, static_cast<size_t>(p - run));
+        if(p == end)
+            break;
+
+        switch(*p++)
+        {
+        case '\"':
+            quoteIsOpen = !quoteIsOpen;
+            break;
+        case '\n':
+            lineNumber++;
+            if(!quoteIsOpen)
+            {
+                finished = true;
+                return p;
+            }
+            out.push_back('\n');
+            break;
+        case ',':
+            if(!quoteIsOpen)
+            {
+                finished = true;
+                return p;
+            }
+            out.push_back(',');
+            break;
+        default: // CR
+            break;
+        }
+    }
+
+    return p;
+}
+
+#ifdef PGE_FILES_QT
+static inline QString bytesToPgeStr(const std::string &s, bool utf8)
+{
+    return utf8 ?
+           QString::fromUtf8(s.data(), static_cast<int>(s.size())) :
+           QString::fromLocal8Bit(s.data(), static_cast<int>(s.size()));
+}
+#   define MAPPED_STR(s) bytesToPgeStr(s, m_utf8)
+#   define VIEW_STR(s) bytesToPgeStr(s, true)
+#else
+#   define MAPPED_STR(s) (s)
+#   define VIEW_STR(s) (s)
+#endif
+/*****************TEXT SCANNING HELPERS***************************/
+
+
 /*****************BASE TEXT I/O CLASS***************************/
 TextInput::TextInput() : m_lineNumber(0) {}
 
@@ -575,10 +974,21 @@ bool TextInput::reOpen(bool)
 
 TextOutput::TextOutput() : m_lineNumber(0) {}
 
-int TextOutput::write(PGESTRING)
+int TextOutput::write(const char *, size_t)
 {
     return 0;
 }
+
+int TextOutput::write(const PGESTRING &buffer)
+{
+#ifdef PGE_FILES_QT
+    QByteArray data = buffer.toUtf8();
+    return this->write(data.data(), static_cast<size_t>(data.size()));
+#else
+    return this->write(buffer.data(), buffer.size());
+#endif
+}
+
 int64_t TextOutput::tell()
 {
     return 0;
@@ -605,7 +1015,7 @@ long TextOutput::getCurrentLineNumber()
 /*****************RAW TEXT I/O CLASS***************************/
 RawTextInput::RawTextInput() : TextInput(), m_pos(0), m_data(nullptr), m_isEOF(true) {}
 
-RawTextInput::RawTextInput(PGESTRING *rawString, const PGESTRING &filepath) :
+RawTextInput::RawTextInput(const PGESTRING *rawString, const PGESTRING &filepath) :
     TextInput(),
     m_pos(0),
     m_data(nullptr),
@@ -615,7 +1025,7 @@ RawTextInput::RawTextInput(PGESTRING *rawString, const PGESTRING &filepath) :
         m_data = nullptr;
 }
 
-bool RawTextInput::open(PGESTRING *rawString, const PGESTRING &filepath)
+bool RawTextInput::open(const PGESTRING *rawString, const PGESTRING &filepath)
 {
     if(!rawString)
         return false;
@@ -721,7 +1131,14 @@ PGESTRING RawTextInput::readCVSLine()
 PGESTRING RawTextInput::readAll()
 {
     if(!m_data) return "";
-    return *m_data;
+#ifdef PGE_FILES_QT
+    PGESTRING out = *m_data;
+    out.remove(QChar('\r'));
+#else
+    PGESTRING out = *m_data;
+    out.resize(removeCR(&out[0], out.size()));
+#endif
+    return out;
 }
 
 bool RawTextInput::eof()
@@ -765,22 +1182,157 @@ int RawTextInput::seek(int64_t pos, TextInput::positions relativeTo)
 
 
 
-RawTextOutput::RawTextOutput() : TextOutput(), m_pos(0), m_data(nullptr) {}
+ViewTextInput::ViewTextInput() : TextInput() {}
 
-RawTextOutput::RawTextOutput(PGESTRING *rawString, outputMode mode) : TextOutput(), m_pos(0), m_data(nullptr)
+ViewTextInput::ViewTextInput(const char *data, size_t size, const PGESTRING &filepath) :
+    TextInput()
 {
-    if(!open(rawString, mode))
-        m_data = nullptr;
+    open(data, size, filepath);
 }
 
-RawTextOutput::~RawTextOutput() {}
-
-bool RawTextOutput::open(PGESTRING *rawString, outputMode mode)
+bool ViewTextInput::open(const char *data, size_t size, const PGESTRING &filepath)
 {
-    if(!rawString)
-        return false;
-
-    m_data = rawString;
+    if(!data)
+    {
+        if(size != 0)
+            return false;
+        data = ""; // Empty input, like an empty std::string_view
+    }
+    m_data = data;
+    m_size = static_cast<int64_t>(size);
+    m_filePath = filepath;
+    m_pos = 0;
+    m_isEOF = (size == 0);
+    m_lineNumber = 0;
+    return true;
+}
+
+void ViewTextInput::close()
+{
+    m_isEOF = true;
+    m_data = nullptr;
+    m_size = 0;
+    m_filePath.clear();
+    m_pos = 0;
+    m_lineNumber = 0;
+}
+
+PGESTRING ViewTextInput::read(int64_t len)
+{
+    if(!m_data || m_isEOF)
+        return PGESTRING();
+
+    if((m_pos + len) >= m_size)
+    {
+        len = m_size - m_pos;
+        m_isEOF = true;
+    }
+
+    std::string buf(m_data + m_pos, static_cast<size_t>(len));
+    m_pos += len;
+    return VIEW_STR(buf);
+}
+
+PGESTRING ViewTextInput::readLine()
+{
+    if(!m_data || m_isEOF)
+        return "";
+
+    std::string buffer;
+    bool finished = false;
+    const char *begin = m_data + m_pos;
+    const char *next = scanLine(begin, m_data + m_size, buffer, finished);
+    m_pos += static_cast<int64_t>(next - begin);
+    if(m_pos >= m_size)
+        m_isEOF = true;
+
+    m_lineNumber++;
+    return VIEW_STR(buffer);
+}
+
+PGESTRING ViewTextInput::readCVSLine()
+{
+    if(!m_data || m_isEOF)
+        return PGESTRING();
+
+    std::string buffer;
+    bool quoteIsOpen = false;
+    bool finished = false;
+    const char *begin = m_data + m_pos;
+    const char *next = scanCVSField(begin, m_data + m_size, buffer, quoteIsOpen, m_lineNumber, finished);
+    m_pos += static_cast<int64_t>(next - begin);
+    if(m_pos >= m_size)
+        m_isEOF = true;
+
+    return VIEW_STR(buffer);
+}
+
+PGESTRING ViewTextInput::readAll()
+{
+    if(!m_data)
+        return "";
+    std::string out(m_data, static_cast<size_t>(m_size));
+    out.resize(removeCR(&out[0], out.size()));
+    return VIEW_STR(out);
+}
+
+bool ViewTextInput::eof()
+{
+    return m_isEOF;
+}
+
+int64_t ViewTextInput::tell()
+{
+    return m_pos;
+}
+
+int ViewTextInput::seek(int64_t pos, TextInput::positions relativeTo)
+{
+    if(!m_data)
+        return -1;
+
+    switch(relativeTo)
+    {
+    case current:
+        m_pos += pos;
+        break;
+    case end:
+        m_pos = m_size + pos;
+        break;
+    case begin:
+    default:
+        m_pos = pos;
+        break;
+    }
+    if(m_pos < 0) m_pos = 0;
+    if(m_pos >= m_size)
+    {
+        m_pos = m_size;
+        m_isEOF = true;
+    }
+    else
+        m_isEOF = false;
+    return 0;
+}
+
+
+
+RawTextOutput::RawTextOutput() : TextOutput(), m_pos(0), m_data(nullptr) {}
+
+RawTextOutput::RawTextOutput(PGESTRING *rawString, outputMode mode) : TextOutput(), m_pos(0), m_data(nullptr)
+{
+    if(!open(rawString, mode))
+        m_data = nullptr;
+}
+
+RawTextOutput::~RawTextOutput() {}
+
+bool RawTextOutput::open(PGESTRING *rawString, outputMode mode)
+{
+    if(!rawString)
+        return false;
+
+    m_data = rawString;
     m_pos = 0;
     m_lineNumber = 0;
 
@@ -799,31 +1351,45 @@ void RawTextOutput::close()
     m_lineNumber = 0;
 }
 
-int RawTextOutput::write(PGESTRING buffer)
+int RawTextOutput::write(const char *data, size_t len)
+{
+#ifdef PGE_FILES_QT
+    return write(QString::fromUtf8(data, static_cast<int>(len)));
+#else
+    return writeChars(data, static_cast<int64_t>(len));
+#endif
+}
+
+int RawTextOutput::write(const PGESTRING &buffer)
+{
+#ifdef PGE_FILES_QT
+    return writeChars(buffer.constData(), static_cast<int64_t>(buffer.size()));
+#else
+    return writeChars(buffer.data(), static_cast<int64_t>(buffer.size()));
+#endif
+}
+
+int RawTextOutput::writeChars(const CharType *src, int64_t srcLen)
 {
     if(!m_data) return -1;
-    int64_t written = 0;
-fillEnd:
-    if(m_pos >= static_cast<int64_t>(m_data->size()))
+    const int64_t size = static_cast<int64_t>(m_data->size());
+    int64_t overwriteLen = 0;
+
+    // Replace the tail of existing data in one go, then append the rest
+    if(m_pos < size)
     {
-        auto oldSize = static_cast<int64_t>(m_data->size());
-        m_data->append(buffer);
-        m_pos = static_cast<int64_t>(m_data->size());
-        written += (static_cast<int64_t>(m_data->size()) - oldSize);
+        overwriteLen = (std::min)(size - static_cast<int64_t>(m_pos), srcLen);
+        m_data->replace(static_cast<pge_size_t>(m_pos),
+                        static_cast<pge_size_t>(overwriteLen),
+                        src,
+                        static_cast<pge_size_t>(overwriteLen));
     }
-    else
-    {
-        while((m_pos < static_cast<int64_t>(m_data->size())) && (!IsEmpty(buffer)))
-        {
-            (*m_data)[(pge_size_t)m_pos++] = buffer[0];
-            written++;
-            PGE_RemStrRng(buffer, 0, 1);
-        }
 
-        if(!IsEmpty(buffer))
-            goto fillEnd;
-    }
-    return static_cast<int>(written);
+    if(overwriteLen < srcLen)
+        m_data->append(src + overwriteLen, static_cast<pge_size_t>(srcLen - overwriteLen));
+
+    m_pos += srcLen;
+    return static_cast<int>(srcLen);
 }
 
 int64_t RawTextOutput::tell()
@@ -870,7 +1436,7 @@ TextOutput &TextOutput::operator<<(const PGESTRING &s)
 
 TextOutput &TextOutput::operator <<(const char *s)
 {
-    this->write(s);
+    this->write(s, std::strlen(s));
     return *this;
 }
 /*****************RAW TEXT I/O CLASS***************************/
@@ -879,6 +1445,13 @@ TextOutput &TextOutput::operator <<(const char *s)
 
 /*****************FILE TEXT I/O CLASS***************************/
 
+#ifndef PGE_FILES_QT
+//! Size of the block read buffer of TextFileInput
+static const size_t s_textFileInputBufferSize = 64 * 1024;
+//! Size of the block write buffer of TextFileOutput
+static const size_t s_textFileOutputBufferSize = 64 * 1024;
+#endif
+
 TextFileInput::TextFileInput() :
     TextInput()
 #ifndef PGE_FILES_QT
@@ -943,6 +1516,11 @@ bool TextFileInput::open(const PGESTRING &filePath, bool utf8)
 #else
     (void)utf8;
     stream = utf8_fopen(filePath.c_str(), "rb");
+    m_bufferPos = 0;
+    m_bufferLen = 0;
+    m_isEOF = false;
+    if(stream && m_buffer.empty())
+        m_buffer.resize(s_textFileInputBufferSize);
     return (stream != nullptr);
 #endif
 }
@@ -964,9 +1542,34 @@ void TextFileInput::close()
     if(stream)
         fclose(stream);
     stream = nullptr;
+    m_bufferPos = 0;
+    m_bufferLen = 0;
+    m_isEOF = false;
 #endif
 }
 
+#ifndef PGE_FILES_QT
+bool TextFileInput::fillBuffer()
+{
+    m_bufferPos = 0;
+    m_bufferLen = fread(m_buffer.data(), 1, m_buffer.size(), stream);
+    if(m_bufferLen == 0)
+    {
+        m_isEOF = true;
+        return false;
+    }
+    return true;
+}
+
+void TextFileInput::dropBuffer()
+{
+    if(m_bufferPos < m_bufferLen)
+        fseek(stream, -static_cast<long>(m_bufferLen - m_bufferPos), SEEK_CUR);
+    m_bufferPos = 0;
+    m_bufferLen = 0;
+}
+#endif
+
 PGESTRING TextFileInput::read(int64_t len)
 {
 #ifdef PGE_FILES_QT
@@ -983,8 +1586,19 @@ PGESTRING TextFileInput::read(int64_t len)
     if(!stream)
         return "";
     std::string buf(static_cast<size_t>(len + 1), '\0');
-    size_t lenR = fread(&buf[0], 1, static_cast<size_t>(len), stream);
-    (void)lenR;
+    size_t want = static_cast<size_t>(len);
+    size_t got = std::min(want, m_bufferLen - m_bufferPos);
+    if(got > 0)
+    {
+        std::memcpy(&buf[0], m_buffer.data() + m_bufferPos, got);
+        m_bufferPos += got;
+    }
+    if(got < want)
+    {
+        got += fread(&buf[got], 1, want - got, stream);
+        if(got < want)
+            m_isEOF = true;
+    }
     return buf;
 #endif
 }
@@ -999,21 +1613,20 @@ PGESTRING TextFileInput::readLine()
         return "";
 
     std::string out;
-    out.reserve(1024);
-    int C = 0;
-    do
+    bool finished = false;
+
+    while(!finished)
     {
-        C = fgetc(stream);
-        if((C != '\n') && (C != '\r') && (C != EOF))
-            out.push_back(static_cast<char>(C));
+        if((m_bufferPos == m_bufferLen) && !fillBuffer())
+            break;
+        const char *begin = m_buffer.data() + m_bufferPos;
+        const char *next = scanLine(begin, m_buffer.data() + m_bufferLen, out, finished);
+        m_bufferPos += static_cast<size_t>(next - begin);
     }
-    while((C != '\n') && (C != EOF));
 
     if(out.size() == 0)
         return "";
 
-    out.shrink_to_fit();
-
     m_lineNumber++;
     return out;
 #endif
@@ -1046,31 +1659,19 @@ PGESTRING TextFileInput::readCVSLine()
            QString::fromStdString(buffer) :
            QString::fromLocal8Bit(buffer.c_str(), static_cast<int>(buffer.size()));
 #else
-    buffer.reserve(1024);
     if(!stream)
         return "";
 
-    int  gc;
-    char cur;
-    if(!feof(stream))
-        do
-        {
-            gc = fgetc(stream);
-            if(gc == EOF)
-                break;
-            cur = static_cast<char>(gc);
-            if(cur == '\"')
-                quoteIsOpen = !quoteIsOpen;
-            else
-            {
-                if((cur != '\r') && (((cur != '\n') && (cur != ',')) || (quoteIsOpen)))
-                    buffer.push_back(cur);
-                if(cur == '\n')
-                    m_lineNumber++;
-            }
-        }
-        while((((cur != '\n') && (cur != ',')) || quoteIsOpen));
-    buffer.shrink_to_fit();
+    bool finished = false;
+    while(!m_isEOF && !finished)
+    {
+        if((m_bufferPos == m_bufferLen) && !fillBuffer())
+            break;
+        const char *begin = m_buffer.data() + m_bufferPos;
+        const char *next = scanCVSField(begin, m_buffer.data() + m_bufferLen, buffer,
+                                        quoteIsOpen, m_lineNumber, finished);
+        m_bufferPos += static_cast<size_t>(next - begin);
+    }
     return buffer;
 #endif
 }
@@ -1083,16 +1684,28 @@ PGESTRING TextFileInput::readAll()
     if(!stream)
         return PGESTRING();
     std::string out;
-    out.reserve(10240);
+    m_bufferPos = 0;
+    m_bufferLen = 0;
+
+    long fileSize = 0;
+    if(fseek(stream, 0, SEEK_END) == 0)
+        fileSize = ftell(stream);
     fseek(stream, 0, SEEK_SET);
-    int x = 0;
-    do
+
+    if(fileSize > 0)
     {
-        x = fgetc(stream);
-        if((x != '\r') && (x != EOF))
-            out.push_back(static_cast<char>(x));
+        out.resize(static_cast<size_t>(fileSize));
+        out.resize(fread(&out[0], 1, out.size(), stream));
     }
-    while(!feof(stream));
+
+    // Take the rest when the size is unknown or file has grown since
+    while(fillBuffer())
+        out.append(m_buffer.data(), m_bufferLen);
+    m_bufferPos = 0;
+    m_bufferLen = 0;
+
+    out.resize(removeCR(&out[0], out.size()));
+    m_isEOF = true;
     return out;
 #endif
 }
@@ -1102,7 +1715,7 @@ bool TextFileInput::eof()
 #ifdef PGE_FILES_QT
     return stream.atEnd();
 #else
-    return (feof(stream) != 0);
+    return m_isEOF;
 #endif
 }
 
@@ -1111,7 +1724,7 @@ int64_t TextFileInput::tell()
 #ifdef PGE_FILES_QT
     return static_cast<int64_t>(file.pos());
 #else
-    return static_cast<int64_t>(ftell(stream));
+    return static_cast<int64_t>(ftell(stream)) - static_cast<int64_t>(m_bufferLen - m_bufferPos);
 #endif
 }
 
@@ -1154,8 +1767,324 @@ int TextFileInput::seek(int64_t pos, TextFileInput::positions relativeTo)
         s = SEEK_SET;
         break;
     }
-    return fseek(stream, static_cast<long>(pos), static_cast<int>(s));
+    dropBuffer();
+    int ret = fseek(stream, static_cast<long>(pos), static_cast<int>(s));
+    if(ret == 0)
+        m_isEOF = false;
+    return ret;
+#endif
+}
+
+
+
+MappedTextFileInput::MappedTextFileInput() :
+    TextInput()
+{}
+
+MappedTextFileInput::MappedTextFileInput(const PGESTRING &filePath, bool utf8) :
+    TextInput()
+{
+    open(filePath, utf8);
+}
+
+MappedTextFileInput::~MappedTextFileInput()
+{
+    close();
+}
+
+bool MappedTextFileInput::open(const PGESTRING &filePath, bool utf8)
+{
+    close();
+
+#ifdef PGE_FILES_QT
+    m_utf8 = utf8;
+    file.setFileName(filePath);
+    if(!file.open(QIODevice::ReadOnly))
+        return false;
+
+    m_size = static_cast<int64_t>(file.size());
+    if(m_size > 0)
+    {
+        m_data = reinterpret_cast<const char *>(file.map(0, file.size()));
+        if(!m_data)
+        {
+            file.close();
+            m_size = 0;
+            return false;
+        }
+    }
+#elif defined(_WIN32)
+    (void)utf8;
+    HANDLE f = CreateFileW(Str2WStr(filePath).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                           OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if(f == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if(!GetFileSizeEx(f, &size))
+    {
+        CloseHandle(f);
+        return false;
+    }
+
+    m_fileHandle = f;
+    m_size = static_cast<int64_t>(size.QuadPart);
+    if(m_size > 0)
+    {
+        m_mapHandle = CreateFileMappingW(f, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if(m_mapHandle)
+            m_data = reinterpret_cast<const char *>(MapViewOfFile(m_mapHandle, FILE_MAP_READ, 0, 0, 0));
+        if(!m_data)
+        {
+            close();
+            return false;
+        }
+    }
+#elif defined(PGE_FILES_POSIX_MMAP)
+    (void)utf8;
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if(fd < 0)
+        return false;
+
+    struct stat st;
+    if((fstat(fd, &st) != 0) || !S_ISREG(st.st_mode))
+    {
+        ::close(fd);
+        return false;
+    }
+
+    m_size = static_cast<int64_t>(st.st_size);
+    if(m_size > 0)
+    {
+        void *mem = mmap(nullptr, static_cast<size_t>(m_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if(mem == MAP_FAILED)
+        {
+            ::close(fd);
+            m_size = 0;
+            return false;
+        }
+#   ifdef MADV_SEQUENTIAL
+        madvise(mem, static_cast<size_t>(m_size), MADV_SEQUENTIAL);
+#   endif
+        m_data = reinterpret_cast<const char *>(mem);
+    }
+    // The mapping stays valid after the descriptor has been closed
+    ::close(fd);
+#else
+    (void)filePath;
+    (void)utf8;
+    return false; // Memory mapping is not supported on this platform
+#endif
+
+    m_filePath = filePath;
+    m_lineNumber = 0;
+    m_pos = 0;
+    m_isEOF = false;
+#ifdef PGE_FILES_QT
+    skipBOM();
 #endif
+    return true;
+}
+
+bool MappedTextFileInput::reOpen(bool utf8)
+{
+#ifdef PGE_FILES_QT
+    m_utf8 = utf8;
+#else
+    (void)utf8;
+#endif
+    // The mapped data is kept as-is, just rewind the carriage
+    m_lineNumber = 0;
+    m_pos = 0;
+    m_isEOF = false;
+#ifdef PGE_FILES_QT
+    skipBOM();
+#endif
+    return !IsEmpty(m_filePath);
+}
+
+#ifdef PGE_FILES_QT
+void MappedTextFileInput::skipBOM()
+{
+    if((m_pos == 0) && (m_size >= 3) &&
+       (m_data[0] == '\xEF') && (m_data[1] == '\xBB') && (m_data[2] == '\xBF'))
+        m_pos = 3;
+}
+#endif
+
+void MappedTextFileInput::close()
+{
+#ifdef PGE_FILES_QT
+    if(m_data)
+        file.unmap(reinterpret_cast<uchar *>(const_cast<char *>(m_data)));
+    file.close();
+#elif defined(_WIN32)
+    if(m_data)
+        UnmapViewOfFile(m_data);
+    if(m_mapHandle)
+        CloseHandle(reinterpret_cast<HANDLE>(m_mapHandle));
+    if(m_fileHandle)
+        CloseHandle(reinterpret_cast<HANDLE>(m_fileHandle));
+    m_mapHandle = nullptr;
+    m_fileHandle = nullptr;
+#elif defined(PGE_FILES_POSIX_MMAP)
+    if(m_data)
+        munmap(const_cast<char *>(m_data), static_cast<size_t>(m_size));
+#endif
+    m_data = nullptr;
+    m_size = 0;
+    m_pos = 0;
+    m_isEOF = false;
+    m_filePath.clear();
+    m_lineNumber = 0;
+}
+
+PGESTRING MappedTextFileInput::read(int64_t len)
+{
+    if(IsEmpty(m_filePath) || (len < 0))
+        return "";
+
+    int64_t avail = m_size - m_pos;
+    if(avail < 0)
+        avail = 0;
+
+    int64_t got = len;
+    if(got > avail)
+    {
+        got = avail;
+        m_isEOF = true;
+    }
+
+    // Keep the same zero-padded output as TextFileInput::read() does
+    std::string buf(static_cast<size_t>(len + 1), '\0');
+    if(got > 0)
+        std::memcpy(&buf[0], m_data + m_pos, static_cast<size_t>(got));
+    m_pos += got;
+#ifdef PGE_FILES_QT
+    buf.resize(static_cast<size_t>(got)); // Qt's one returns the gotten data only
+#endif
+
+    return MAPPED_STR(buf);
+}
+
+PGESTRING MappedTextFileInput::readLine()
+{
+    if(IsEmpty(m_filePath))
+        return "";
+
+    std::string out;
+    bool finished = false;
+
+    if(m_pos < m_size)
+    {
+        const char *begin = m_data + m_pos;
+        const char *next = scanLine(begin, m_data + m_size, out, finished);
+        m_pos += static_cast<int64_t>(next - begin);
+    }
+
+    if(!finished)
+        m_isEOF = true;
+
+    if(out.empty())
+        return "";
+
+    // The QTextStream-based TextFileInput::readLine() doesn't count lines
+#ifndef PGE_FILES_QT
+    m_lineNumber++;
+#endif
+    return MAPPED_STR(out);
+}
+
+PGESTRING MappedTextFileInput::readCVSLine()
+{
+    if(IsEmpty(m_filePath) || m_isEOF)
+        return "";
+
+    std::string buffer;
+    bool quoteIsOpen = false;
+    bool finished = false;
+
+    if(m_pos < m_size)
+    {
+        const char *begin = m_data + m_pos;
+        const char *next = scanCVSField(begin, m_data + m_size, buffer, quoteIsOpen, m_lineNumber, finished);
+        m_pos += static_cast<int64_t>(next - begin);
+    }
+
+    if(!finished)
+        m_isEOF = true;
+
+    return MAPPED_STR(buffer);
+}
+
+PGESTRING MappedTextFileInput::readAll()
+{
+    if(IsEmpty(m_filePath))
+        return PGESTRING();
+
+    std::string out;
+#ifdef PGE_FILES_QT
+    // Like QTextStream::readAll(), take the rest of data after the carriage
+    if(m_data && (m_pos < m_size))
+    {
+        out.assign(m_data + m_pos, static_cast<size_t>(m_size - m_pos));
+        out.resize(removeCR(&out[0], out.size()));
+    }
+#else
+    if(m_data)
+    {
+        out.assign(m_data, static_cast<size_t>(m_size));
+        out.resize(removeCR(&out[0], out.size()));
+    }
+#endif
+    m_pos = m_size;
+    m_isEOF = true;
+
+    return MAPPED_STR(out);
+}
+
+bool MappedTextFileInput::eof()
+{
+#ifdef PGE_FILES_QT
+    // Like QTextStream::atEnd(), the end is reached once the last byte has been read
+    return m_pos >= m_size;
+#else
+    return m_isEOF;
+#endif
+}
+
+int64_t MappedTextFileInput::tell()
+{
+    return m_pos;
+}
+
+int MappedTextFileInput::seek(int64_t pos, positions relativeTo)
+{
+    int64_t newPos;
+
+    switch(relativeTo)
+    {
+    case current:
+        newPos = m_pos + pos;
+        break;
+    case end:
+        newPos = m_size + pos;
+        break;
+    case begin:
+    default:
+        newPos = pos;
+        break;
+    }
+
+    if(newPos < 0)
+        return -1;
+
+    m_pos = newPos;
+    m_isEOF = false;
+#ifdef PGE_FILES_QT
+    skipBOM();
+#endif
+    return 0;
 }
 
 
@@ -1238,6 +2167,9 @@ bool TextFileOutput::open(PGESTRING filePath, bool utf8, bool forceCRLF, TextOut
     else
         tmode = "wb";
     stream = utf8_fopen(filePath.c_str(), tmode);
+    m_buffer.clear();
+    if(stream && m_forceCRLF)
+        m_buffer.reserve(s_textFileOutputBufferSize + 2);
     return (stream != nullptr);
 #endif
 }
@@ -1251,50 +2183,85 @@ void TextFileOutput::close()
     file.close();
 #else
     if(stream)
+    {
+        flushBuffer();
         fclose(stream);
+    }
     stream = nullptr;
+    m_buffer.clear();
 #endif
 }
 
-int TextFileOutput::write(PGESTRING buffer)
+#ifndef PGE_FILES_QT
+bool TextFileOutput::flushBuffer()
 {
+    if(m_buffer.empty())
+        return true;
+    size_t len = m_buffer.size();
+    size_t written = fwrite(m_buffer.data(), 1, len, stream);
+    m_buffer.clear();
+    return (written == len);
+}
+#endif
+
+int TextFileOutput::write(const char *data, size_t len)
+{
+#ifdef PGE_FILES_QT
+    return write(QString::fromUtf8(data, static_cast<int>(len)));
+#else
     pge_size_t writtenBytes = 0;
     if(m_forceCRLF)
     {
-#ifdef PGE_FILES_QT
-        buffer.replace("\n", "\r\n");
-        writtenBytes = static_cast<pge_size_t>(file.write(m_utf8 ? buffer.toUtf8() : buffer.toLocal8Bit()));
-#else
-        for(pge_size_t i = 0; i < buffer.size(); i++)
+        const char *p = data;
+        const char *end = data + len;
+        while(p < end)
         {
-            if(buffer[i] == '\n')
+            const char *lf = reinterpret_cast<const char *>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+            const char *stop = lf ? lf : end;
+            m_buffer.append(p, static_cast<size_t>(stop - p));
+            writtenBytes += static_cast<pge_size_t>(stop - p);
+            if(lf)
             {
                 //Force writing CRLF to prevent fakse damage of file on SMBX in Windows
-                static const char bytes[2] = {0x0D, 0x0A};
-                size_t bytesNum = fwrite(&bytes, 1, 2, stream);
-                if(bytesNum == 0)
-                    return -1;
-                writtenBytes += bytesNum;
-            }
-            else
-            {
-                pge_size_t bytesNum = 1;
-                fputc(buffer[i], stream);
-                writtenBytes += bytesNum;
+                m_buffer.append("\r\n", 2);
+                writtenBytes += 2;
+                stop++;
             }
+            p = stop;
+
+            if((m_buffer.size() >= s_textFileOutputBufferSize) && !flushBuffer())
+                return -1;
         }
+    }
+    else
+    {
+        writtenBytes = static_cast<pge_size_t>(len);
+        fwrite(data, 1, len, stream);
+    }
+    return static_cast<int>(writtenBytes);
 #endif
+}
+
+int TextFileOutput::write(const PGESTRING &buffer)
+{
+#ifdef PGE_FILES_QT
+    // Write QString as-is, without a round trip through UTF-8
+    pge_size_t writtenBytes = 0;
+    if(m_forceCRLF)
+    {
+        QString crlfBuffer = buffer;
+        crlfBuffer.replace("\n", "\r\n");
+        writtenBytes = static_cast<pge_size_t>(file.write(m_utf8 ? crlfBuffer.toUtf8() : crlfBuffer.toLocal8Bit()));
     }
     else
     {
         writtenBytes = static_cast<pge_size_t>(buffer.size());
-#ifdef PGE_FILES_QT
         stream << buffer;
-#else
-        fwrite(buffer.c_str(), 1, buffer.size(), stream);
-#endif
     }
     return static_cast<int>(writtenBytes);
+#else
+    return write(buffer.data(), buffer.size());
+#endif
 }
 
 int64_t TextFileOutput::tell()
@@ -1305,7 +2272,7 @@ int64_t TextFileOutput::tell()
     else
         return static_cast<int64_t>(file.pos());
 #else
-    return ftell(stream);
+    return static_cast<int64_t>(ftell(stream)) + static_cast<int64_t>(m_buffer.size());
 #endif
 }
 
@@ -1335,6 +2302,8 @@ int TextFileOutput::seek(int64_t pos, TextOutput::positions relativeTo)
         s = SEEK_SET;
         break;
     }
+    if(!flushBuffer())
+        return -1;
     return fseek(stream, static_cast<long>(pos), static_cast<int>(s));
 #endif
 }
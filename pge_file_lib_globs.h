@@ -258,7 +258,19 @@ public:
 
     TextOutput();
     virtual ~TextOutput() = default;
-    virtual int write(PGESTRING buffer);
+    /*!
+     * \brief Write a block of UTF-8 characters
+     * \param buffer Pointer to the first character
+     * \param len Number of bytes to write
+     * \return Number of written bytes or -1 on error
+     */
+    virtual int write(const char *buffer, size_t len);
+    /*!
+     * \brief Write a string
+     * \param buffer String to write
+     * \return Number of written bytes or -1 on error
+     */
+    virtual int write(const PGESTRING &buffer);
     virtual int64_t tell();
     virtual int seek(int64_t pos, positions relativeTo);
     virtual PGESTRING getFilePath();
@@ -277,9 +289,9 @@ class RawTextInput: public TextInput
 {
 public:
     RawTextInput();
-    RawTextInput(PGESTRING *rawString, const PGESTRING &filepath = PGESTRING());
+    RawTextInput(const PGESTRING *rawString, const PGESTRING &filepath = PGESTRING());
     virtual ~RawTextInput() = default;
-    bool open(PGESTRING *rawString, const PGESTRING &filepath = PGESTRING());
+    bool open(const PGESTRING *rawString, const PGESTRING &filepath = PGESTRING());
     void close();
     virtual PGESTRING read(int64_t len);
     virtual PGESTRING readLine();
@@ -291,10 +303,56 @@ public:
 
 private:
     int64_t m_pos = 0;
-    PGESTRING *m_data = nullptr;
+    const PGESTRING *m_data = nullptr;
     bool m_isEOF = false;
 };
 
+/*!
+ * \brief Read-only text input over a caller-owned memory block
+ *
+ * Behaves like RawTextInput, but reads data in-place from a buffer
+ * which is not required to be a string object. The buffer must stay
+ * valid while it's opened. Data is expected to be UTF-8 encoded.
+ */
+class ViewTextInput: public TextInput
+{
+public:
+    ViewTextInput();
+    /*!
+     * \brief Constructor with pre-opening of the buffer
+     * \param data Pointer to the first character of the buffer
+     * \param size Size of the buffer in bytes
+     * \param filepath Path to the source file (optional)
+     */
+    ViewTextInput(const char *data, size_t size, const PGESTRING &filepath = PGESTRING());
+    virtual ~ViewTextInput() = default;
+    /*!
+     * \brief Opening of the buffer
+     * \param data Pointer to the first character of the buffer
+     * \param size Size of the buffer in bytes
+     * \param filepath Path to the source file (optional)
+     * \return true if buffer has been opened
+     */
+    bool open(const char *data, size_t size, const PGESTRING &filepath = PGESTRING());
+    void close();
+    virtual PGESTRING read(int64_t len);
+    virtual PGESTRING readLine();
+    virtual PGESTRING readCVSLine();
+    virtual PGESTRING readAll();
+    virtual bool eof();
+    virtual int64_t tell();
+    virtual int seek(int64_t pos, positions relativeTo);
+
+private:
+    //! Beginning of the viewed data
+    const char *m_data = nullptr;
+    //! Size of the viewed data
+    int64_t m_size = 0;
+    //! Current position of carriage
+    int64_t m_pos = 0;
+    bool m_isEOF = true;
+};
+
 class RawTextOutput: public TextOutput
 {
 public:
@@ -303,10 +361,18 @@ public:
     virtual ~RawTextOutput();
     bool open(PGESTRING *rawString, outputMode mode = truncate);
     void close();
-    int write(PGESTRING buffer);
+    int write(const char *data, size_t len);
+    int write(const PGESTRING &buffer);
     int64_t tell();
     int seek(int64_t pos, positions relativeTo);
 private:
+#ifdef PGE_FILES_QT
+    typedef QChar CharType;
+#else
+    typedef char CharType;
+#endif
+    //! Writes characters at the carriage position, overwriting the existing data
+    int writeChars(const CharType *src, int64_t srcLen);
     long long m_pos = 0ll;
     PGESTRING *m_data = nullptr;
 };
@@ -413,8 +479,147 @@ private:
     //! File input stream used in Qt version of PGE file Library
     QTextStream stream;
 #else
+    /*!
+     * \brief Refill the read buffer from the file stream
+     * \return false if no more data available
+     */
+    bool fillBuffer();
+    /*!
+     * \brief Drop buffered data to make file stream position being actual
+     */
+    void dropBuffer();
+
     //! File input stream used in STL version of PGE file Library
     FILE *stream = nullptr;
+    //! Block read buffer
+    std::vector<char> m_buffer;
+    //! Position of carriage in the read buffer
+    size_t m_bufferPos = 0;
+    //! Length of actual data in the read buffer
+    size_t m_bufferLen = 0;
+    //! End of file has been reached by last read operation
+    bool m_isEOF = false;
+#endif
+};
+
+
+/*!
+ * \brief Provides text file reading interface over a read-only memory mapping of the file
+ *
+ * Behaves like TextFileInput, but serves all reads directly from the mapped memory
+ * instead of reading the file stream byte by byte. When the file can't be mapped
+ * (unsupported platform, special file, etc.) the open() call fails and the caller
+ * should fall back to TextFileInput.
+ */
+class MappedTextFileInput: public TextInput
+{
+public:
+    /*!
+     * \brief Constructor
+     */
+    MappedTextFileInput();
+
+    /*!
+     * \brief Constructor with pre-opening of the file
+     * \param filePath Full or relative path to the file
+     * \param utf8 Use UTF-8 encoding or will be used local 8-bin encoding
+     */
+    MappedTextFileInput(const PGESTRING &filePath, bool utf8 = false);
+
+    /*!
+     * \brief Destructor
+     */
+    virtual ~MappedTextFileInput();
+
+    /*!
+     * \brief Opening and mapping of the file
+     * \param filePath Full or relative path to the file
+     * \param utf8 Use UTF-8 encoding or will be used local 8-bin encoding
+     * \return true if file was successfully opened and mapped
+     */
+    bool open(const PGESTRING &filePath, bool utf8 = false);
+
+    /*!
+     * \brief Re-open opened file with or without UTF8 mode enabled
+     * \param utf8 Use UTF-8 encoding or will be used local 8-bin encoding
+     */
+    bool reOpen(bool utf8 = false);
+
+    /*!
+     * \brief Unmap and close currently opened file
+     */
+    void close();
+
+    /*!
+     * \brief Reads requested number of characters from a file
+     * \param Maximal lenght of characters to read from file
+     * \return string contains requested line of characters
+     */
+    PGESTRING read(int64_t len);
+
+    /*!
+     * \brief Reads whole line before line feed character
+     * \return string contains gotten line
+     */
+    PGESTRING readLine();
+
+    /*!
+     * \brief Reads whole line before line feed character or before first unquoted comma
+     * \return string contains gotten line
+     */
+    PGESTRING readCVSLine();
+
+    /*!
+     * \brief Reads all data from a file
+     * \return
+     */
+    PGESTRING readAll();
+
+    /*!
+     * \brief Is carriage position at end of file
+     * \return true if carriage position at end of file
+     */
+    bool eof();
+
+    /*!
+     * \brief Returns current position of carriage relative to begin of file
+     * \return current position of carriage relative to begin of file
+     */
+    int64_t tell();
+
+    /*!
+     * \brief Changes position of carriage to specific file position
+     * \param pos Target position of carriage
+     * \param relativeTo defines relativity of target position of carriage (current position, begin of file or end of file)
+     */
+    int seek(int64_t pos, positions relativeTo);
+
+private:
+#ifdef PGE_FILES_QT
+    /*!
+     * \brief Moves the carriage past the UTF-8 byte order mark at begin of data, like QTextStream does
+     */
+    void skipBOM();
+#endif
+
+    //! Mapped file data
+    const char *m_data = nullptr;
+    //! Size of mapped file data
+    int64_t m_size = 0;
+    //! Current position of carriage
+    int64_t m_pos = 0;
+    //! End of file has been reached by last read operation
+    bool m_isEOF = false;
+#ifdef PGE_FILES_QT
+    //! Read as UTF8 or as ANSI
+    bool m_utf8 = true;
+    //! File handler used in Qt version of PGE file Library
+    QFile file;
+#elif defined(_WIN32)
+    //! Handle of the opened file
+    void *m_fileHandle = nullptr;
+    //! Handle of the file mapping object
+    void *m_mapHandle = nullptr;
 #endif
 };
 
@@ -453,11 +658,18 @@ public:
      */
     void close();
     /*!
-     * \brief Reads requested number of characters from a file
-     * \param Maximal lenght of characters to read from file
-     * \return string contains requested line of characters
+     * \brief Writes a block of characters into the file
+     * \param data Pointer to the first character
+     * \param len Number of bytes to write
+     * \return Number of written bytes or -1 on error
+     */
+    int write(const char *data, size_t len);
+    /*!
+     * \brief Writes a string into the file
+     * \param buffer String to write
+     * \return Number of written bytes or -1 on error
      */
-    int write(PGESTRING buffer);
+    int write(const PGESTRING &buffer);
     /*!
      * \brief Returns current position of carriage relative to begin of file
      * \return current position of carriage relative to begin of file
@@ -481,8 +693,16 @@ private:
     //! File input stream used in Qt version of PGE file Library
     QTextStream stream;
 #else
+    /*!
+     * \brief Write all buffered data into the file stream
+     * \return false on write error
+     */
+    bool flushBuffer();
+
     //! File input stream used in STL version of PGE file Library
     FILE *stream = nullptr;
+    //! Block write buffer used for the CRLF translation
+    std::string m_buffer;
 #endif
 };
 
@@ -29,6 +29,119 @@
 #define PGE_FILE_LIB_PRIVATE_H_
 
 #include "pge_file_lib_globs.h"
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace PGE_FileFormats_misc
+{
+    //! Size of the buffer enough to store any number formatted by numToChars() with a null terminator
+    const size_t NUM_BUFFER_SIZE = 32;
+
+    /*
+     * Locale-independent number formatting into the caller's buffer, returns a length
+     * of the result. Floating point numbers are printed as "%g" with the shortest
+     * precision which still reads back into the same value.
+     */
+    size_t intToChars(char *buf, long long value);
+    size_t uintToChars(char *buf, unsigned long long value);
+    size_t floatToChars(char *buf, double value);
+    size_t floatToChars(char *buf, float value);
+
+    /*!
+     * \brief Parses decimal integer like strtoull() does, but without locale lookups and errno
+     * \param begin Begin of the text
+     * \param end End of the text, parsing also stops at the first non-digit character
+     * \param negative Is minus sign met
+     * \param magnitude Absolute value of the number
+     * \param overflow Is number too big for unsigned long long
+     * \return false if text doesn't begin with a number (spaces and a sign are allowed)
+     */
+    bool parseDecimal(const char *begin, const char *end, bool &negative,
+                      unsigned long long &magnitude, bool &overflow);
+
+    inline size_t numToCharsT(char *buf, float value, std::true_type)
+    {
+        return floatToChars(buf, value);
+    }
+
+    template<typename T>
+    inline size_t numToCharsT(char *buf, T value, std::true_type)
+    {
+        return floatToChars(buf, static_cast<double>(value));
+    }
+
+    template<typename T>
+    inline size_t numToCharsT(char *buf, T value, std::false_type)
+    {
+        if(std::is_unsigned<T>::value)
+            return uintToChars(buf, static_cast<unsigned long long>(value));
+        return intToChars(buf, static_cast<long long>(value));
+    }
+
+    /*!
+     * \brief Formats any arithmetic value into the buffer
+     * \param buf Buffer of NUM_BUFFER_SIZE bytes at least
+     * \param value Integer or floating point value
+     * \return Length of the result
+     */
+    template<typename T>
+    inline size_t numToChars(char *buf, T value)
+    {
+        return numToCharsT(buf, value, std::is_floating_point<T>());
+    }
+
+    /*!
+     * \brief URL-encodes data into the buffer
+     * \param dst Destination buffer of len * 3 bytes at least
+     * \param src Data to encode
+     * \param len Length of the data
+     * \param minimal Keep unreserved characters (A-Z, a-z, 0-9, -, _, . and ~) as is
+     *        instead of encoding every byte
+     * \return Length of the encoded data
+     */
+    size_t url_encode(char *dst, const char *src, size_t len, bool minimal = false);
+
+    //! Appends URL-encoded data to the string, allocates the exact size, see url_encode()
+    void url_encode_append(std::string &dst, const char *src, size_t len, bool minimal = false);
+
+    //! URL-encoded string which is written into the TextOutput without temporary strings
+    struct UrlEncoded
+    {
+        const PGESTRING &src;
+        bool minimal;
+    };
+
+    TextOutput &operator<<(TextOutput &out, const UrlEncoded &data);
+
+    //! Number which is written into the TextOutput without temporary strings, see numToChars()
+    template<typename T>
+    struct NumberOut
+    {
+        T value;
+        //! Write the line feed after the number
+        bool lineFeed;
+    };
+
+    template<typename T>
+    inline NumberOut<T> numOut(T value, bool lineFeed = false)
+    {
+        return NumberOut<T>{value, lineFeed};
+    }
+
+    template<typename T>
+    inline TextOutput &operator<<(TextOutput &out, const NumberOut<T> &num)
+    {
+        char buf[NUM_BUFFER_SIZE];
+        size_t len = numToChars(buf, num.value);
+        if(num.lineFeed)
+            buf[len++] = '\n'; // Takes place of the null terminator
+        out.write(buf, len);
+        return out;
+    }
+}
+
+#define PGE_NUM_OUT(num) PGE_FileFormats_misc::numOut(num)
 
 #ifdef PGE_FILES_QT
 #include <QString>
@@ -169,17 +282,19 @@ inline PGESTRING removeSpaces(PGESTRING src)
 template<typename T>
 PGESTRING fromNum(T num)
 {
-    return QString::number(num);
+    char buf[PGE_FileFormats_misc::NUM_BUFFER_SIZE];
+    size_t len = PGE_FileFormats_misc::numToChars(buf, num);
+    return QString::fromLatin1(buf, static_cast<int>(len));
 }
 
 inline PGESTRING fromBoolToNum(bool num)
 {
-    return QString::number(static_cast<int>(num));
+    return num ? QStringLiteral("1") : QStringLiteral("0");
 }
 
 namespace PGE_FileFormats_misc
 {
-    PGESTRING    url_encode(const PGESTRING &sSrc);
+    PGESTRING    url_encode(const PGESTRING &sSrc, bool minimal = false);
     std::string  base64_encode(uint8_t const *bytes_to_encode, size_t in_len, bool no_padding = false);
     std::string  base64_encode(std::string const &source, bool no_padding = false);
     std::string  base64_decode(std::string const &encoded_string);
@@ -194,6 +309,7 @@ inline PGESTRING PGE_URLENC(const PGESTRING &src)
 {
     return PGE_FileFormats_misc::url_encode(src);
 }
+#define PGE_URLENC_OUT(src) PGE_FileFormats_misc::UrlEncoded{src, false}
 inline PGESTRING PGE_URLDEC(const PGESTRING &src)
 {
     /* Don't call fromPercentEncoding() on Windows with empty string,
@@ -202,6 +318,12 @@ inline PGESTRING PGE_URLDEC(const PGESTRING &src)
         return PGESTRING();
     return QUrl::fromPercentEncoding(src.toUtf8());
 }
+inline void PGE_URLDEC_INPLACE(PGESTRING &str)
+{
+    // Nothing to decode when there are no escape sequences
+    if(str.contains(QLatin1Char('%')))
+        str = PGE_URLDEC(str);
+}
 #define PGE_BASE64ENC(src)   PGE_FileFormats_misc::base64_encode(src)
 #define PGE_BASE64ENC_nopad(src)   PGE_FileFormats_misc::base64_encode(src, true)
 #define PGE_BASE64DEC(src)   PGE_FileFormats_misc::base64_decode(src)
@@ -285,8 +407,21 @@ namespace PGE_FileFormats_misc
     void replaceAll(std::string &str, const std::string &from, const std::string &to);
     void RemoveSub(std::string &sInput, const std::string &sub);
     bool hasEnding(std::string const &fullString, std::string const &ending);
-    PGESTRING url_encode(const PGESTRING &sSrc);
+    PGESTRING url_encode(const PGESTRING &sSrc, bool minimal = false);
     PGESTRING url_decode(const std::string &sSrc);
+    /*!
+     * \brief Decodes URL-encoded data into the buffer
+     * \param dst Destination buffer of at least len bytes, may be the same as src
+     * \param src Encoded data
+     * \param len Length of the encoded data
+     * \return Length of the decoded data
+     */
+    size_t url_decode(char *dst, const char *src, size_t len);
+    /*!
+     * \brief Decodes URL-encoded string in place, without allocations
+     * \param str String to decode
+     */
+    void url_decode_inplace(std::string &str);
     std::string base64_encode(unsigned char const *bytes_to_encode, size_t in_len, bool no_padding = false);
     std::string base64_encode(std::string const &source, bool no_padding = false);
     std::string base64_decode(std::string const &encoded_string);
@@ -398,19 +533,18 @@ inline PGESTRING removeSpaces(const PGESTRING &src)
 template<typename T>
 PGESTRING fromNum(T num)
 {
-    std::ostringstream n;
-    n << num;
-    return n.str();
+    char buf[PGE_FileFormats_misc::NUM_BUFFER_SIZE];
+    return PGESTRING(buf, PGE_FileFormats_misc::numToChars(buf, num));
 }
 
 inline PGESTRING fromBoolToNum(bool num)
 {
-    std::ostringstream n;
-    n << static_cast<int>(num);
-    return n.str();
+    return PGESTRING(num ? "1" : "0", 1);
 }
 #define PGE_URLENC(src) PGE_FileFormats_misc::url_encode(src)
+#define PGE_URLENC_OUT(src) PGE_FileFormats_misc::UrlEncoded{src, false}
 #define PGE_URLDEC(src) PGE_FileFormats_misc::url_decode(src)
+#define PGE_URLDEC_INPLACE(str) PGE_FileFormats_misc::url_decode_inplace(str)
 #define PGE_BASE64ENC(src)   PGE_FileFormats_misc::base64_encode(src)
 #define PGE_BASE64ENC_nopad(src) PGE_FileFormats_misc::base64_encode(src, true)
 #define PGE_BASE64DEC(src)   PGE_FileFormats_misc::base64_decode(src)
@@ -0,0 +1,472 @@
+/*
+ * PGE File Library - a library to process file formats, part of Moondust project
+ *
+ * Copyright (c) 2014-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "pge_file_lib_simd.h"
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#   define PGEFL_SIMD_SSE2
+#   include <emmintrin.h>
+#   if defined(__GNUC__) || defined(__clang__)
+#       define PGEFL_SIMD_AVX2
+#       define PGEFL_TARGET_AVX2 __attribute__((target("avx2")))
+#       include <immintrin.h>
+#   elif defined(__AVX2__)
+#       define PGEFL_SIMD_AVX2
+#       define PGEFL_TARGET_AVX2
+#       include <immintrin.h>
+#   endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#   define PGEFL_SIMD_NEON
+#   include <arm_neon.h>
+#endif
+
+namespace PGE_FileFormats_misc
+{
+
+#ifdef PGEFL_SIMD_AVX2
+static bool cpuHasAVX2()
+{
+#   if defined(__GNUC__) || defined(__clang__)
+    static const bool has = __builtin_cpu_supports("avx2");
+    return has;
+#   else
+    return true; // Built with AVX2 enabled
+#   endif
+}
+#endif
+
+static inline unsigned countTrailingZeros(unsigned v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctz(v));
+#else
+    unsigned n = 0;
+    while(!(v & 1u))
+    {
+        v >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/*
+ * Copies a block of "width" bytes from src to dst, dropping bytes marked in the mask.
+ * The dst is never ahead of the src, so an in-place compaction is safe.
+ */
+static inline char *compactBlock(char *dst, const char *src, unsigned mask, unsigned width)
+{
+    unsigned start = 0;
+    while(mask)
+    {
+        unsigned bit = countTrailingZeros(mask);
+        std::memmove(dst, src + start, bit - start);
+        dst += bit - start;
+        start = bit + 1;
+        mask &= mask - 1;
+    }
+    std::memmove(dst, src + start, width - start);
+    return dst + (width - start);
+}
+
+static size_t removeCR_scalar(char *dst, const char *src, const char *end, char *begin)
+{
+    for(; src < end; ++src)
+    {
+        if(*src != '\r')
+            *dst++ = *src;
+    }
+    return static_cast<size_t>(dst - begin);
+}
+
+#ifdef PGEFL_SIMD_AVX2
+PGEFL_TARGET_AVX2
+static size_t removeCR_avx2(char *data, size_t len)
+{
+    const __m256i cr = _mm256_set1_epi8('\r');
+    const char *src = data, *end = data + len;
+    char *dst = data;
+
+    while(end - src >= 32)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, cr)));
+        if(mask == 0)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), v);
+            dst += 32;
+        }
+        else
+            dst = compactBlock(dst, src, mask, 32);
+        src += 32;
+    }
+
+    return removeCR_scalar(dst, src, end, data);
+}
+#endif
+
+size_t removeCR(char *data, size_t len)
+{
+    const char *src = data, *end = data + len;
+    char *dst = data;
+
+    // Nothing to do if there is no CR at all
+    const char *cr = reinterpret_cast<const char *>(std::memchr(data, '\r', len));
+    if(!cr)
+        return len;
+    src = dst = const_cast<char *>(cr);
+
+#if defined(PGEFL_SIMD_AVX2)
+    if(cpuHasAVX2())
+        return static_cast<size_t>(dst - data) + removeCR_avx2(dst, static_cast<size_t>(end - src));
+#endif
+
+#if defined(PGEFL_SIMD_SSE2)
+    const __m128i crv = _mm_set1_epi8('\r');
+    while(end - src >= 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, crv)));
+        if(mask == 0)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), v);
+            dst += 16;
+        }
+        else
+            dst = compactBlock(dst, src, mask, 16);
+        src += 16;
+    }
+#elif defined(PGEFL_SIMD_NEON)
+    const uint8x16_t crv = vdupq_n_u8('\r');
+    while(end - src >= 16)
+    {
+        uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t *>(src));
+        if(vmaxvq_u8(vceqq_u8(v, crv)) == 0)
+        {
+            vst1q_u8(reinterpret_cast<uint8_t *>(dst), v);
+            dst += 16;
+        }
+        else
+        {
+            for(int i = 0; i < 16; ++i)
+            {
+                if(src[i] != '\r')
+                    *dst++ = src[i];
+            }
+        }
+        src += 16;
+    }
+#endif
+
+    return removeCR_scalar(dst, src, end, data);
+}
+
+
+static inline bool isEscapable(char c)
+{
+    switch(c)
+    {
+    case '\n':
+    case '\r':
+    case '\"':
+    case ';':
+    case ':':
+    case '[':
+    case ']':
+    case ',':
+    case '%':
+    case '\\':
+        return true;
+    default:
+        return false;
+    }
+}
+
+static size_t findEscapable_scalar(const char *data, const char *src, const char *end)
+{
+    for(; src < end; ++src)
+    {
+        if(isEscapable(*src))
+            break;
+    }
+    return static_cast<size_t>(src - data);
+}
+
+#ifdef PGEFL_SIMD_AVX2
+PGEFL_TARGET_AVX2
+static size_t findEscapable_avx2(const char *data, size_t len)
+{
+    const __m256i lf = _mm256_set1_epi8('\n'), cr = _mm256_set1_epi8('\r');
+    const __m256i quote = _mm256_set1_epi8('\"'), semicolon = _mm256_set1_epi8(';');
+    const __m256i colon = _mm256_set1_epi8(':'), lbracket = _mm256_set1_epi8('[');
+    const __m256i rbracket = _mm256_set1_epi8(']'), comma = _mm256_set1_epi8(',');
+    const __m256i percent = _mm256_set1_epi8('%'), backslash = _mm256_set1_epi8('\\');
+    const char *src = data, *end = data + len;
+
+    while(end - src >= 32)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+        __m256i m = _mm256_or_si256(_mm256_cmpeq_epi8(v, lf), _mm256_cmpeq_epi8(v, cr));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, quote));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, semicolon));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, colon));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, lbracket));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, rbracket));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, comma));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, percent));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, backslash));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(m));
+        if(mask != 0)
+            return static_cast<size_t>(src - data) + countTrailingZeros(mask);
+        src += 32;
+    }
+
+    return findEscapable_scalar(data, src, end);
+}
+#endif
+
+size_t findEscapable(const char *data, size_t len)
+{
+    const char *src = data, *end = data + len;
+
+#if defined(PGEFL_SIMD_AVX2)
+    if(len >= 32 && cpuHasAVX2())
+        return findEscapable_avx2(data, len);
+#endif
+
+#if defined(PGEFL_SIMD_SSE2)
+    const __m128i lf = _mm_set1_epi8('\n'), cr = _mm_set1_epi8('\r');
+    const __m128i quote = _mm_set1_epi8('\"'), semicolon = _mm_set1_epi8(';');
+    const __m128i colon = _mm_set1_epi8(':'), lbracket = _mm_set1_epi8('[');
+    const __m128i rbracket = _mm_set1_epi8(']'), comma = _mm_set1_epi8(',');
+    const __m128i percent = _mm_set1_epi8('%'), backslash = _mm_set1_epi8('\\');
+    while(end - src >= 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, lf), _mm_cmpeq_epi8(v, cr));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, quote));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, semicolon));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, colon));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, lbracket));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, rbracket));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, comma));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, percent));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, backslash));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(m));
+        if(mask != 0)
+            return static_cast<size_t>(src - data) + countTrailingZeros(mask);
+        src += 16;
+    }
+#elif defined(PGEFL_SIMD_NEON)
+    const uint8x16_t lf = vdupq_n_u8('\n'), cr = vdupq_n_u8('\r');
+    const uint8x16_t quote = vdupq_n_u8('\"'), semicolon = vdupq_n_u8(';');
+    const uint8x16_t colon = vdupq_n_u8(':'), lbracket = vdupq_n_u8('[');
+    const uint8x16_t rbracket = vdupq_n_u8(']'), comma = vdupq_n_u8(',');
+    const uint8x16_t percent = vdupq_n_u8('%'), backslash = vdupq_n_u8('\\');
+    while(end - src >= 16)
+    {
+        uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t *>(src));
+        uint8x16_t m = vorrq_u8(vceqq_u8(v, lf), vceqq_u8(v, cr));
+        m = vorrq_u8(m, vceqq_u8(v, quote));
+        m = vorrq_u8(m, vceqq_u8(v, semicolon));
+        m = vorrq_u8(m, vceqq_u8(v, colon));
+        m = vorrq_u8(m, vceqq_u8(v, lbracket));
+        m = vorrq_u8(m, vceqq_u8(v, rbracket));
+        m = vorrq_u8(m, vceqq_u8(v, comma));
+        m = vorrq_u8(m, vceqq_u8(v, percent));
+        m = vorrq_u8(m, vceqq_u8(v, backslash));
+        if(vmaxvq_u8(m) != 0)
+            return findEscapable_scalar(data, src, src + 16);
+        src += 16;
+    }
+#endif
+
+    return findEscapable_scalar(data, src, end);
+}
+
+
+/*
+ * Class of characters for the shared scanner: up to three inclusive ranges and up to
+ * four single characters, all of them must be in the 0x00...0x7E range. Unused ranges
+ * are empty (first is greater than last), unused characters repeat one of the used.
+ */
+struct CharClass
+{
+    char first[3];
+    char last[3];
+    char single[4];
+};
+
+static inline bool inCharClass(char c, const CharClass &cls)
+{
+    for(int i = 0; i < 3; i++)
+    {
+        if((c >= cls.first[i]) && (c <= cls.last[i]))
+            return true;
+    }
+    for(int i = 0; i < 4; i++)
+    {
+        if(c == cls.single[i])
+            return true;
+    }
+    return false;
+}
+
+// Finds the first character which is in the class (if "match" is set) or out of the class
+static size_t findCharClass_scalar(const char *data, const char *src, const char *end,
+                                   const CharClass &cls, bool match)
+{
+    for(; src < end; ++src)
+    {
+        if(inCharClass(*src, cls) == match)
+            break;
+    }
+    return static_cast<size_t>(src - data);
+}
+
+/*
+ * x86 vectors are compared as signed bytes: bytes above 0x7F are negative
+ * and never pass the range checks of the class limited by 0x7E.
+ */
+#ifdef PGEFL_SIMD_AVX2
+PGEFL_TARGET_AVX2
+static size_t findCharClass_avx2(const char *data, size_t len, const CharClass &cls, bool match)
+{
+    __m256i lo[3], hi[3], single[4];
+    const char *src = data, *end = data + len;
+
+    for(int i = 0; i < 3; i++)
+    {
+        lo[i] = _mm256_set1_epi8(static_cast<char>(cls.first[i] - 1));
+        hi[i] = _mm256_set1_epi8(static_cast<char>(cls.last[i] + 1));
+    }
+    for(int i = 0; i < 4; i++)
+        single[i] = _mm256_set1_epi8(cls.single[i]);
+
+    while(end - src >= 32)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+        __m256i in = _mm256_cmpeq_epi8(v, single[0]);
+        for(int i = 1; i < 4; i++)
+            in = _mm256_or_si256(in, _mm256_cmpeq_epi8(v, single[i]));
+        for(int i = 0; i < 3; i++)
+            in = _mm256_or_si256(in, _mm256_and_si256(_mm256_cmpgt_epi8(v, lo[i]), _mm256_cmpgt_epi8(hi[i], v)));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(in));
+        if(!match)
+            mask = ~mask;
+        if(mask != 0)
+            return static_cast<size_t>(src - data) + countTrailingZeros(mask);
+        src += 32;
+    }
+
+    return findCharClass_scalar(data, src, end, cls, match);
+}
+#endif
+
+static size_t findCharClass(const char *data, size_t len, const CharClass &cls, bool match)
+{
+    const char *src = data, *end = data + len;
+
+#if defined(PGEFL_SIMD_AVX2)
+    if(len >= 32 && cpuHasAVX2())
+        return findCharClass_avx2(data, len, cls, match);
+#endif
+
+#if defined(PGEFL_SIMD_SSE2)
+    __m128i lo[3], hi[3], single[4];
+    for(int i = 0; i < 3; i++)
+    {
+        lo[i] = _mm_set1_epi8(static_cast<char>(cls.first[i] - 1));
+        hi[i] = _mm_set1_epi8(static_cast<char>(cls.last[i] + 1));
+    }
+    for(int i = 0; i < 4; i++)
+        single[i] = _mm_set1_epi8(cls.single[i]);
+
+    while(end - src >= 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        __m128i in = _mm_cmpeq_epi8(v, single[0]);
+        for(int i = 1; i < 4; i++)
+            in = _mm_or_si128(in, _mm_cmpeq_epi8(v, single[i]));
+        for(int i = 0; i < 3; i++)
+            in = _mm_or_si128(in, _mm_and_si128(_mm_cmpgt_epi8(v, lo[i]), _mm_cmplt_epi8(v, hi[i])));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(in));
+        if(!match)
+            mask ^= 0xFFFFu;
+        if(mask != 0)
+            return static_cast<size_t>(src - data) + countTrailingZeros(mask);
+        src += 16;
+    }
+#elif defined(PGEFL_SIMD_NEON)
+    uint8x16_t lo[3], hi[3], single[4];
+    for(int i = 0; i < 3; i++)
+    {
+        lo[i] = vdupq_n_u8(static_cast<uint8_t>(cls.first[i]));
+        hi[i] = vdupq_n_u8(static_cast<uint8_t>(cls.last[i]));
+    }
+    for(int i = 0; i < 4; i++)
+        single[i] = vdupq_n_u8(static_cast<uint8_t>(cls.single[i]));
+
+    while(end - src >= 16)
+    {
+        uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t *>(src));
+        uint8x16_t in = vceqq_u8(v, single[0]);
+        for(int i = 1; i < 4; i++)
+            in = vorrq_u8(in, vceqq_u8(v, single[i]));
+        for(int i = 0; i < 3; i++)
+            in = vorrq_u8(in, vandq_u8(vcgeq_u8(v, lo[i]), vcleq_u8(v, hi[i])));
+        if(match ? (vmaxvq_u8(in) != 0) : (vminvq_u8(in) == 0))
+            return findCharClass_scalar(data, src, src + 16, cls, match);
+        src += 16;
+    }
+#endif
+
+    return findCharClass_scalar(data, src, end, cls, match);
+}
+
+
+size_t findNonBase64(const char *data, size_t len)
+{
+    static const CharClass base64 = {{'A', 'a', '0'}, {'Z', 'z', '9'}, {'+', '/', '/', '/'}};
+    return findCharClass(data, len, base64, false);
+}
+
+
+size_t findUrlEncodable(const char *data, size_t len)
+{
+    static const CharClass unreserved = {{'A', 'a', '0'}, {'Z', 'z', '9'}, {'-', '_', '.', '~'}};
+    return findCharClass(data, len, unreserved, false);
+}
+
+
+size_t findCSVDelimiter(const char *data, size_t len)
+{
+    static const CharClass delimiters = {{1, 1, 1}, {0, 0, 0}, {'\n', ',', '\"', '\r'}};
+    return findCharClass(data, len, delimiters, true);
+}
+
+}
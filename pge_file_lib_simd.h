@@ -0,0 +1,86 @@
+/*
+ * PGE File Library - a library to process file formats, part of Moondust project
+ *
+ * Copyright (c) 2014-2023 Vitaly Novichkov <admin@wohlnet.ru>
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#ifndef PGE_FILE_LIB_SIMD_H_
+#define PGE_FILE_LIB_SIMD_H_
+
+/*!
+ * \file pge_file_lib_simd.h
+ * \brief Contains internally used vectorized text processing kernels
+ *
+ * Every kernel has SSE2, AVX2 (chosen at run time) and NEON implementations
+ * with a scalar fallback for all other targets.
+ */
+
+#include <cstddef>
+
+namespace PGE_FileFormats_misc
+{
+
+/*!
+ * \brief Removes all CR characters from the buffer in place
+ * \param data Buffer to process
+ * \param len Length of the buffer
+ * \return New length of data in the buffer
+ */
+size_t removeCR(char *data, size_t len);
+
+/*!
+ * \brief Finds the first character which must be escaped in PGE-X string value
+ * \param data Buffer to scan
+ * \param len Length of the buffer
+ * \return Position of the found character, or len if there are no such characters
+ */
+size_t findEscapable(const char *data, size_t len);
+
+/*!
+ * \brief Finds the first character which is not a part of base64 alphabet (A-Z, a-z, 0-9, + and /)
+ * \param data Buffer to scan
+ * \param len Length of the buffer
+ * \return Position of the found character, or len if all characters are valid
+ */
+size_t findNonBase64(const char *data, size_t len);
+
+/*!
+ * \brief Finds the first character which must be URL-encoded (not A-Z, a-z, 0-9, -, _, . or ~)
+ * \param data Buffer to scan
+ * \param len Length of the buffer
+ * \return Position of the found character, or len if there are no such characters
+ */
+size_t findUrlEncodable(const char *data, size_t len);
+
+/*!
+ * \brief Finds the first character which may delimit CSV fields (line feed, comma, quote or CR)
+ * \param data Buffer to scan
+ * \param len Length of the buffer
+ * \return Position of the found character, or len if there are no such characters
+ */
+size_t findCSVDelimiter(const char *data, size_t len);
+
+}
+
+#endif // PGE_FILE_LIB_SIMD_H_
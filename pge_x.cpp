@@ -27,23 +27,21 @@
 #ifdef PGE_FILES_QT
 #include <QMutex>
 #include <QMutexLocker>
-#ifndef PGEFL_QRegExp
-#   if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
-#       include <QRegularExpression>
-#       define PGEFL_QRegExp QRegularExpression
-#       define PGEFL_Match(x) match(x).hasMatch()
-#   else
-#       include <QRegExp>
-#       define PGEFL_QRegExp QRegExp
-#       define PGEFL_Match(x) exactMatch(x)
-#   endif
 #endif
-#else
-#include <regex>
+
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include <vector>
+#ifdef PGEFL_ENABLE_THREADS
+#include <atomic>
+#include <system_error>
+#include <thread>
 #endif
 
 #include "pge_x.h"
-#include "file_strlist.h"
+#include "pge_file_lib_simd.h"
 
 namespace PGEExtendedFormat
 {
@@ -55,6 +53,49 @@ namespace PGEExtendedFormat
         return ((c >= '0') && (c <= '9'));
     }
 
+    /*!
+     * \brief Parses the signed integer entry of integer array and moves the pointer past it
+     * \param p Pointer to the begin of entry
+     * \param end End of the array data
+     * \param out Parsed value, saturated to the range of long
+     * \return true if entry has at least one digit
+     */
+    static bool parseIntArrEntry(const PGEChar *&p, const PGEChar *end, long &out)
+    {
+        bool negative = false;
+        bool overflow = false;
+        unsigned long value = 0;
+        const unsigned long limit = static_cast<unsigned long>(LONG_MAX) + 1;
+
+        if(p != end && *p == '-')
+        {
+            negative = true;
+            p++;
+        }
+
+        const PGEChar *digits = p;
+        for(; p != end && isDegit(*p); p++)
+        {
+            unsigned long d = static_cast<unsigned long>(PGEGetChar(*p) - '0');
+            if(value > (limit - d) / 10)
+                overflow = true;
+            else
+                value = value * 10 + d;
+        }
+
+        if(p == digits)
+            return false;
+
+        if(overflow || value > limit - (negative ? 0 : 1))
+            out = negative ? LONG_MIN : LONG_MAX;
+        else if(negative)
+            out = (value == limit) ? LONG_MIN : -static_cast<long>(value);
+        else
+            out = static_cast<long>(value);
+
+        return true;
+    }
+
     static bool isValid(const PGESTRING &s, const char *valid_chars, const pge_size_t valid_chars_len, bool allow_empty = false)
     {
         if(IsEmpty(s))
@@ -81,6 +122,477 @@ namespace PGEExtendedFormat
 
         return true;
     }
+
+    /*!
+     * \brief Line of raw PGE-X data given as range of characters
+     */
+    struct RawLine
+    {
+        //! First character of the line
+        const PGEChar *begin;
+        //! Character after the last one of the line
+        const PGEChar *end;
+    };
+
+    typedef std::vector<RawLine> RawLines;
+
+    static inline const PGEChar *rawChars(const PGESTRING &s)
+    {
+#ifdef PGE_FILES_QT
+        return s.constData();
+#else
+        return s.data();
+#endif
+    }
+
+    static inline PGEChar *mutableChars(PGESTRING &s)
+    {
+#ifdef PGE_FILES_QT
+        return s.data();
+#else
+        return &s[0];
+#endif
+    }
+
+    /*!
+     * \brief Finds the first character which must be escaped in the string value
+     * \return Position of found character or size of the string if nothing to escape
+     */
+    static inline pge_size_t findEscapable(const PGESTRING &s)
+    {
+#ifdef PGE_FILES_QT
+        for(pge_size_t i = 0; i < s.size(); i++)
+        {
+            char c = PGEGetChar(s[i]);
+            if(c && std::strchr("\n\r\";:[],%\\", c))
+                return i;
+        }
+        return s.size();
+#else
+        return PGE_FileFormats_misc::findEscapable(s.data(), s.size());
+#endif
+    }
+
+    /*!
+     * \brief Finds the first backslash in the string value
+     * \return Position of found character or size of the string if no backslashes
+     */
+    static inline pge_size_t findBackslash(const PGESTRING &s)
+    {
+#ifdef PGE_FILES_QT
+        int pos = s.indexOf(QChar('\\'));
+        return pos < 0 ? s.size() : pos;
+#else
+        const char *pos = reinterpret_cast<const char *>(std::memchr(s.data(), '\\', s.size()));
+        return pos ? static_cast<pge_size_t>(pos - s.data()) : s.size();
+#endif
+    }
+
+    static inline pge_size_t lineLength(const RawLine &l)
+    {
+        return static_cast<pge_size_t>(l.end - l.begin);
+    }
+
+    /*!
+     * \brief Replaces the string content, keeping its already allocated storage
+     */
+    static inline void assignChars(PGESTRING &dst, const PGEChar *begin, pge_size_t len)
+    {
+#ifdef PGE_FILES_QT
+        dst.setUnicode(begin, len);
+#else
+        dst.assign(begin, len);
+#endif
+    }
+
+    static inline PGESTRING lineString(const RawLine &l)
+    {
+        return PGESTRING(l.begin, lineLength(l));
+    }
+
+    /*!
+     * \brief Finds the next non-empty line of raw data
+     * \param p Position to search from, moved past the found line
+     * \param end End of raw data (CR characters are treated as line breaks)
+     * \param l Found line
+     * \return false if there are no more lines
+     */
+    static bool nextLine(const PGEChar *&p, const PGEChar *end, RawLine &l)
+    {
+        while(p < end)
+        {
+#ifdef PGE_FILES_QT
+            const PGEChar *lineEnd = p;
+            while((lineEnd < end) && (*lineEnd != '\n') && (*lineEnd != '\r'))
+                lineEnd++;
+#else
+            const char *lineEnd = reinterpret_cast<const char *>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+            if(!lineEnd)
+                lineEnd = end;
+#endif
+            const PGEChar *lineBegin = p;
+            p = lineEnd + 1;
+            if(lineEnd > lineBegin)
+            {
+                l.begin = lineBegin;
+                l.end = lineEnd;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /*!
+     * \brief Splits raw data into the list of non-empty lines
+     * \param data Raw data (CR characters are treated as line breaks)
+     * \param size Size of raw data
+     * \param lines Output list of lines
+     */
+    static void splitLines(const PGEChar *data, pge_size_t size, RawLines &lines)
+    {
+        const PGEChar *p = data;
+        RawLine l;
+        while(nextLine(p, data + size, l))
+            lines.push_back(l);
+    }
+
+    /*!
+     * \brief Is line equal to the given section name with the "_END" suffix?
+     */
+    static bool isSectionEnd(const RawLine &l, const RawLine &name)
+    {
+        pge_size_t len = lineLength(name);
+        if(lineLength(l) != len + 4)
+            return false;
+        const PGEChar *n = name.begin;
+        for(pge_size_t i = 0; i < len; i++)
+        {
+            if(l.begin[i] != n[i])
+                return false;
+        }
+        return (l.begin[len] == '_') && (l.begin[len + 1] == 'E') &&
+               (l.begin[len + 2] == 'N') && (l.begin[len + 3] == 'D');
+    }
+
+    static inline bool isSectionEnd(const RawLine &l, const PGESTRING &name)
+    {
+        const PGEChar *n = rawChars(name);
+        RawLine nameLine = {n, n + name.size()};
+        return isSectionEnd(l, nameLine);
+    }
+
+    /*!
+     * \brief Is line a title of data section? (Spaces are ignored)
+     */
+    static bool isSectionTitle(const RawLine &l)
+    {
+        for(const PGEChar *c = l.begin; c < l.end; c++)
+        {
+            char cc = PGEGetChar((*c));
+            if(
+                (cc != ' ') &&
+                ((cc < 'A') || (cc > 'Z')) &&
+                ((cc < '0') || (cc > '9')) &&
+                (cc != '_')
+            )
+                return false;
+        }
+        return true;
+    }
+
+    /*!
+     * \brief Is line contains spaces only?
+     */
+    static bool isBlank(const RawLine &l)
+    {
+        for(const PGEChar *c = l.begin; c < l.end; c++)
+        {
+            if(*c != ' ')
+                return false;
+        }
+        return true;
+    }
+
+    /*!
+     * \brief Top-level section of raw data given as ranges of characters
+     */
+    struct RawSection
+    {
+        //! Title line of the section
+        RawLine title;
+        //! First character after the title line
+        const PGEChar *begin;
+        //! First character of the end line
+        const PGEChar *end;
+        //! Character after the end line
+        const PGEChar *after;
+    };
+
+    /*!
+     * \brief Finds the next top-level section of raw data (the same way as PGEXStream does)
+     * \param p Position to search from, moved past the end line of found section
+     * \param end End of raw data
+     * \param s Found section
+     * \param closed Is found section closed? If not, the section takes all remaining data
+     * \return false if there are no more sections
+     */
+    static bool nextSection(const PGEChar *&p, const PGEChar *end, RawSection &s, bool &closed)
+    {
+        RawLine l;
+
+        do
+        {
+            if(!nextLine(p, end, l))
+                return false;
+        } while(isBlank(l)); //Skip empty parts
+
+        s.title = l;
+        s.begin = p < end ? p : end;
+        closed = false;
+
+        while(nextLine(p, end, l))
+        {
+            if(isSectionEnd(l, s.title))
+            {
+                closed = true;
+                break;
+            }
+        }
+
+        s.end = closed ? l.begin : end;
+        s.after = p < end ? p : end;
+        return true;
+    }
+
+    static inline void appendChars(PGESTRING &dst, const PGEChar *begin, const PGEChar *end)
+    {
+#ifdef PGE_FILES_QT
+        dst.append(begin, static_cast<int>(end - begin));
+#else
+        dst.append(begin, static_cast<size_t>(end - begin));
+#endif
+    }
+
+    /*!
+     * \brief Stores the section into one or more chunks, data items are split between chunks in the original order
+     * \param name Name of the section
+     * \param s Section to split
+     * \param parts Maximal number of chunks
+     * \param chunks List to append chunks into
+     */
+    static void splitSection(const PGESTRING &name, const RawSection &s, unsigned int parts,
+                             PGELIST<PGEFile::PGEX_Chunk> &chunks)
+    {
+        //Don't split sections into too small parts, their decoding is cheaper than a copying
+        const pge_size_t minPartSize = 16384;
+        pge_size_t size = static_cast<pge_size_t>(s.end - s.begin);
+        pge_size_t count = size / minPartSize;
+
+        if(count > static_cast<pge_size_t>(parts))
+            count = static_cast<pge_size_t>(parts);
+
+        if(count > 1)
+        {
+            //Sub-trees can't be split between data items
+            const PGEChar *p = s.begin;
+            RawLine l;
+            while(nextLine(p, s.end, l))
+            {
+                if(isSectionTitle(l))
+                {
+                    count = 1;
+                    break;
+                }
+            }
+        }
+
+        if(count < 1)
+            count = 1;
+
+        const PGEChar *partBegin = s.begin;
+        for(pge_size_t k = 1; k <= count; k++)
+        {
+            const PGEChar *partEnd = s.end;
+
+            if(k < count)
+            {
+                partEnd = s.begin + (size / count) * k;
+                if(partEnd < partBegin)
+                    partEnd = partBegin;
+                //Cut at the begin of the next line
+                while((partEnd < s.end) && (partEnd[-1] != '\n'))
+                    partEnd++;
+            }
+
+            if((partEnd == partBegin) && (count > 1))
+                continue;
+
+            chunks.push_back(PGEFile::PGEX_Chunk());
+            PGEFile::PGEX_Chunk &c = chunks.back();
+            c.name = name;
+            c.data.reserve(static_cast<pge_size_t>(partEnd - partBegin) + name.size() * 2 + 6);
+            c.data.append(name);
+            c.data.append("\n");
+            appendChars(c.data, partBegin, partEnd);
+            c.data.append(name);
+            c.data.append("_END\n");
+            partBegin = partEnd;
+        }
+    }
+
+    static PGESTRING lineWithoutSpaces(const RawLine &l)
+    {
+        PGESTRING out;
+        for(const PGEChar *c = l.begin; c < l.end; c++)
+        {
+            if(*c != ' ')
+                out.push_back(*c);
+        }
+        return out;
+    }
+
+    /*!
+     * \brief Parses a line of data item into a list of marker/value pairs
+     * \param l Line of raw data
+     * \param item Target data item, already existing values are overwritten to reuse their storage
+     * \return false if line has a syntax error
+     */
+    static bool parseItem(const RawLine &l, PGEFile::PGEX_Item &item)
+    {
+        enum States
+        {
+            STATE_MARKER = 0,
+            STATE_VALUE = 1,
+            STATE_ERROR = 2
+        };
+
+        const PGEChar *s = l.begin;
+        pge_size_t size = lineLength(l), tail = size - 1;
+        pge_size_t runBegin = 0;
+        pge_size_t markerBegin = 0, markerLen = 0;
+        pge_size_t count = 0;
+        int state = STATE_MARKER;
+        int escape = 0;
+
+        for(pge_size_t i = 0; i < size; i++)
+        {
+            if(state == STATE_ERROR)
+                return false;
+
+            PGEChar c = s[i];
+            if(escape > 0)
+                escape--;
+            if((c == '\\') && (escape == 0))
+            {
+                //Skip escape sequence
+                escape = 2;
+            }
+
+            switch(state)
+            {
+            case STATE_MARKER:
+                if((c == ';') && (escape == 0))
+                {
+                    state = STATE_ERROR;
+                    continue;
+                }
+                if((c == ':') && (escape == 0))
+                {
+                    markerBegin = runBegin;
+                    markerLen = i - runBegin;
+                    runBegin = i + 1;
+                    state = STATE_VALUE;
+                }
+                break;
+            case STATE_VALUE:
+                if((c == ':') && (escape == 0))
+                {
+                    state = STATE_ERROR;
+                    continue;
+                }
+                // The last character of the line is never a part of the value
+                if(((c == ';') && (escape == 0)) || (i == tail))
+                {
+                    if(count == item.values.size())
+                        item.values.push_back(PGEFile::PGEX_Val());
+                    PGEFile::PGEX_Val &dataValue = item.values[count++];
+                    assignChars(dataValue.marker, s + markerBegin, markerLen);
+                    assignChars(dataValue.value, s + runBegin, i - runBegin);
+                    runBegin = i + 1;
+                    state = STATE_MARKER;
+                }
+                break;
+            }
+        }
+
+        while(item.values.size() > count)
+            item.values.pop_back();
+
+        return true;
+    }
+
+    /*!
+     * \brief Replaces content of the tree branch with plain text of the given lines
+     */
+    static void storePlainText(PGEFile::PGEX_Entry &entry, const PGESTRING &marker,
+                               const RawLine *lines, pge_size_t count)
+    {
+        entry.type = PGEFile::PGEX_PlainText;
+        entry.data.clear();
+        entry.subTree.clear();
+
+        entry.data.push_back(PGEFile::PGEX_Item());
+        PGEFile::PGEX_Item &dataItem = entry.data.back();
+        dataItem.type = PGEFile::PGEX_PlainText;
+        dataItem.values.push_back(PGEFile::PGEX_Val());
+        PGEFile::PGEX_Val &dataValue = dataItem.values.back();
+        dataValue.marker = marker;
+        for(pge_size_t i = 0; i < count; i++)
+        {
+            dataValue.value.append(lines[i].begin, lineLength(lines[i]));
+            dataValue.value.push_back('\n');
+        }
+    }
+
+    /*!
+     * \brief Builds a branch of PGE-X data tree from the range of lines
+     * \param lines First line of the branch
+     * \param count Number of lines in the branch
+     * \param entry Target tree branch
+     * \return false if branch contains invalid data and must be stored as plain text
+     */
+    static bool buildEntry(const RawLine *lines, pge_size_t count, PGEFile::PGEX_Entry &entry)
+    {
+        entry.type = PGEFile::PGEX_Struct;
+
+        for(pge_size_t q = 0; q < count; q++)
+        {
+            if(isSectionTitle(lines[q]))
+            {
+                //Build and store subTree
+                PGESTRING nameOfTree = lineWithoutSpaces(lines[q]);
+                pge_size_t subBegin = ++q;
+                while((q < count) && !isSectionEnd(lines[q], nameOfTree))
+                    q++;
+
+                entry.subTree.push_back(PGEFile::PGEX_Entry());
+                PGEFile::PGEX_Entry &subTree = entry.subTree.back();
+                if(!buildEntry(lines + subBegin, q - subBegin, subTree))
+                    storePlainText(subTree, nameOfTree, lines + subBegin, q - subBegin);
+                subTree.name = nameOfTree;
+            }
+            else
+            {
+                entry.data.push_back(PGEFile::PGEX_Item());
+                PGEFile::PGEX_Item &dataItem = entry.data.back();
+                dataItem.type = PGEFile::PGEX_Struct;
+                if(!parseItem(lines[q], dataItem))
+                    return false;
+            }
+        }
+
+        return true;
+    }
 }
 
 
@@ -103,15 +615,15 @@ PGEFile::PGEFile(const PGEFile &pgeFile)
 #endif
 {
     m_rawData = pgeFile.m_rawData;
-    m_rawDataTree = pgeFile.m_rawDataTree;
     m_lastError = pgeFile.m_lastError;
+    m_sectionsIndex = pgeFile.m_sectionsIndex;
 }
 
 PGEFile &PGEFile::operator=(const PGEFile &other)
 {
     m_rawData = other.m_rawData;
-    m_rawDataTree = other.m_rawDataTree;
     m_lastError = other.m_lastError;
+    m_sectionsIndex = other.m_sectionsIndex;
     return *this;
 }
 
@@ -119,6 +631,10 @@ PGEFile::PGEFile(const PGESTRING &_rawData) :
     m_rawData(_rawData)
 {}
 
+PGEFile::PGEFile(PGESTRING &&_rawData) :
+    m_rawData(std::move(_rawData))
+{}
+
 PGESTRING PGEFile::removeQuotes(PGESTRING str)
 {
     PGESTRING target = PGE_RemStrRng(str, 0, 1);
@@ -129,242 +645,279 @@ PGESTRING PGEFile::removeQuotes(PGESTRING str)
 void PGEFile::setRawData(const PGESTRING &_rawData)
 {
     m_rawData = _rawData;
+    m_sectionsIndex.clear();
+}
+
+void PGEFile::setRawData(PGESTRING &&_rawData)
+{
+    m_rawData = std::move(_rawData);
+    m_sectionsIndex.clear();
 }
 
 bool PGEFile::buildTreeFromRaw()
 {
-    PGEXSct PGEXsection;
+    using namespace PGEExtendedFormat;
+
+#ifndef PGE_FILES_QT
+    m_rawData.resize(PGE_FileFormats_misc::removeCR(&m_rawData[0], m_rawData.size()));
+#endif
+
+    RawLines lines;
+    splitLines(rawChars(m_rawData), m_rawData.size(), lines);
 
-    FileStringList in;
-    in.addData(m_rawData);
+    const pge_size_t linesCount = lines.size();
+    const pge_size_t oldTreeSize = dataTree.size();
+    pge_size_t q = 0;
 
-    //Read raw data sections
-    bool sectionOpened = false;
-    while(!in.atEnd())
+    //Read raw data sections and build their trees
+    while(q < linesCount)
     {
-        PGEXsection.first = in.readLine();
-        PGEXsection.second.clear();
+        const RawLine &header = lines[q++];
 
         //Skip empty parts
-        PGESTRING pgex_sectionName = removeSpaces(PGEXsection.first);
-        if(IsEmpty(pgex_sectionName)) continue;
+        if(isBlank(header))
+            continue;
 
-        sectionOpened = true;
-        PGESTRING data;
-        while(!in.atEnd())
+        PGESTRING sectionName = lineString(header);
+        pge_size_t bodyBegin = q;
+        bool sectionClosed = false;
+        for(; q < linesCount; q++)
         {
-            data = in.readLine();
-            if(data == PGEXsection.first + "_END")
+            if(isSectionEnd(lines[q], sectionName))
             {
-                sectionOpened = false;    // Close Section
+                sectionClosed = true;
                 break;
             }
-            PGEXsection.second.push_back(data);
         }
-        m_rawDataTree.push_back(PGEXsection);
+
+        if(!sectionClosed)
+        {
+            while(dataTree.size() > oldTreeSize)
+                dataTree.pop_back();
+            PGE_CutLength(sectionName, 20);
+            PGE_FilterBinary(sectionName);
+            m_lastError = PGESTRING("Section [" + sectionName + "] is not closed");
+            return false;
+        }
+
+        dataTree.push_back(PGEX_Entry());
+        PGEX_Entry &subTree = dataTree.back();
+        if(!buildEntry(lines.data() + bodyBegin, q - bodyBegin, subTree))
+            storePlainText(subTree, "PlainText", lines.data() + bodyBegin, q - bodyBegin);
+        subTree.name = sectionName;
+        q++; // Skip the end of section
     }
 
-    if(sectionOpened)
+    return true;
+}
+
+
+PGEFile::PGEX_Entry PGEFile::buildTree(PGESTRINGList &src_data, bool *_valid)
+{
+    using namespace PGEExtendedFormat;
+
+    RawLines lines;
+    lines.reserve(static_cast<size_t>(src_data.size()));
+    for(pge_size_t i = 0; i < src_data.size(); i++)
     {
-        PGESTRING errSect = PGEXsection.first;
-        PGE_CutLength(errSect, 20);
-        PGE_FilterBinary(errSect);
-        m_lastError = PGESTRING("Section [" + errSect + "] is not closed");
-        return false;
+        const PGEChar *begin = rawChars(src_data[i]);
+        RawLine l = {begin, begin + src_data[i].size()};
+        lines.push_back(l);
     }
 
-    //Building tree
+    PGEX_Entry entryData;
+    bool valid = buildEntry(lines.data(), lines.size(), entryData);
+    if(_valid) *_valid = valid;
+    return entryData;
+}
+
+
 
-    for(pge_size_t z = 0; z < m_rawDataTree.size(); z++)
+PGESTRING PGEFile::lastError()
+{
+    return m_lastError;
+}
+
+bool PGEFile::buildSectionsIndex()
+{
+    using namespace PGEExtendedFormat;
+
+#ifndef PGE_FILES_QT
+    m_rawData.resize(PGE_FileFormats_misc::removeCR(&m_rawData[0], m_rawData.size()));
+#endif
+
+    const PGEChar *data = rawChars(m_rawData);
+    const PGEChar *p = data;
+    const PGEChar *end = data + m_rawData.size();
+    RawSection rs;
+    bool sectionClosed;
+
+    m_sectionsIndex.clear();
+
+    while(nextSection(p, end, rs, sectionClosed))
     {
-        bool valid = true;
-        PGEX_Entry subTree = buildTree(m_rawDataTree[z].second, &valid);
-        if(valid)
-        {
-            //Store like subtree
-            subTree.type = PGEX_Struct;
-            subTree.name = m_rawDataTree[z].first;
-            dataTree.push_back(subTree);
-        }
-        else
+        if(!sectionClosed)
         {
-            //Store like plain text
-            PGEX_Item dataItem;
-            dataItem.type = PGEX_PlainText;
-            subTree.data.clear();
-            subTree.subTree.clear();
-            PGEX_Val dataValue;
-            dataValue.marker = "PlainText";
-            for(pge_size_t i = 0; i < m_rawDataTree[z].second.size(); i++)
-                dataValue.value += m_rawDataTree[z].second[i] + "\n";
-            dataItem.values.push_back(dataValue);
-            subTree.name = m_rawDataTree[z].first;
-            subTree.type = PGEX_PlainText;
-            subTree.data.push_back(dataItem);
-            dataTree.push_back(subTree);
-            valid = true;
+            PGESTRING sectionName = lineString(rs.title);
+            m_sectionsIndex.clear();
+            PGE_CutLength(sectionName, 20);
+            PGE_FilterBinary(sectionName);
+            m_lastError = PGESTRING("Section [" + sectionName + "] is not closed");
+            return false;
         }
+
+        m_sectionsIndex.push_back(SectionIndex());
+        SectionIndex &sct = m_sectionsIndex.back();
+        sct.name = lineString(rs.title);
+        sct.begin = static_cast<pge_size_t>(rs.begin - data);
+        sct.end = static_cast<pge_size_t>(rs.end - data);
     }
 
     return true;
 }
 
-
-PGEFile::PGEX_Entry PGEFile::buildTree(PGESTRINGList &src_data, bool *_valid)
+const PGEFile::PGEX_Entry *PGEFile::section(const PGESTRING &name)
 {
-    PGEX_Entry entryData;
+    using namespace PGEExtendedFormat;
 
-    bool valid = true;
-    for(pge_size_t q = 0; q < src_data.size(); q++)
+    for(pge_size_t i = 0; i < m_sectionsIndex.size(); i++)
     {
-        if(IsSectionTitle(removeSpaces(src_data[q])))
+        SectionIndex &sct = m_sectionsIndex[i];
+        if(sct.name != name)
+            continue;
+
+        if(!sct.decoded)
         {
-            //Build and store subTree
-            PGESTRING nameOfTree = removeSpaces(src_data[q]);
-            PGESTRINGList rawSubTree;
-            q++;
-            for(; q < src_data.size() && src_data[q] != nameOfTree + "_END" ; q++)
-            {
-                rawSubTree.push_back(src_data[q]);
-            }
-            PGEX_Entry subTree = buildTree(rawSubTree, &valid);
-            if(valid)
-            {
-                //Store like subtree
-                subTree.name = nameOfTree;
-                entryData.subTree.push_back(subTree);
-                entryData.type = PGEX_Struct;
-            }
-            else
-            {
-                //Store like plain text
-                subTree.name = nameOfTree;
-                subTree.subTree.clear();
-                subTree.type = PGEX_PlainText;
-                subTree.data.clear();
-
-                PGEX_Item dataItem;
-                PGEX_Val dataValue;
-                dataItem.type = PGEX_PlainText;
-
-                dataValue.marker = nameOfTree; //-V820
-                //foreach(PGESTRING x, rawSubTree) dataValue.value += x+"\n";
-                for(auto &st : rawSubTree)
-                    dataValue.value += st + "\n";
-                dataItem.values.push_back(dataValue);
-                subTree.data.push_back(dataItem);
-                entryData.subTree.push_back(subTree);
-                entryData.type = PGEX_Struct;
-                valid = true;
-            }
+            RawLines lines;
+            const PGEChar *data = rawChars(m_rawData);
+            splitLines(data + sct.begin, sct.end - sct.begin, lines);
+            if(!buildEntry(lines.data(), lines.size(), sct.entry))
+                storePlainText(sct.entry, "PlainText", lines.data(), lines.size());
+            sct.entry.name = sct.name;
+            sct.decoded = true;
+        }
+
+        return &sct.entry;
+    }
+
+    return nullptr;
+}
+
+bool PGEFile::splitToChunks(PGESTRING &rawData, const PGESTRINGList &sections, unsigned int parts, PGELIST<PGEX_Chunk> &chunks)
+{
+    using namespace PGEExtendedFormat;
+
+#ifndef PGE_FILES_QT
+    rawData.resize(PGE_FileFormats_misc::removeCR(&rawData[0], rawData.size()));
+#endif
+
+    const PGEChar *data = rawChars(rawData);
+    const PGEChar *p = data;
+    const PGEChar *end = data + rawData.size();
+    const PGEChar *mainBegin = data;
+    RawSection rs;
+    bool sectionClosed;
 
+    chunks.clear();
+    chunks.push_back(PGEX_Chunk());
+
+    while(nextSection(p, end, rs, sectionClosed))
+    {
+        if(!sectionClosed)
+        {
+            chunks.clear();
+            return false;
         }
-        else
+
+        PGESTRING name = lineString(rs.title);
+        bool independent = false;
+        for(const PGESTRING &sct : sections)
         {
-            PGEX_Item dataItem;
-            PGESTRING &srcData_nc = src_data[q];
-            enum States
+            if(sct == name)
             {
-                STATE_MARKER = 0,
-                STATE_VALUE = 1,
-                STATE_ERROR = 2
-            };
-            pge_size_t state = 0, size = srcData_nc.size(), tail = srcData_nc.size() - 1;
-            PGEX_Val dataValue;
-            int escape = 0;
-            for(pge_size_t i = 0; i < size; i++)
-            {
-                if(state == STATE_ERROR)
-                {
-                    valid = false;
-                    break;
-                }
-                PGEChar c = srcData_nc[i];
-                if(escape > 0)
-                {
-                    escape--;
-                }
-                if((c == '\\') && (escape == 0))
-                {
-                    //Skip escape sequence
-                    escape = 2;
-                }
-                switch(state)
-                {
-                case STATE_MARKER:
-                    if((c == ';') && (escape == 0))
-                    {
-                        state = STATE_ERROR;
-                        continue;
-                    }
-                    if((c == ':') && (escape == 0))
-                    {
-                        state = STATE_VALUE;
-                        continue;
-                    }
-                    dataValue.marker.push_back(c);
-                    break;
-                case STATE_VALUE:
-                    if((c == ':') && (escape == 0))
-                    {
-                        state = STATE_ERROR;
-                        continue;
-                    }
-                    if(((c == ';') && (escape == 0)) || (i == tail))
-                    {
-                        //STORE DATA
-                        dataItem.values.push_back(dataValue);
-                        dataValue.marker.clear();
-                        dataValue.value.clear();
-                        state = STATE_MARKER;
-                        continue;
-                    }
-                    dataValue.value.push_back(c);
-                    break;
-                    //case STATE_ERROR: //Dead code
-                    //break;
-                }
+                independent = true;
+                break;
             }
-            dataItem.type = PGEX_Struct;
-            entryData.type = PGEX_Struct;
-            entryData.data.push_back(dataItem);
-            //            PGE_SPLITSTRING(fields, srcData_nc, ";");
-            //            PGEX_Item dataItem;
-            //            dataItem.type = PGEX_Struct;
-            //            for(int i=0;i<(signed)fields.size(); i++)
-            //            {
-            //                PGESTRING fields_ns = removeSpaces(fields[i]);
-            //                if(IsEmpty(fields_ns)) continue;
-
-            //                //Store data into list
-            //                PGESTRINGList value;
-            //                PGE_SPLITSTRING(value, fields[i], ":");
-
-            //                if( value.size() != 2 )
-            //                {
-            //                    valid = false; break;
-            //                }
-
-            //                PGEX_Val dataValue;
-            //                    dataValue.marker = value[0];
-            //                    dataValue.value = value[1];
-            //                dataItem.values.push_back(dataValue);
-            //            }
-            //            entryData.type = PGEX_Struct;
-            //            entryData.data.push_back(dataItem);
         }
-        if(!valid) break;
+
+        if(!independent)
+            continue;
+
+        //Everything between independent sections is kept in the main chunk
+        appendChars(chunks[0].data, mainBegin, rs.title.begin);
+        mainBegin = rs.after;
+        splitSection(name, rs, parts, chunks);
     }
 
-    if(_valid) *_valid = valid;
-    return entryData;
+    appendChars(chunks[0].data, mainBegin, end);
+
+    return true;
 }
 
+unsigned int PGEFile::parallelThreads(unsigned int threads)
+{
+#ifdef PGEFL_ENABLE_THREADS
+    if(threads == 0)
+        threads = std::thread::hardware_concurrency();
+    return threads > 0 ? threads : 1;
+#else
+    (void)threads;
+    return 1;
+#endif
+}
 
+void PGEFile::runParallel(pge_size_t count, unsigned int threads, const std::function<void(pge_size_t)> &job)
+{
+#ifdef PGEFL_ENABLE_THREADS
+    if(static_cast<pge_size_t>(threads) > count)
+        threads = static_cast<unsigned int>(count);
 
-PGESTRING PGEFile::lastError()
+    if(threads > 1)
+    {
+        std::atomic<pge_size_t> next(0);
+        auto worker = [&next, count, &job]()
+        {
+            for(pge_size_t i = next++; i < count; i = next++)
+                job(i);
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+
+        try
+        {
+            for(unsigned int t = 1; t < threads; t++)
+                pool.emplace_back(worker);
+        }
+        catch(const std::system_error &)
+        {
+            //Process all jobs by already started threads
+        }
+
+        worker();
+
+        for(std::thread &t : pool)
+            t.join();
+
+        return;
+    }
+#else
+    (void)threads;
+#endif
+
+    for(pge_size_t i = 0; i < count; i++)
+        job(i);
+}
+
+constexpr uint64_t PGEFile::PGEX_LongMarkerKey;
+
+PGESTRING PGEFile::valueErrorString(const PGEX_ValueLocation &loc)
 {
-    return m_lastError;
+    if(!loc.section || !loc.value)
+        return PGESTRING();
+    return PGESTRING("Wrong value syntax\nSection [" + loc.section->name +
+                     "]\nData line " + fromNum(loc.item) +
+                     "\nMarker " + loc.value->marker + "\nValue " + loc.value->value);
 }
 
 
@@ -546,16 +1099,35 @@ bool PGEFile::IsBoolArray(const PGESTRING &in) // Boolean array
     return isValid(in, "01", 2, true);
 }
 
-bool PGEFile::IsIntArray(const PGESTRING &in) // Boolean array
+bool PGEFile::IsIntArray(const PGESTRING &in) // Integer array
 {
     using namespace PGEExtendedFormat;
-#ifdef PGE_FILES_QT
-    return PGEFL_QRegExp("^\\[(\\-?\\d+,?)*\\]$").PGEFL_Match(in);
-#else
-    //FIXME
-    std::regex rx("^\\[(\\-?\\d+,?)*\\]$");
-    return std::regex_match(in, rx);
-#endif
+    pge_size_t size = in.size();
+
+    if(size < 2 || in[0] != '[' || in[size - 1] != ']')
+        return false;
+
+    const PGEChar *p = in.data() + 1;
+    const PGEChar *end = in.data() + size - 1;
+
+    // Matches "^\[(\-?\d+,?)*\]$"
+    while(p != end)
+    {
+        if(*p == '-')
+            p++;
+
+        const PGEChar *digits = p;
+        while(p != end && isDegit(*p))
+            p++;
+
+        if(p == digits)
+            return false;
+
+        if(p != end && *p == ',')
+            p++;
+    }
+
+    return true;
 }
 
 bool PGEFile::IsStringArray(const PGESTRING &in) // String array
@@ -630,11 +1202,22 @@ bool PGEFile::IsStringArray(const PGESTRING &in) // String array
 PGESTRINGList PGEFile::X2STRArr(const PGESTRING &in, bool *_valid)
 {
     PGESTRINGList strArr;
-    PGESTRING entry;
+    bool valid = X2STRArr(in, strArr);
+
+    if(_valid)
+        *_valid = valid;
+
+    return strArr;
+}
+
+bool PGEFile::X2STRArr(const PGESTRING &in, PGESTRINGList &out)
+{
     bool valid = true;
     pge_size_t i = 0, depth = 0, comma = 0;
     bool escape = false;
 
+    out.clear();
+
     while(i < in.size())
     {
         switch(depth)
@@ -659,7 +1242,12 @@ PGESTRINGList PGEFile::X2STRArr(const PGESTRING &in, bool *_valid)
                 break;
 
             case 1:
-                if(in[i] == '"')     depth = 2; //Open value
+                if(in[i] == '"') //Open value
+                {
+                    // Closing quote of previous entry is kept at begin of the next one
+                    out.push_back(out.empty() ? PGESTRING() : PGESTRING("\""));
+                    depth = 2;
+                }
                 else valid = false;
                 break;
 
@@ -672,8 +1260,7 @@ PGESTRINGList PGEFile::X2STRArr(const PGESTRING &in, bool *_valid)
         case 2://Inside entry
             if((in[i] == '"') && (!escape))
             {
-                strArr.push_back(X2STRING(entry));    //Close value //-V823
-                entry.clear();
+                restoreString(out.back(), true);    //Close value
                 depth = 1;
                 comma = 0;
             }
@@ -687,8 +1274,9 @@ PGESTRINGList PGEFile::X2STRArr(const PGESTRING &in, bool *_valid)
                 escape = true;
                 break;
             }
+            else
+                out.back().push_back(in[i]);
 
-            entry.push_back(in[i]);
             escape = false;
             break;
 
@@ -702,42 +1290,59 @@ PGESTRINGList PGEFile::X2STRArr(const PGESTRING &in, bool *_valid)
         i++;
     }
 
-    if(_valid)
-        *_valid = valid;
+    // Drop the entry which was not closed
+    if(depth == 2)
+        out.pop_back();
 
-    return strArr;
+    return valid;
 }
 
 PGELIST<long> PGEFile::X2IntArr(const PGESTRING &in, bool *_valid)
 {
     PGELIST<long> intArr;
-    PGESTRINGList strArr;
+    bool valid = X2IntArr(in, intArr);
 
-    if(in.size() < 2 || in[0] != '[' || in[in.size() - 1] != ']')
-    {
-        if(_valid)
-            *_valid = false;
-        return intArr;
-    }
+    if(_valid)
+        *_valid = valid;
+
+    if(!valid)
+        intArr.clear();
+
+    return intArr;
+}
+
+bool PGEFile::X2IntArr(const PGESTRING &in, PGELIST<long> &out)
+{
+    using namespace PGEExtendedFormat;
+    pge_size_t size = in.size();
+
+    out.clear();
+
+    if(size < 2 || in[0] != '[' || in[size - 1] != ']')
+        return false;
 
-//    PGE_RemStrRng(in, 0, 1);
-//    PGE_RemStrRng(in, in.size() - 1, 1);
-    PGE_SPLITSTRING(strArr, PGE_SubStr(in, 1, (int)in.size() - 2), ",");
+    const PGEChar *p = in.data() + 1;
+    const PGEChar *end = in.data() + size - 1;
 
-    for(auto &s : strArr)
+    while(p != end)
     {
-        if(!IsIntS(s))
-        {
-            if(_valid) *_valid = false;
-            return intArr;
-        }
-        intArr.push_back(toLong(s));
-    }
+        long value;
 
-    if(_valid)
-        *_valid = true;
+        if(!parseIntArrEntry(p, end, value))
+            return false;
 
-    return intArr;
+        out.push_back(value);
+
+        if(p == end)
+            break;
+
+        if(*p != ',')
+            return false;
+
+        p++; // Trailing comma is allowed
+    }
+
+    return true;
 }
 
 PGELIST<bool > PGEFile::X2BollArr(const PGESTRING &src)
@@ -748,6 +1353,24 @@ PGELIST<bool > PGEFile::X2BollArr(const PGESTRING &src)
     return arr;
 }
 
+bool PGEFile::X2BollArr(const PGESTRING &src, PGELIST<bool> &out)
+{
+    pge_size_t size = src.size();
+    const PGEChar *p = src.data();
+
+    out.clear();
+    out.reserve(size);
+
+    for(pge_size_t i = 0; i < size; i++)
+    {
+        if(p[i] != '0' && p[i] != '1')
+            return false;
+        out.push_back(p[i] == '1');
+    }
+
+    return true;
+}
+
 PGELIST<PGESTRINGList > PGEFile::splitDataLine(const PGESTRING &src_data, bool *_valid)
 {
     PGELIST<PGESTRINGList > entryData;
@@ -903,12 +1526,61 @@ PGESTRING PGEFile::X2STRING(PGESTRING input)
     return input;
 }
 
+void PGEFile::X2STRING(const PGESTRING &input, PGESTRING &output)
+{
+    using namespace PGEExtendedFormat;
+    pge_size_t size = input.size();
+
+    if(findBackslash(input) < size)
+    {
+        output = input;
+        restoreString(output, true);
+        return;
+    }
+
+    //Nothing to decode, just strip quotes
+    pge_size_t begin = 0, end = size;
+    if((size > 0) && (input[0] == '\"'))
+        begin = 1;
+    if((size > begin) && (input[size - 1] == '\"'))
+        end = size - 1;
+    assignChars(output, rawChars(input) + begin, end - begin);
+}
+
 void PGEFile::restoreString(PGESTRING &input, bool removeQuotes)
 {
+    using namespace PGEExtendedFormat;
     PGESTRING &output = input;
     const pge_size_t first = 0;//For convenience to understand
-    pge_size_t j = 0, size = input.size(), tail = input.size() - 1;
-    for(pge_size_t i = 0; i < size; i++, j++)
+    pge_size_t i = 0, j = 0, size = input.size(), tail = input.size() - 1;
+    pge_size_t skip = (removeQuotes && (size > 0) && (input[0] == '\"')) ? 1 : 0;
+    pge_size_t escape = findBackslash(input);
+
+    if(escape >= size)
+    {
+        //Nothing to decode, just strip quotes
+        if(removeQuotes && (size > skip) && (input[tail] == '\"'))
+            input.resize(tail);
+        if(skip)
+#ifdef PGE_FILES_QT
+            input.remove(0, 1);
+#else
+            input.erase(0, 1);
+#endif
+        return;
+    }
+
+    if(escape > 0)
+    {
+        //Everything before the first escape sequence is kept as is
+        PGEChar *data = mutableChars(input);
+        if(skip)
+            std::memmove(data, data + 1, (escape - 1) * sizeof(PGEChar));
+        i = escape;
+        j = escape - skip;
+    }
+
+    for(; i < size; i++, j++)
     {
         if(removeQuotes && ((i == first) || (i == tail)))
         {
@@ -990,11 +1662,23 @@ ReCheckQuotie:
 
 void PGEFile::escapeString(PGESTRING &output, const PGESTRING &input, bool addQuotes)
 {
-    pge_size_t j = 0, size = input.size();
-    output.resize(size * 2 + (addQuotes ? 2 : 0));
+    output.clear();
+    appendEscapedString(output, input, addQuotes);
+}
+
+void PGEFile::appendEscapedString(PGESTRING &output, const PGESTRING &input, bool addQuotes)
+{
+    using namespace PGEExtendedFormat;
+    pge_size_t j = output.size(), size = input.size();
+    pge_size_t plain = findEscapable(input);
+    output.resize(j + plain + (size - plain) * 2 + (addQuotes ? 2 : 0));
     if(addQuotes)
         output[j++] = '\"';
-    for(pge_size_t i = 0; i < size; i++, j++)
+    //Everything before the first special character is copied as is
+    if(plain > 0)
+        std::memcpy(mutableChars(output) + j, rawChars(input), plain * sizeof(PGEChar));
+    j += plain;
+    for(pge_size_t i = plain; i < size; i++, j++)
     {
         char c = PGEGetChar(input[i]);
         switch(c)
@@ -1051,3 +1735,323 @@ void PGEFile::escapeString(PGESTRING &output, const PGESTRING &input, bool addQu
     output.resize(j);
 }
 
+
+
+bool PGEXVisitor::onSectionEnd(const PGESTRING &)
+{
+    return true;
+}
+
+bool PGEXVisitor::onItemBegin()
+{
+    return true;
+}
+
+bool PGEXVisitor::onItemEnd()
+{
+    return true;
+}
+
+
+PGEXStream::PGEXStream(PGE_FileFormats_misc::TextInput &in) :
+    m_in(in)
+{
+    m_section.type = PGEFile::PGEX_Struct;
+    m_item.type = PGEFile::PGEX_Struct;
+}
+
+bool PGEXStream::readLine()
+{
+    while(!m_in.eof())
+    {
+        m_line = m_in.readLine();
+        if(!IsEmpty(m_line))
+            return true;
+    }
+    return false;
+}
+
+void PGEXStream::setNotClosedError()
+{
+    PGESTRING sectionName = m_section.name;
+    PGE_CutLength(sectionName, 20);
+    PGE_FilterBinary(sectionName);
+    m_lastError = PGESTRING("Section [" + sectionName + "] is not closed");
+    m_inSection = false;
+}
+
+bool PGEXStream::skipSubTree(const PGESTRING &name)
+{
+    using namespace PGEExtendedFormat;
+
+    while(readLine())
+    {
+        const PGEChar *begin = rawChars(m_line);
+        RawLine l = {begin, begin + m_line.size()};
+
+        // The end of the section closes all unclosed sub-trees
+        if(isSectionEnd(l, m_section.name))
+        {
+            m_inSection = false;
+            return false;
+        }
+
+        if(isSectionEnd(l, name))
+            return true;
+    }
+
+    setNotClosedError();
+    return false;
+}
+
+bool PGEXStream::nextSection()
+{
+    using namespace PGEExtendedFormat;
+
+    if(hasError())
+        return false;
+
+    // Skip the rest of current section
+    while(m_inSection)
+    {
+        if(!readLine())
+        {
+            setNotClosedError();
+            return false;
+        }
+
+        const PGEChar *begin = rawChars(m_line);
+        RawLine l = {begin, begin + m_line.size()};
+        if(isSectionEnd(l, m_section.name))
+            m_inSection = false;
+    }
+
+    while(readLine())
+    {
+        const PGEChar *begin = rawChars(m_line);
+        RawLine l = {begin, begin + m_line.size()};
+
+        //Skip empty parts
+        if(isBlank(l))
+            continue;
+
+        m_section.name = m_line;
+        m_section.type = PGEFile::PGEX_Struct;
+        m_inSection = true;
+        return true;
+    }
+
+    return false;
+}
+
+bool PGEXStream::nextItem()
+{
+    using namespace PGEExtendedFormat;
+
+    if(!m_inSection || hasError())
+        return false;
+
+    while(true)
+    {
+        if(!readLine())
+        {
+            setNotClosedError();
+            return false;
+        }
+
+        const PGEChar *begin = rawChars(m_line);
+        RawLine l = {begin, begin + m_line.size()};
+
+        if(isSectionEnd(l, m_section.name))
+        {
+            m_inSection = false;
+            return false;
+        }
+
+        if(isSectionTitle(l))
+        {
+            if(!skipSubTree(lineWithoutSpaces(l)))
+                return false;
+            continue;
+        }
+
+        m_item.type = PGEFile::PGEX_Struct;
+        if(!parseItem(l, m_item))
+        {
+            m_section.type = PGEFile::PGEX_PlainText;
+            m_lastError = PGESTRING("Wrong section data syntax:\nSection [" + m_section.name + "]");
+            m_inSection = false;
+            return false;
+        }
+
+        return true;
+    }
+}
+
+bool PGEXStream::visit(PGEXVisitor &visitor)
+{
+    while(nextSection())
+    {
+        if(!visitor.onSectionBegin(m_section.name))
+            continue;
+
+        while(nextItem())
+        {
+            if(!visitor.onItemBegin())
+                return false;
+
+            for(pge_size_t i = 0; i < m_item.values.size(); i++)
+            {
+                PGEFile::PGEX_Val &v = m_item.values[i];
+                if(!visitor.onValue(v.marker, v.value))
+                    return false;
+            }
+
+            if(!visitor.onItemEnd())
+                return false;
+        }
+
+        if(hasError() || !visitor.onSectionEnd(m_section.name))
+            return false;
+    }
+
+    return !hasError();
+}
+
+
+
+//! Size of collected data to write it into the text output
+static const pge_size_t s_writerFlushSize = 65536;
+
+PGEXWriter::PGEXWriter(PGE_FileFormats_misc::TextOutput &out) :
+    m_out(&out),
+    m_buf(m_ownBuffer)
+{
+    m_buf.reserve(s_writerFlushSize + 4096);
+}
+
+PGEXWriter::PGEXWriter(PGESTRING &target) :
+    m_buf(target)
+{}
+
+PGEXWriter::~PGEXWriter()
+{
+    flush();
+}
+
+void PGEXWriter::writeBool(const char *marker, bool value)
+{
+    beginValue(marker);
+    m_buf.push_back(value ? '1' : '0');
+    endValue();
+}
+
+void PGEXWriter::writeStr(const char *marker, const PGESTRING &value)
+{
+    beginValue(marker);
+    PGEFile::appendEscapedString(m_buf, value, true);
+    endValue();
+}
+
+void PGEXWriter::writeStrArr(const char *marker, const PGESTRINGList &value)
+{
+    beginValue(marker);
+    if(!IsEmpty(value))
+    {
+        m_buf.push_back('[');
+        for(pge_size_t i = 0; i < value.size(); i++)
+        {
+            if(i > 0)
+                m_buf.push_back(',');
+            PGEFile::appendEscapedString(m_buf, value[i], true);
+        }
+        m_buf.push_back(']');
+    }
+    endValue();
+}
+
+void PGEXWriter::writeIntArr(const char *marker, const PGELIST<int> &value)
+{
+    beginValue(marker);
+    if(!value.empty())
+    {
+        m_buf.push_back('[');
+        for(pge_size_t i = 0; i < value.size(); i++)
+        {
+            if(i > 0)
+                m_buf.push_back(',');
+            appendNum(value[i]);
+        }
+        m_buf.push_back(']');
+    }
+    endValue();
+}
+
+void PGEXWriter::writeIntArr(const char *marker, const PGELIST<long> &value)
+{
+    beginValue(marker);
+    if(!value.empty())
+    {
+        m_buf.push_back('[');
+        for(pge_size_t i = 0; i < value.size(); i++)
+        {
+            if(i > 0)
+                m_buf.push_back(',');
+            appendNum(value[i]);
+        }
+        m_buf.push_back(']');
+    }
+    endValue();
+}
+
+void PGEXWriter::writeBoolArr(const char *marker, const PGELIST<bool> &value)
+{
+    beginValue(marker);
+    for(bool b : value)
+        m_buf.push_back(b ? '1' : '0');
+    endValue();
+}
+
+PGEXWriter &PGEXWriter::operator<<(const char *raw)
+{
+    m_buf.append(raw);
+    if(m_out && (m_buf.size() >= s_writerFlushSize))
+        flush();
+    return *this;
+}
+
+PGEXWriter &PGEXWriter::operator<<(const PGESTRING &raw)
+{
+    m_buf.append(raw);
+    if(m_out && (m_buf.size() >= s_writerFlushSize))
+        flush();
+    return *this;
+}
+
+void PGEXWriter::flush()
+{
+    if(!m_out || IsEmpty(m_buf))
+        return;
+    m_out->write(m_buf);
+    m_buf.clear();
+}
+
+void PGEXWriter::beginValue(const char *marker)
+{
+    m_buf.append(marker);
+    m_buf.push_back(':');
+}
+
+void PGEXWriter::endValue()
+{
+    m_buf.push_back(';');
+}
+
+void PGEXWriter::appendLatin1(const char *data, size_t len)
+{
+#ifdef PGE_FILES_QT
+    m_buf.append(QLatin1String(data, static_cast<int>(len)));
+#else
+    m_buf.append(data, len);
+#endif
+}
@@ -34,6 +34,10 @@
 #ifndef PGE_X_H
 #define PGE_X_H
 
+#include <functional>
+#include <type_traits>
+#include <utility>
+
 #include "pge_file_lib_globs.h"
 #include "pge_file_lib_private.h"
 
@@ -99,6 +103,109 @@ public:
         PGELIST<PGEX_Entry > subTree;
     };
 
+    /*!
+     * \brief Location of currently parsed value, used to describe parse error
+     */
+    struct PGEX_ValueLocation
+    {
+        //! Section which contains the value
+        const PGEX_Entry *section = nullptr;
+        //! Index of data item in the section
+        pge_size_t item = 0;
+        //! Currently parsed value
+        const PGEX_Val *value = nullptr;
+
+        /*!
+         * \brief Remembers the location of the value which is going to be parsed
+         * \param sct Section which contains the value
+         * \param itm Index of data item in the section
+         * \param val The value
+         * \return The value
+         */
+        inline const PGEX_Val &set(const PGEX_Entry &sct, pge_size_t itm, const PGEX_Val &val)
+        {
+            section = &sct;
+            item = itm;
+            value = &val;
+            return val;
+        }
+    };
+
+    //! Marker key of markers which can't be packed into the 64-bit integer
+    static constexpr uint64_t PGEX_LongMarkerKey = ~static_cast<uint64_t>(0);
+
+    /*!
+     * \brief Packs a marker name literal into the integer key to use as switch case
+     * \param marker Marker name of up to 8 ASCII characters
+     * \return Marker key or PGEX_LongMarkerKey if marker can't be packed
+     */
+    template<size_t N>
+    static constexpr uint64_t markerKey(const char (&marker)[N])
+    {
+        return (N - 1 > 8) ? PGEX_LongMarkerKey : markerKeyStep(marker, N - 1, 0);
+    }
+
+    /*!
+     * \brief Packs a marker name into the integer key
+     * \param marker Marker name
+     * \return Marker key, the same as given by the literal of same marker, or PGEX_LongMarkerKey if marker can't be packed
+     */
+    static inline uint64_t markerKey(const PGESTRING &marker)
+    {
+        pge_size_t len = marker.size();
+        uint64_t key = 0;
+
+        if(len > 8)
+            return PGEX_LongMarkerKey;
+
+        for(pge_size_t i = 0; i < len; ++i)
+        {
+#ifdef PGE_FILES_QT
+            uint64_t c = marker[i].unicode();
+#else
+            uint64_t c = static_cast<unsigned char>(marker[i]);
+#endif
+            if(c == 0 || c > 0x7F)
+                return PGEX_LongMarkerKey;
+            key |= c << (8 * i);
+        }
+
+        return key;
+    }
+
+    /*!
+     * \brief Computes the hash of section name literal
+     * \param name Section name of ASCII characters
+     * \return FNV-1a hash of the name
+     */
+    template<size_t N>
+    static constexpr uint32_t nameHash(const char (&name)[N])
+    {
+        return nameHashStep(name, N - 1, 0, 2166136261u);
+    }
+
+    /*!
+     * \brief Computes the hash of section name
+     * \param name Section name
+     * \return FNV-1a hash of the name, the same as given by the literal of same name
+     */
+    static inline uint32_t nameHash(const PGESTRING &name)
+    {
+        uint32_t hash = 2166136261u;
+        pge_size_t len = name.size();
+
+        for(pge_size_t i = 0; i < len; ++i)
+        {
+#ifdef PGE_FILES_QT
+            hash = (hash ^ name[i].unicode()) * 16777619u;
+#else
+            hash = (hash ^ static_cast<unsigned char>(name[i])) * 16777619u;
+#endif
+        }
+
+        return hash;
+    }
+
 #ifdef PGE_FILES_QT
     /*!
      * \brief QObject-based constructor Constructor
@@ -136,12 +243,24 @@ public:
      */
     explicit PGEFile(const PGESTRING &_rawData);
 
+    /*!
+     * \brief Constructor with taking of raw data
+     * \param _rawData
+     */
+    explicit PGEFile(PGESTRING &&_rawData);
+
     /*!
      * \brief Stores raw data string
      * \param _rawData String contains raw data of entire file
      */
     void setRawData(const PGESTRING &_rawData);
 
+    /*!
+     * \brief Takes raw data string
+     * \param _rawData String contains raw data of entire file
+     */
+    void setRawData(PGESTRING &&_rawData);
+
     /*!
      * \brief Parses stored raw data into the data tree
      * \return
@@ -154,16 +273,125 @@ public:
      */
     PGESTRING lastError();
 
+    /*!
+     * \brief Indexes boundaries of top-level sections in the stored raw data without decoding them
+     * \return false if some section is not closed
+     */
+    bool buildSectionsIndex();
+
+    /*!
+     * \brief Returns the top-level section of given name, the section is decoded on first request
+     * Requires the sections index built by buildSectionsIndex()
+     * \param name Name of the section
+     * \return Decoded section or nullptr if there is no section of given name
+     */
+    const PGEX_Entry *section(const PGESTRING &name);
+
+    /*!
+     * \brief Independent part of PGE-X data which can be decoded separately from other parts
+     */
+    struct PGEX_Chunk
+    {
+        //! Name of sections stored in the chunk, empty for the chunk of all other sections
+        PGESTRING name;
+        //! Raw data of the chunk, a valid PGE-X document
+        PGESTRING data;
+    };
+
+    /*!
+     * \brief Splits raw data at section boundaries into chunks which can be decoded concurrently
+     * Every section of given names is moved into separated chunks, big sections are additionally
+     * split between data items into several parts. All other sections are kept in the first chunk in original order.
+     * \param rawData Raw data, CR characters will be removed
+     * \param sections Names of sections which data items are independent from other sections
+     * \param parts Maximal number of parts to split one section into
+     * \param chunks Output list of chunks, chunks of every section name are stored in the original order
+     * \return false if raw data can't be split, for example, some section is not closed
+     */
+    static bool splitToChunks(PGESTRING &rawData, const PGESTRINGList &sections, unsigned int parts, PGELIST<PGEX_Chunk> &chunks);
+
+    /*!
+     * \brief Returns the number of threads to use for the parallel decoding
+     * \param threads Requested number of threads, 0 to use all hardware threads
+     * \return Number of threads, always 1 if the library was built without multi-threading support
+     */
+    static unsigned int parallelThreads(unsigned int threads);
+
+    /*!
+     * \brief Calls the function for every index in range from 0 to count by a pool of threads
+     * \param count Number of jobs
+     * \param threads Number of threads, jobs are processed in the current thread if 1 or less
+     * \param job Function to call, receives the index of job
+     */
+    static void runParallel(pge_size_t count, unsigned int threads, const std::function<void(pge_size_t)> &job);
+
+    /*!
+     * \brief Moves data items decoded from a separated chunk to the end of the list and numbers them as following items
+     * \param dst Destination list
+     * \param src Items decoded from the chunk, will be cleared
+     * \param arrayId Counter of array IDs of the destination list
+     */
+    template<class T>
+    static void mergeChunkItems(PGELIST<T> &dst, PGELIST<T> &src, unsigned int &arrayId)
+    {
+        for(pge_size_t i = 0; i < src.size(); i++)
+        {
+            T &item = src[i];
+            item.meta.array_id = arrayId++;
+            item.meta.index = static_cast<unsigned int>(dst.size());
+            dst.push_back(std::move(item));
+        }
+        src.clear();
+    }
+
+    /*!
+     * \brief Builds error message about the invalid value
+     * \param loc Location of the invalid value
+     * \return Error message
+     */
+    static PGESTRING valueErrorString(const PGEX_ValueLocation &loc);
+
     //! Full data tree of all parsed data
     PGELIST<PGEX_Entry > dataTree;
 
 private:
+    static constexpr uint64_t markerKeyStep(const char *marker, size_t len, size_t i)
+    {
+        return (i == len) ? 0 :
+               (static_cast<unsigned char>(marker[i]) == 0 || static_cast<unsigned char>(marker[i]) > 0x7F) ?
+               PGEX_LongMarkerKey :
+               (static_cast<uint64_t>(static_cast<unsigned char>(marker[i])) << (8 * i)) | markerKeyStep(marker, len, i + 1);
+    }
+
+    static constexpr uint32_t nameHashStep(const char *name, size_t len, size_t i, uint32_t hash)
+    {
+        return (i == len) ? hash :
+               nameHashStep(name, len, i + 1, (hash ^ static_cast<unsigned char>(name[i])) * 16777619u);
+    }
+
+    /*!
+     * \brief Location of top-level section in the raw data
+     */
+    struct SectionIndex
+    {
+        //! Name of section
+        PGESTRING name;
+        //! Offset of the first line after the section title
+        pge_size_t begin = 0;
+        //! Offset of the section end line
+        pge_size_t end = 0;
+        //! Is section already decoded?
+        bool decoded = false;
+        //! Decoded section
+        PGEX_Entry entry;
+    };
+
     //! Last occouped error
     PGESTRING m_lastError;
     //! Stored raw data set
     PGESTRING m_rawData;
-    //! Unparsed data separated to their data sections
-    PGELIST<PGEXSct > m_rawDataTree;
+    //! Index of top-level sections in the raw data
+    PGELIST<SectionIndex> m_sectionsIndex;
 
     //Static functions
 public:
@@ -339,6 +567,12 @@ public:
      * \return Plain text string
      */
     static PGESTRING X2STRING(PGESTRING input);
+    /*!
+     * \brief Decodes PGE-X string into plain text string, reusing the storage of output string
+     * \param input Encoded PGE-X string value
+     * \param output Plain text string
+     */
+    static void X2STRING(const PGESTRING &input, PGESTRING &output);
     /*!
      * \brief Decodes PGE-X String array into array of plain text strings
      * \param src Encoded PGE-X string value
@@ -346,17 +580,38 @@ public:
      */
     static PGESTRINGList X2STRArr(const PGESTRING &in, bool *_valid = nullptr);
     /*!
-     * \brief Decodes PGE-X String array into array of plain text strings
-     * \param src Encoded PGE-X string value
-     * \return List of plain text strings
+     * \brief Validates and decodes PGE-X String array into array of plain text strings in one pass
+     * \param in Encoded PGE-X string array
+     * \param out List of plain text strings
+     * \return true if given value is a valid string array
+     */
+    static bool X2STRArr(const PGESTRING &in, PGESTRINGList &out);
+    /*!
+     * \brief Decodes PGE-X Integer array into array of integers
+     * \param src Encoded PGE-X integer array
+     * \return List of integers
      */
     static PGELIST<long> X2IntArr(const PGESTRING &in, bool *_valid = nullptr);
+    /*!
+     * \brief Validates and decodes PGE-X Integer array into array of integers in one pass
+     * \param in Encoded PGE-X integer array
+     * \param out List of integers
+     * \return true if given value is a valid integer array
+     */
+    static bool X2IntArr(const PGESTRING &in, PGELIST<long> &out);
     /*!
      * \brief Decodes PGE-X Boolean array into array of boolean flags
      * \param src Encoded PGE-X boolean array
      * \return List of boolean flags
      */
     static PGELIST<bool> X2BollArr(const PGESTRING &src);
+    /*!
+     * \brief Validates and decodes PGE-X Boolean array into array of boolean flags in one pass
+     * \param src Encoded PGE-X boolean array
+     * \param out List of boolean flags
+     * \return true if given value is a valid boolean array
+     */
+    static bool X2BollArr(const PGESTRING &src, PGELIST<bool> &out);
 
     /*!
      * \brief Applies PGE-X escape sequensions to the plain text string
@@ -365,6 +620,13 @@ public:
      * \param [__in]  addQuotes adds quotes to begin and end of the output string
      */
     static void escapeString(PGESTRING &output, const PGESTRING &input, bool addQuotes = false);
+    /*!
+     * \brief Applies PGE-X escape sequensions to the plain text string and appends result to the end of output
+     * \param [__inout] output Target string where result will be appended
+     * \param [__in]  input plain text string
+     * \param [__in]  addQuotes adds quotes to begin and end of the appended string
+     */
+    static void appendEscapedString(PGESTRING &output, const PGESTRING &input, bool addQuotes = false);
     /*!
      * \brief Decodes PGE-X escape-sequensions
      * \param [__inout] input Plain text string with applied escape sequensions
@@ -392,5 +654,267 @@ public:
     static PGESTRING removeQuotes(PGESTRING str);
 };
 
+/*!
+ * \brief Callbacks interface of the streaming PGE-X reader
+ *
+ * Marker and value strings are owned by the reader and are reused for the
+ * next values, they are valid during the callback call only.
+ */
+class PGEXVisitor
+{
+public:
+    virtual ~PGEXVisitor() = default;
+    /*!
+     * \brief Called on begin of top-level section
+     * \param name Name of the section
+     * \return true to read items of the section, false to skip the section
+     */
+    virtual bool onSectionBegin(const PGESTRING &name) = 0;
+    /*!
+     * \brief Called on end of the section which was not skipped
+     * \param name Name of the section
+     * \return false to stop the reading
+     */
+    virtual bool onSectionEnd(const PGESTRING &name);
+    /*!
+     * \brief Called on begin of data item (a line of the section)
+     * \return false to stop the reading
+     */
+    virtual bool onItemBegin();
+    /*!
+     * \brief Called on each value of data item
+     * \param marker Marker of the value
+     * \param value Raw encoded value
+     * \return false to stop the reading
+     */
+    virtual bool onValue(PGESTRING &marker, PGESTRING &value) = 0;
+    /*!
+     * \brief Called on end of data item
+     * \return false to stop the reading
+     */
+    virtual bool onItemEnd();
+};
+
+/*!
+ * \brief Streaming PGE-X reader which decodes data line by line without building the data tree
+ *
+ * Only one section header and one data item are kept in memory at a time.
+ * Sub-trees inside sections are skipped.
+ */
+class PGEXStream
+{
+public:
+    /*!
+     * \brief Constructor
+     * \param in Opened text input to read data from
+     */
+    explicit PGEXStream(PGE_FileFormats_misc::TextInput &in);
+
+    /*!
+     * \brief Moves to the next top-level section, remaining items of current section are skipped
+     * \return false if no more sections or an error has occurred
+     */
+    bool nextSection();
+    /*!
+     * \brief Reads the next data item of current section
+     * \return false if section has ended or an error has occurred
+     */
+    bool nextItem();
+    /*!
+     * \brief Reads all remaining data and reports it into the visitor
+     * \param visitor Receiver of the data
+     * \return false if an error has occurred or visitor has stopped the reading
+     */
+    bool visit(PGEXVisitor &visitor);
+
+    /*!
+     * \brief Current section, contains the name and the type only
+     * \return Current section
+     */
+    inline PGEFile::PGEX_Entry &section()
+    {
+        return m_section;
+    }
+    /*!
+     * \brief Current data item
+     * \return Current data item
+     */
+    inline PGEFile::PGEX_Item &item()
+    {
+        return m_item;
+    }
+    /*!
+     * \brief Has data syntax error been occurred?
+     * \return true if error has been occurred
+     */
+    inline bool hasError() const
+    {
+        return !IsEmpty(m_lastError);
+    }
+    /*!
+     * \brief Returns the syntax error description
+     * \return Last occouped error
+     */
+    inline const PGESTRING &lastError() const
+    {
+        return m_lastError;
+    }
+
+private:
+    bool readLine();
+    bool skipSubTree(const PGESTRING &name);
+    void setNotClosedError();
+
+    //! Source of data
+    PGE_FileFormats_misc::TextInput &m_in;
+    //! Line which is being processed
+    PGESTRING m_line;
+    //! Current section
+    PGEFile::PGEX_Entry m_section;
+    //! Current data item
+    PGEFile::PGEX_Item m_item;
+    //! Are items of current section not finished yet?
+    bool m_inSection = false;
+    //! Last occouped error
+    PGESTRING m_lastError;
+};
+
+
+/*!
+ * \brief PGE-X data generator which appends encoded values directly into the output buffer
+ *
+ * Values are encoded the same way as PGEFile::value() with PGEFile::Write*()
+ * functions do, but without temporary strings. When writing into the text
+ * output, data is collected in the internal buffer and written by big pieces.
+ */
+class PGEXWriter
+{
+public:
+    /*!
+     * \brief Constructor, data will be written into the text output
+     * \param out Opened text output, remaining data is written on destruction or flush()
+     */
+    explicit PGEXWriter(PGE_FileFormats_misc::TextOutput &out);
+    /*!
+     * \brief Constructor, data will be appended to the end of string
+     * \param target Target string
+     */
+    explicit PGEXWriter(PGESTRING &target);
+    ~PGEXWriter();
+
+    PGEXWriter(const PGEXWriter &) = delete;
+    PGEXWriter &operator=(const PGEXWriter &) = delete;
+
+    /*!
+     * \brief Writes integer numeric value
+     * \param marker Name of field
+     * \param value signed or unsigned integer
+     */
+    template<typename T>
+    void writeInt(const char *marker, const T &value)
+    {
+        beginValue(marker);
+        appendNum(value);
+        endValue();
+    }
+    /*!
+     * \brief Writes floating point numeric value with rounding
+     * \param marker Name of field
+     * \param value floating point number
+     */
+    template<typename T>
+    void writeRoundFloat(const char *marker, const T &value)
+    {
+        beginValue(marker);
+        appendNum(std::round(value));
+        endValue();
+    }
+    /*!
+     * \brief Writes floating point numeric value
+     * \param marker Name of field
+     * \param value floating point number
+     */
+    template<typename T>
+    void writeFloat(const char *marker, const T &value)
+    {
+        beginValue(marker);
+        appendNum(value);
+        endValue();
+    }
+    /*!
+     * \brief Writes boolean value
+     * \param marker Name of field
+     * \param value boolean flag
+     */
+    void writeBool(const char *marker, bool value);
+    /*!
+     * \brief Writes escaped string
+     * \param marker Name of field
+     * \param value Plain text string
+     */
+    void writeStr(const char *marker, const PGESTRING &value);
+    /*!
+     * \brief Writes string array
+     * \param marker Name of field
+     * \param value List of plain text strings
+     */
+    void writeStrArr(const char *marker, const PGESTRINGList &value);
+    /*!
+     * \brief Writes array of integers
+     * \param marker Name of field
+     * \param value List of integer numbers
+     */
+    void writeIntArr(const char *marker, const PGELIST<int> &value);
+    /*!
+     * \brief Writes array of integers
+     * \param marker Name of field
+     * \param value List of integer numbers
+     */
+    void writeIntArr(const char *marker, const PGELIST<long> &value);
+    /*!
+     * \brief Writes array of booleans
+     * \param marker Name of field
+     * \param value List of boolean flags
+     */
+    void writeBoolArr(const char *marker, const PGELIST<bool> &value);
+
+    /*!
+     * \brief Writes raw text as is: section titles, ends of items, etc.
+     * \param raw Raw text
+     * \return Reference to this writer
+     */
+    PGEXWriter &operator<<(const char *raw);
+    /*!
+     * \brief Writes raw text as is: section titles, ends of items, etc.
+     * \param raw Raw text
+     * \return Reference to this writer
+     */
+    PGEXWriter &operator<<(const PGESTRING &raw);
+
+    /*!
+     * \brief Writes all collected data into the text output
+     */
+    void flush();
+
+private:
+    void beginValue(const char *marker);
+    void endValue();
+    void appendLatin1(const char *data, size_t len);
+
+    template<typename T>
+    void appendNum(const T &value)
+    {
+        char buf[PGE_FileFormats_misc::NUM_BUFFER_SIZE];
+        appendLatin1(buf, PGE_FileFormats_misc::numToChars(buf, value));
+    }
+
+    //! Text output to write data into, null when writing into string
+    PGE_FileFormats_misc::TextOutput *m_out = nullptr;
+    //! Internal buffer used when writing into the text output
+    PGESTRING m_ownBuffer;
+    //! Buffer where data is appended
+    PGESTRING &m_buf;
+};
+
 
 #endif // PGE_X_H
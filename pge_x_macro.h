@@ -35,35 +35,51 @@
 #ifndef PGE_X_MACRO_H
 #define PGE_X_MACRO_H
 
+#include <type_traits>
+
 /*! \def PGEX_FileBegin()
     \brief Placing at begin of the parsing function
 */
 #define PGEX_FileBegin() int str_count=0; /*Line Counter*/\
                          PGESTRING line;  /*Current Line data*/
 
-/*! \def PGEX_FileParseTree(raw)
-    \brief Parse PGE-X Tree from raw data
+/*! \def PGEX_FileParseStream(input)
+    \brief Prepare the streaming reading of PGE-X data from the text input
+*/
+#define PGEX_FileParseStream(input) PGEFile::PGEX_ValueLocation pgeX_ValueLoc;\
+                                    PGEXStream pgeX_Data(input);
+
+/*! \def PGEX_StreamError()
+    \brief Leaves the loop on the end of data, or jumps to "badfile" on syntax error
 */
-#define PGEX_FileParseTree(raw)  PGEFile pgeX_Data(raw);\
-                            if( !pgeX_Data.buildTreeFromRaw() )\
-                            {\
-                                errorString = pgeX_Data.lastError();\
-                                goto badfile;\
+#define PGEX_StreamError() {\
+                                if(pgeX_Data.hasError())\
+                                {\
+                                    errorString = pgeX_Data.lastError();\
+                                    goto badfile;\
+                                }\
+                                break;\
                             }
 
 /*! \def PGEX_FetchSection()
     \brief Prepare to fetch all data from specified section
 */
-#define PGEX_FetchSection() for(pge_size_t section=0; section < pgeX_Data.dataTree.size(); section++)
+#define PGEX_FetchSection() for(;;)\
+                                if(!pgeX_Data.nextSection())\
+                                    PGEX_StreamError()\
+                                else
 /*! \def PGEX_FetchSection_begin()
     \brief Prepare to detect separate data of different sections
 */
-#define PGEX_FetchSection_begin() PGEFile::PGEX_Entry &f_section = pgeX_Data.dataTree[section];\
+#define PGEX_FetchSection_begin() PGEFile::PGEX_Entry &f_section = pgeX_Data.section();\
+                                  const uint32_t f_sectionHash = PGEFile::nameHash(f_section.name);\
                                   if(IsEmpty(f_section.name)) continue;
 /*! \def PGEX_Section(sct)
     \brief Defines block of fields for section of specified name
+    Section name is compared only when its hash matches to the pre-computed hash of the section name
 */
-#define PGEX_Section(sct)   else if(f_section.name == sct)
+#define PGEX_Section(sct)   else if(f_sectionHash == std::integral_constant<uint32_t, PGEFile::nameHash(sct)>::value &&\
+                                    f_section.name == sct)
 /*! \def PGEX_SectionBegin(stype)
     \brief Run syntax of raw data in this section for specified data type
 */
@@ -75,106 +91,178 @@
 /*! \def PGEX_Items()
     \brief Prepare to read items from this section
 */
-#define PGEX_Items() for(pge_size_t sdata = 0; sdata < f_section.data.size(); sdata++)
+#define PGEX_Items() for(pge_size_t sdata = 0; ; sdata++)\
+                         if(!pgeX_Data.nextItem())\
+                             PGEX_StreamError()\
+                         else
 /*! \def PGEX_ItemBegin(stype)
     \brief Declares block with a list of values
 */
-#define PGEX_ItemBegin(stype) if(f_section.data[sdata].type != stype) \
+#define PGEX_ItemBegin(stype) if(pgeX_Data.item().type != stype) \
 { \
     errorString=PGESTRING("Wrong data item syntax:\nSection ["+f_section.name+"]\nData line "+fromNum(sdata));\
     goto badfile;\
 }\
-PGEFile::PGEX_Item x = f_section.data[sdata];
+PGEFile::PGEX_Item &x = pgeX_Data.item();
 
 /*! \def PGEX_Values()
     \brief Declares block with a list of values
+    Values are dispatched by the switch on the packed marker key, so the block
+    must contain PGEX_ValueBegin() and value macros only, each marker may appear once
 */
-#define PGEX_Values() for(pge_size_t sval=0; sval < x.values.size(); sval++)
+#define PGEX_Values() for(pge_size_t sval=0; sval < x.values.size(); sval++)\
+                      switch(errorString.clear(),\
+                             PGEFile::markerKey(pgeX_ValueLoc.set(f_section, sdata, x.values[sval]).marker))
 /*! \def PGEX_ValueBegin()
     \brief Initializes getting of the values
+    Values with empty and unknown markers are skipped.
+    The error message about the value is built by PGEX_ValueError() on failure only
+*/
+#define PGEX_ValueBegin()  default: break;
+
+/*! \def PGEX_ValueCase(Mark)
+    \brief Begins the switch case of the value with the specified marker
 */
-#define PGEX_ValueBegin()  PGEFile::PGEX_Val v = x.values[sval];\
-                           errorString=PGESTRING("Wrong value syntax\nSection ["+f_section.name+ \
-                           "]\nData line "+fromNum(sdata) \
-                           +"\nMarker "+v.marker+"\nValue "+v.value);\
-                           if(IsEmpty(v.marker)) continue;
+#define PGEX_ValueCase(Mark) case PGEFile::markerKey(Mark):\
+                             static_assert(PGEFile::markerKey(Mark) != PGEFile::PGEX_LongMarkerKey,\
+                                           "Marker " Mark " is too long or contains non-ASCII characters");
+
+/*! \def PGEX_ValueError()
+    \brief Describes the last parsed value in the error string if no other error was set
+    Must be placed after the "badfile" label
+*/
+#define PGEX_ValueError()  if(IsEmpty(errorString))\
+                               errorString = PGEFile::valueErrorString(pgeX_ValueLoc);
 
 /*! \def PGEX_StrVal(Mark, targetValue)
     \brief Parse Plain text string value by requested Marker and write into target variable
 */
-#define PGEX_StrVal(Mark, targetValue)  else if(v.marker==Mark) { if(PGEFile::IsQoutedString(v.value)) \
-                                                targetValue = PGEFile::X2STRING(v.value); \
-                                                else goto badfile; }
+#define PGEX_StrVal(Mark, targetValue) PGEX_ValueCase(Mark)\
+                                       {\
+                                           PGEFile::PGEX_Val &v = x.values[sval];\
+                                           if(PGEFile::IsQoutedString(v.value))\
+                                               PGEFile::X2STRING(v.value, targetValue);\
+                                           else goto badfile;\
+                                       }\
+                                       break;
+
 /*! \def PGEX_StrArrVal(Mark, targetValue)
     \brief Parse Plain text string array value by requested Marker and write into target variable
 */
-#define PGEX_StrArrVal(Mark, targetValue)  else if(v.marker==Mark) { bool valid=false;\
-                                                targetValue = PGEFile::X2STRArr(v.value, &valid); \
-                                                if(!valid) goto badfile; }
+#define PGEX_StrArrVal(Mark, targetValue) PGEX_ValueCase(Mark)\
+                                          {\
+                                              PGEFile::PGEX_Val &v = x.values[sval];\
+                                              if(!PGEFile::X2STRArr(v.value, targetValue))\
+                                                  goto badfile;\
+                                          }\
+                                          break;
 
 /*! \def PGEX_BoolVal(Mark, targetValue)
     \brief Parse boolean flag value by requested Marker and write into target variable
 */
-#define PGEX_BoolVal(Mark, targetValue)  if(v.marker==Mark) { if(PGEFile::IsBool(v.value)) \
-                                         targetValue = static_cast<bool>(toInt(v.value) != 0);\
-                                         else goto badfile; }
+#define PGEX_BoolVal(Mark, targetValue) PGEX_ValueCase(Mark)\
+                                        {\
+                                            PGEFile::PGEX_Val &v = x.values[sval];\
+                                            if(PGEFile::IsBool(v.value))\
+                                                targetValue = static_cast<bool>(toInt(v.value) != 0);\
+                                            else goto badfile;\
+                                        }\
+                                        break;
 
 /*! \def PGEX_BoolArrVal(Mark, targetValue)
     \brief Parse boolean flags array value by requested Marker and write into target variable
 */
-#define PGEX_BoolArrVal(Mark, targetValue)  else if(v.marker==Mark) { if(PGEFile::IsBoolArray(v.value)) \
-                                             targetValue = PGEFile::X2BollArr(v.value); \
-                                            else goto badfile; }
+#define PGEX_BoolArrVal(Mark, targetValue) PGEX_ValueCase(Mark)\
+                                           {\
+                                               PGEFile::PGEX_Val &v = x.values[sval];\
+                                               if(!PGEFile::X2BollArr(v.value, targetValue))\
+                                                   goto badfile;\
+                                           }\
+                                           break;
 
 /*! \def PGEX_UIntVal(Mark, targetValue)
     \brief Parse unsigned integer value by requested Marker and write into target variable
 */
-#define PGEX_USIntVal(Mark, targetValue)  if(v.marker==Mark) { if(PGEFile::IsIntU(v.value)) \
-                                         targetValue = toInt(v.value);\
-                                         else goto badfile; }
+#define PGEX_USIntVal(Mark, targetValue) PGEX_ValueCase(Mark)\
+                                         {\
+                                             PGEFile::PGEX_Val &v = x.values[sval];\
+                                             if(PGEFile::IsIntU(v.value))\
+                                                 targetValue = toInt(v.value);\
+                                             else goto badfile;\
+                                         }\
+                                         break;
 
 /*! \def PGEX_UIntVal(Mark, targetValue)
     \brief Parse unsigned integer value by requested Marker and write into target variable
 */
-#define PGEX_UIntVal(Mark, targetValue)  if(v.marker==Mark) { if(PGEFile::IsIntU(v.value)) \
-                                         targetValue = toUInt(v.value);\
-                                         else goto badfile; }
+#define PGEX_UIntVal(Mark, targetValue) PGEX_ValueCase(Mark)\
+                                        {\
+                                            PGEFile::PGEX_Val &v = x.values[sval];\
+                                            if(PGEFile::IsIntU(v.value))\
+                                                targetValue = toUInt(v.value);\
+                                            else goto badfile;\
+                                        }\
+                                        break;
 
 /*! \def PGEX_SIntVal(Mark, targetValue)
     \brief Parse signed integer value by requested Marker and write into target variable
 */
-#define PGEX_SIntVal(Mark, targetValue)  if(v.marker==Mark) { if(PGEFile::IsIntS(v.value)) \
-                                         targetValue = toInt(v.value);\
-                                         else goto badfile; }
+#define PGEX_SIntVal(Mark, targetValue) PGEX_ValueCase(Mark)\
+                                        {\
+                                            PGEFile::PGEX_Val &v = x.values[sval];\
+                                            if(PGEFile::IsIntS(v.value))\
+                                                targetValue = toInt(v.value);\
+                                            else goto badfile;\
+                                        }\
+                                        break;
 
 /*! \def PGEX_SLongVal(Mark, targetValue)
     \brief Parse signed long integer value by requested Marker and write into target variable
 */
-#define PGEX_SLongVal(Mark, targetValue) if(v.marker==Mark) { if(PGEFile::IsIntS(v.value)) \
-                                         targetValue = toLong(v.value);\
-                                         else goto badfile; }
+#define PGEX_SLongVal(Mark, targetValue) PGEX_ValueCase(Mark)\
+                                         {\
+                                             PGEFile::PGEX_Val &v = x.values[sval];\
+                                             if(PGEFile::IsIntS(v.value))\
+                                                 targetValue = toLong(v.value);\
+                                             else goto badfile;\
+                                         }\
+                                         break;
 
 /*! \def PGEX_ULongVal(Mark, targetValue)
     \brief Parse unsigned long integer value by requested Marker and write into target variable
 */
-#define PGEX_ULongVal(Mark, targetValue) if(v.marker==Mark) { if(PGEFile::IsIntU(v.value)) \
-                                         targetValue = toULong(v.value);\
-                                         else goto badfile; }
+#define PGEX_ULongVal(Mark, targetValue) PGEX_ValueCase(Mark)\
+                                         {\
+                                             PGEFile::PGEX_Val &v = x.values[sval];\
+                                             if(PGEFile::IsIntU(v.value))\
+                                                 targetValue = toULong(v.value);\
+                                             else goto badfile;\
+                                         }\
+                                         break;
 
 /*! \def PGEX_USLongVal(Mark, targetValue)
     \brief Parse unsigned long integer value by requested Marker and write into target variable
 */
-#define PGEX_USLongVal(Mark, targetValue) if(v.marker==Mark) { if(PGEFile::IsIntU(v.value)) \
-                                         targetValue = toLong(v.value);\
-                                         else goto badfile; }
-
+#define PGEX_USLongVal(Mark, targetValue) PGEX_ValueCase(Mark)\
+                                          {\
+                                              PGEFile::PGEX_Val &v = x.values[sval];\
+                                              if(PGEFile::IsIntU(v.value))\
+                                                  targetValue = toLong(v.value);\
+                                              else goto badfile;\
+                                          }\
+                                          break;
 
 /*! \def PGEX_FloatVal(Mark, targetValue)
     \brief Parse floating point value by requested Marker and write into target variable
 */
-#define PGEX_FloatVal(Mark, targetValue)  if(v.marker==Mark) { if(PGEFile::IsFloat(v.value)) \
-                                          targetValue = toDouble(v.value);\
-                                          else goto badfile; }
+#define PGEX_FloatVal(Mark, targetValue) PGEX_ValueCase(Mark)\
+                                         {\
+                                             PGEFile::PGEX_Val &v = x.values[sval];\
+                                             if(PGEFile::IsFloat(v.value))\
+                                                 targetValue = toDouble(v.value);\
+                                             else goto badfile;\
+                                         }\
+                                         break;
 
 
 #endif // PGE_X_MACRO_H
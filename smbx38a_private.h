@@ -28,7 +28,6 @@
 #ifndef SMBX38A_PRIVATE_H
 #define SMBX38A_PRIVATE_H
 
-#include <functional>
 #include "smbx64.h"
 #include "smbx64_macro.h"
 #include "CSVReaderPGE.h"
@@ -65,7 +64,7 @@ extern const int SMBX38A_NpcGeneratorDirections[29];
 // Common functions
 static auto PGEUrlDecodeFunc = [](PGESTRING &data)
 {
-    data = PGE_URLDEC(data);
+    PGE_URLDEC_INPLACE(data);
 };
 static auto PGEBase64DecodeFunc = [](PGESTRING &data)
 {
@@ -77,21 +76,34 @@ static auto PGEBase64DecodeFuncA = [](PGESTRING &data)
 };
 static auto PGELayerOrDefault = [](PGESTRING &data)
 {
-    data = (IsEmpty(data) ? "Default" : PGE_URLDEC(data));
+    if(IsEmpty(data))
+        data = "Default";
+    else
+        PGE_URLDEC_INPLACE(data);
 };
 static auto PGEFilpBool = [](bool &value)
 {
     value = !value;
 };
 
+/*!
+ * \brief Post-processor which clamps the value to the minimum
+ */
 template<class T>
-constexpr std::function<void(T &)> MakeMinFunc(T min)
+struct SMBX38A_MinFunc
 {
-    return [ = ](T & value)
+    T min;
+    inline void operator()(T &value) const
     {
         if(value < min)
             value = min;
-    };
+    }
+};
+
+template<class T>
+constexpr SMBX38A_MinFunc<T> MakeMinFunc(T min)
+{
+    return SMBX38A_MinFunc<T> {min};
 }
 
 /*!
@@ -192,6 +204,73 @@ inline void SMBX38A_RestoreOrigTime(NumT &orig, const NumT &cur, PGE_FileLibrary
                                              PGE_FileLibrary::TimeUnit::FrameOneOf65sec);
 }
 
+//! Packs characters of the null-terminated string into the number, use SMBX38A_RecordId() instead
+static constexpr uint32_t SMBX38A_RecordIdPack(const char *id, uint32_t packed = 0)
+{
+    return (*id == '\0') ? packed : SMBX38A_RecordIdPack(id + 1, (packed << 8) | static_cast<unsigned char>(*id));
+}
+
+/*!
+ * \brief Packs the record type identifier (up to 4 characters) into the number
+ * \param id Identifier of the record type
+ * \return Packed identifier to use as a switch() label
+ */
+template<size_t N>
+static constexpr uint32_t SMBX38A_RecordId(const char (&id)[N])
+{
+    static_assert(N >= 2 && N <= 5, "Record type identifier must have from 1 to 4 characters");
+    return SMBX38A_RecordIdPack(id);
+}
+
+/*!
+ * \brief Packs the record type identifier given by the first field of the line
+ * \param id First field of the line
+ * \return Packed identifier, or 0 if field can't be a known record type
+ */
+static inline uint32_t SMBX38A_RecordId(const CSVPGESTRINGField &id)
+{
+    const size_t len = CSVPGESTRINGUtils::length(id);
+    if(len == 0 || len > 4)
+        return 0;
+
+    uint32_t packed = 0;
+    for(size_t i = 0; i < len; i++)
+    {
+#ifdef PGE_FILES_QT
+        const unsigned c = id.at(static_cast<int>(i)).unicode();
+#else
+        const unsigned c = static_cast<unsigned char>(id[i]);
+#endif
+        if(c == 0 || c > 0xFF)
+            return 0;
+        packed = (packed << 8) | c;
+    }
+
+    return packed;
+}
+
+/*!
+ * \brief Unpacks the record type identifier back into the string
+ * \param id Packed identifier
+ * \return Record type identifier
+ */
+static inline PGESTRING SMBX38A_RecordIdToString(uint32_t id)
+{
+    PGESTRING out;
+    for(int shift = 24; shift >= 0; shift -= 8)
+    {
+        const char c = static_cast<char>((id >> shift) & 0xFF);
+        if(c == '\0')
+            continue;
+#ifdef PGE_FILES_QT
+        out.push_back(QChar::fromLatin1(c));
+#else
+        out.push_back(c);
+#endif
+    }
+    return out;
+}
+
 static inline void SMBX38A_CC_decode(int32_t &destKey, int64_t &destValue, const PGESTRING &key)
 {
     if(IsEmpty(key) || (key.size() < 4))
@@ -25,6 +25,13 @@
  */
 
 #include "smbx64.h"
+#include "CSVUtils.h"
+
+#ifndef PGE_FILES_QT
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+#endif
 
 namespace smbx64Format
 {
@@ -63,6 +70,340 @@ namespace smbx64Format
 #endif
 }
 
+// /////////////Parsers///////////////
+
+PGESTRING SMBX64::ParseErrorToString(const ParseError &error)
+{
+    PGESTRING ret = "Invalid value of the ";
+    ret += error.field ? error.field : "unknown";
+    ret += " field: ";
+
+    switch(error.status)
+    {
+    case PARSE_OK:
+        ret += "no error";
+        break;
+    case PARSE_INVALID_NUMBER:
+        ret += "not a number";
+        break;
+    case PARSE_OUT_OF_RANGE:
+        ret += "number is out of range";
+        break;
+    case PARSE_INVALID_BOOL:
+        ret += "not a boolean (must be #TRUE# or #FALSE#)";
+        break;
+    }
+
+    ret += "\n";
+    return ret;
+}
+
+void SMBX64::SetReadError(FileFormatMeta &meta, const char *fileKind, unsigned int file_format,
+                          const PGESTRING &reason, long lineNum, PGESTRING &line)
+{
+    if(file_format > 0)
+        meta.ERROR_info = "Detected file format: SMBX-" + fromNum(file_format) + " is invalid\n";
+    else
+        meta.ERROR_info = PGESTRING("It is not an SMBX ") + fileKind + " file\n";
+
+    meta.ERROR_info += reason;
+    meta.ERROR_linenum = lineNum;
+    meta.ERROR_linedata = std::move(line);
+    meta.ReadFileValid = false;
+    PGE_CutLength(meta.ERROR_linedata, 50);
+    PGE_FilterBinary(meta.ERROR_linedata);
+}
+
+void SMBX64::SetReadError(FileFormatMeta &meta, const char *fileKind, unsigned int file_format,
+                          const ParseError &error, long lineNum, PGESTRING &line)
+{
+    SetReadError(meta, fileKind, file_format, ParseErrorToString(error), lineNum, line);
+}
+
+void SMBX64::SetReadError(FileFormatMeta &meta, const char *fileKind, unsigned int file_format,
+                          const std::exception &error, long lineNum, PGESTRING &line)
+{
+#ifdef PGE_FILES_QT
+    SetReadError(meta, fileKind, file_format, QString::fromStdString(exception_to_pretty_string(error)), lineNum, line);
+#else
+    SetReadError(meta, fileKind, file_format, exception_to_pretty_string(error), lineNum, line);
+#endif
+}
+
+template<typename T>
+static SMBX64::ParseStatus parseCSVBoolT(T *out, const PGESTRING &input)
+{
+    if(IsEmpty(input) || input == "#FALSE#" || input == "false" || input == "0")
+        *out = T(0);
+    else if(input == "#TRUE#" || input == "true" || input == "!0" || input == "1")
+        *out = T(1);
+    else
+        return SMBX64::PARSE_INVALID_BOOL;
+    return SMBX64::PARSE_OK;
+}
+
+SMBX64::ParseStatus SMBX64::ParseCSVBool(bool *out, const PGESTRING &input)
+{
+    return parseCSVBoolT(out, input);
+}
+
+SMBX64::ParseStatus SMBX64::ParseCSVBool(int *out, const PGESTRING &input)
+{
+    return parseCSVBoolT(out, input);
+}
+
+SMBX64::ParseStatus SMBX64::ParseCSVBool(long *out, const PGESTRING &input)
+{
+    return parseCSVBoolT(out, input);
+}
+
+#ifdef PGE_FILES_QT
+
+#define PGE_ParseQtNumber(type, out, expr) \
+    bool ok = true;\
+    type value = (expr);\
+    if(!ok)\
+        return PARSE_INVALID_NUMBER;\
+    *out = value;\
+    return PARSE_OK
+
+SMBX64::ParseStatus SMBX64::ParseUInt(unsigned int *out, const PGESTRING &input)
+{ PGE_ParseQtNumber(unsigned int, out, input.toUInt(&ok)); }
+
+SMBX64::ParseStatus SMBX64::ParseUInt(unsigned long *out, const PGESTRING &input)
+{ PGE_ParseQtNumber(unsigned long, out, input.toULong(&ok)); }
+
+SMBX64::ParseStatus SMBX64::ParseUInt(unsigned long long *out, const PGESTRING &input)
+{ PGE_ParseQtNumber(unsigned long long, out, input.toULongLong(&ok)); }
+
+SMBX64::ParseStatus SMBX64::ParseUInt(int *out, const PGESTRING &input)
+{ PGE_ParseQtNumber(int, out, static_cast<int>(input.toUInt(&ok))); }
+
+SMBX64::ParseStatus SMBX64::ParseUInt(long *out, const PGESTRING &input)
+{ PGE_ParseQtNumber(long, out, static_cast<long>(input.toULong(&ok))); }
+
+SMBX64::ParseStatus SMBX64::ParseUInt(long long *out, const PGESTRING &input)
+{ PGE_ParseQtNumber(long long, out, static_cast<long long>(input.toULongLong(&ok))); }
+
+SMBX64::ParseStatus SMBX64::ParseSInt(int *out, const PGESTRING &input)
+{ PGE_ParseQtNumber(int, out, input.toInt(&ok)); }
+
+SMBX64::ParseStatus SMBX64::ParseSInt(long *out, const PGESTRING &input)
+{ PGE_ParseQtNumber(long, out, input.toLong(&ok)); }
+
+SMBX64::ParseStatus SMBX64::ParseSInt(long long *out, const PGESTRING &input)
+{ PGE_ParseQtNumber(long long, out, input.toLongLong(&ok)); }
+
+SMBX64::ParseStatus SMBX64::ParseFloat(float *out, const PGESTRING &input)
+{
+    QString fixed(input);
+    fixed.replace(',', '.');//Allow to parse floats of both comma and dot standard
+    PGE_ParseQtNumber(float, out, fixed.toFloat(&ok));
+}
+
+SMBX64::ParseStatus SMBX64::ParseFloat(double *out, const PGESTRING &input)
+{
+    QString fixed(input);
+    fixed.replace(',', '.');//Allow to parse floats of both comma and dot standard
+    PGE_ParseQtNumber(double, out, fixed.toDouble(&ok));
+}
+
+SMBX64::ParseStatus SMBX64::ParseSIntFromFloat(int *out, const PGESTRING &input)
+{ PGE_ParseQtNumber(int, out, qRound(input.toDouble(&ok))); }
+
+SMBX64::ParseStatus SMBX64::ParseSIntFromFloat(long *out, const PGESTRING &input)
+{ PGE_ParseQtNumber(long, out, static_cast<long>(std::round(input.toDouble(&ok)))); }
+
+#undef PGE_ParseQtNumber
+
+#else // PGE_FILES_QT
+
+namespace smbx64Format
+{
+    static SMBX64::ParseStatus parseInteger(const PGESTRING &input, bool &negative, unsigned long long &magnitude)
+    {
+        bool overflow;
+        if(!PGE_FileFormats_misc::parseDecimal(input.data(), input.data() + input.size(), negative, magnitude, overflow))
+            return SMBX64::PARSE_INVALID_NUMBER;
+        return overflow ? SMBX64::PARSE_OUT_OF_RANGE : SMBX64::PARSE_OK;
+    }
+
+    //! Unsigned value, negative ones are wrapping around like at strtoul()
+    template<typename T>
+    static SMBX64::ParseStatus parseUnsigned(T &out, const PGESTRING &input)
+    {
+        bool negative;
+        unsigned long long magnitude;
+        SMBX64::ParseStatus ret = parseInteger(input, negative, magnitude);
+
+        if(ret != SMBX64::PARSE_OK)
+            return ret;
+
+        if(magnitude > static_cast<unsigned long long>(std::numeric_limits<T>::max()))
+            return SMBX64::PARSE_OUT_OF_RANGE;
+
+        T value = static_cast<T>(magnitude);
+        out = negative ? static_cast<T>(T(0) - value) : value;
+        return SMBX64::PARSE_OK;
+    }
+
+    template<typename T>
+    static SMBX64::ParseStatus parseSigned(T &out, const PGESTRING &input)
+    {
+        bool negative;
+        unsigned long long magnitude;
+        const unsigned long long max = static_cast<unsigned long long>(std::numeric_limits<T>::max());
+        SMBX64::ParseStatus ret = parseInteger(input, negative, magnitude);
+
+        if(ret != SMBX64::PARSE_OK)
+            return ret;
+
+        if(magnitude > (negative ? max + 1 : max))
+            return SMBX64::PARSE_OUT_OF_RANGE;
+
+        if(!negative)
+            out = static_cast<T>(magnitude);
+        else if(magnitude == max + 1)
+            out = std::numeric_limits<T>::min();
+        else
+            out = -static_cast<T>(magnitude);
+
+        return SMBX64::PARSE_OK;
+    }
+
+    static inline float strToFloat(const char *s, char **end, float *)
+    {
+        return std::strtof(s, end);
+    }
+
+    static inline double strToFloat(const char *s, char **end, double *)
+    {
+        return std::strtod(s, end);
+    }
+
+    template<typename T>
+    static SMBX64::ParseStatus parseFloating(T &out, const PGESTRING &input, bool acceptComma)
+    {
+        const char *s = input.c_str();
+        PGESTRING fixed;
+        char *end = nullptr;
+        SMBX64::ParseStatus ret = SMBX64::PARSE_OK;
+
+        if(acceptComma && (input.find(',') != PGESTRING::npos))
+        {
+            //Allow to parse floats of both comma and dot standard
+            fixed = input;
+            std::replace(fixed.begin(), fixed.end(), ',', '.');
+            s = fixed.c_str();
+        }
+
+        const int savedErrno = errno;
+        errno = 0;
+        T value = static_cast<T>(strToFloat(s, &end, static_cast<T*>(nullptr)));
+
+        if(end == s)
+            ret = SMBX64::PARSE_INVALID_NUMBER;
+        else if(errno == ERANGE)
+            ret = SMBX64::PARSE_OUT_OF_RANGE;
+        else
+            out = value;
+
+        errno = savedErrno;
+        return ret;
+    }
+}
+
+SMBX64::ParseStatus SMBX64::ParseUInt(unsigned int *out, const PGESTRING &input)
+{
+    unsigned long value;
+    ParseStatus ret = smbx64Format::parseUnsigned(value, input);
+    if(ret == PARSE_OK)
+        *out = static_cast<unsigned int>(value);
+    return ret;
+}
+
+SMBX64::ParseStatus SMBX64::ParseUInt(unsigned long *out, const PGESTRING &input)
+{
+    return smbx64Format::parseUnsigned(*out, input);
+}
+
+SMBX64::ParseStatus SMBX64::ParseUInt(unsigned long long *out, const PGESTRING &input)
+{
+    return smbx64Format::parseUnsigned(*out, input);
+}
+
+SMBX64::ParseStatus SMBX64::ParseUInt(int *out, const PGESTRING &input)
+{
+    unsigned long value;
+    ParseStatus ret = smbx64Format::parseUnsigned(value, input);
+    if(ret == PARSE_OK)
+        *out = static_cast<int>(static_cast<unsigned int>(value));
+    return ret;
+}
+
+SMBX64::ParseStatus SMBX64::ParseUInt(long *out, const PGESTRING &input)
+{
+    unsigned long value;
+    ParseStatus ret = smbx64Format::parseUnsigned(value, input);
+    if(ret == PARSE_OK)
+        *out = static_cast<long>(value);
+    return ret;
+}
+
+SMBX64::ParseStatus SMBX64::ParseUInt(long long *out, const PGESTRING &input)
+{
+    unsigned long long value;
+    ParseStatus ret = smbx64Format::parseUnsigned(value, input);
+    if(ret == PARSE_OK)
+        *out = static_cast<long long>(value);
+    return ret;
+}
+
+SMBX64::ParseStatus SMBX64::ParseSInt(int *out, const PGESTRING &input)
+{
+    return smbx64Format::parseSigned(*out, input);
+}
+
+SMBX64::ParseStatus SMBX64::ParseSInt(long *out, const PGESTRING &input)
+{
+    return smbx64Format::parseSigned(*out, input);
+}
+
+SMBX64::ParseStatus SMBX64::ParseSInt(long long *out, const PGESTRING &input)
+{
+    return smbx64Format::parseSigned(*out, input);
+}
+
+SMBX64::ParseStatus SMBX64::ParseFloat(float *out, const PGESTRING &input)
+{
+    return smbx64Format::parseFloating(*out, input, true);
+}
+
+SMBX64::ParseStatus SMBX64::ParseFloat(double *out, const PGESTRING &input)
+{
+    return smbx64Format::parseFloating(*out, input, true);
+}
+
+SMBX64::ParseStatus SMBX64::ParseSIntFromFloat(int *out, const PGESTRING &input)
+{
+    double value;
+    ParseStatus ret = smbx64Format::parseFloating(value, input, false);
+    if(ret == PARSE_OK)
+        *out = static_cast<int>(std::round(value));
+    return ret;
+}
+
+SMBX64::ParseStatus SMBX64::ParseSIntFromFloat(long *out, const PGESTRING &input)
+{
+    double value;
+    ParseStatus ret = smbx64Format::parseFloating(value, input, false);
+    if(ret == PARSE_OK)
+        *out = static_cast<long>(std::round(value));
+    return ret;
+}
+
+#endif // PGE_FILES_QT
+
 // /////////////Validators///////////////
 //returns FALSE on wrong data
 
@@ -34,12 +34,95 @@
 
 #include "pge_file_lib_globs.h"
 #include "pge_file_lib_private.h"
+#include "meta_filedata.h"
+#include <exception>
 
 /*!
  * \brief SMBX64 Standard validation and raw data conversion functions
  */
 namespace SMBX64
 {
+    /*******************Exception-free parsers********************/
+    /*!
+     * \brief Status of the raw value parsing
+     */
+    enum ParseStatus
+    {
+        //! Value has been parsed successfully
+        PARSE_OK = 0,
+        //! Value is not a number
+        PARSE_INVALID_NUMBER,
+        //! Number is out of range of the target type
+        PARSE_OUT_OF_RANGE,
+        //! Value is not a CSV-boolean
+        PARSE_INVALID_BOOL
+    };
+
+    /*!
+     * \brief Description of the raw value parsing failure
+     */
+    struct ParseError
+    {
+        //! Status of the last parse
+        ParseStatus status = PARSE_OK;
+        //! Human-readable name of the field that has failed to parse
+        const char *field = nullptr;
+    };
+
+    /*!
+     * \brief Makes human-readable description of the parse failure
+     * \param error Parse failure details
+     * \return Line-feed terminated description of the failure
+     */
+    PGESTRING ParseErrorToString(const ParseError &error);
+
+    /*!
+     * \brief Marks file data as invalid and fills the error details of the SMBX64 file reader
+     * \param meta File meta-data to fill
+     * \param fileKind Kind of the file used in the message, e.g. "level" or "world map"
+     * \param file_format Detected file format number, 0 if the header wasn't read
+     * \param reason Line-feed terminated description of the failure
+     * \param lineNum Number of the failed line
+     * \param line Data of the failed line, gets moved out
+     */
+    void SetReadError(FileFormatMeta &meta, const char *fileKind, unsigned int file_format,
+                      const PGESTRING &reason, long lineNum, PGESTRING &line);
+
+    //! Same as above, the reason is the failed value parse
+    void SetReadError(FileFormatMeta &meta, const char *fileKind, unsigned int file_format,
+                      const ParseError &error, long lineNum, PGESTRING &line);
+
+    //! Same as above, the reason is the thrown exception
+    void SetReadError(FileFormatMeta &meta, const char *fileKind, unsigned int file_format,
+                      const std::exception &error, long lineNum, PGESTRING &line);
+
+    /*
+     * Parsers below never throw and never modify the output on failure. Integers are
+     * accepted the same way as std::stoul()/std::stol() does (leading spaces, an optional
+     * sign, the trailing garbage gets ignored), but without a locale lookup and errno.
+     */
+    ParseStatus ParseUInt(unsigned int *out, const PGESTRING &input);
+    ParseStatus ParseUInt(unsigned long *out, const PGESTRING &input);
+    ParseStatus ParseUInt(unsigned long long *out, const PGESTRING &input);
+    ParseStatus ParseUInt(int *out, const PGESTRING &input);
+    ParseStatus ParseUInt(long *out, const PGESTRING &input);
+    ParseStatus ParseUInt(long long *out, const PGESTRING &input);
+
+    ParseStatus ParseSInt(int *out, const PGESTRING &input);
+    ParseStatus ParseSInt(long *out, const PGESTRING &input);
+    ParseStatus ParseSInt(long long *out, const PGESTRING &input);
+
+    //! Both comma and dot are accepted as the decimal separator, the input is kept untouched
+    ParseStatus ParseFloat(float *out, const PGESTRING &input);
+    ParseStatus ParseFloat(double *out, const PGESTRING &input);
+
+    ParseStatus ParseSIntFromFloat(int *out, const PGESTRING &input);
+    ParseStatus ParseSIntFromFloat(long *out, const PGESTRING &input);
+
+    ParseStatus ParseCSVBool(bool *out, const PGESTRING &input);
+    ParseStatus ParseCSVBool(int *out, const PGESTRING &input);
+    ParseStatus ParseCSVBool(long *out, const PGESTRING &input);
+
     /*******************Readers With Exception throwers********************/
     inline void ReadUInt(unsigned int*out, PGESTRING &input)
     {
@@ -351,30 +434,30 @@ namespace SMBX64
 
     /******************Internal to RAW**********************/
     /*!
-     * \brief Generate raw string from integer value
+     * \brief Generate raw line from integer value
      * \param input Source signed integer value
-     * \return ASCII encoded signed integer value
+     * \return ASCII encoded signed integer value to write into the TextOutput
      */
     template<typename T>
-    inline PGESTRING WriteSInt(T input)
-    {  return fromNum(static_cast<long long>(input))+"\n"; }
+    inline PGE_FileFormats_misc::NumberOut<long long> WriteSInt(T input)
+    {  return PGE_FileFormats_misc::numOut(static_cast<long long>(input), true); }
 
     /*!
-     * \brief Generate raw string from unsigned integer value
+     * \brief Generate raw line from unsigned integer value
      * \param input Source unsigned integer value
-     * \return ASCII encoded unsigned integer value
+     * \return ASCII encoded unsigned integer value to write into the TextOutput
      */
     template<typename T>
-    inline PGESTRING WriteUInt(T input)
-    {  return fromNum(static_cast<unsigned long long>(input))+"\n"; }
+    inline PGE_FileFormats_misc::NumberOut<unsigned long long> WriteUInt(T input)
+    {  return PGE_FileFormats_misc::numOut(static_cast<unsigned long long>(input), true); }
 
     /*!
      * \brief Generate raw CVS-bool string from boolean value
      * \param input Source boolean value
      * \return ASCII encoded CVS-bool value
      */
-    inline PGESTRING WriteCSVBool(bool input)
-    {  return PGESTRING( (input)?"#TRUE#":"#FALSE#" )+"\n"; }
+    inline const char *WriteCSVBool(bool input)
+    {  return (input) ? "#TRUE#\n" : "#FALSE#\n"; }
 
     /*!
      * \brief Convert string into valid CVS string line (line feeds are will be removed)
@@ -403,20 +486,20 @@ namespace SMBX64
     }
 
     /*!
-     * \brief Generate raw string from floating point value
+     * \brief Generate raw line from floating point value
      * \param input Source floating point vale
-     * \return ASCII encoded floating point value
+     * \return ASCII encoded floating point value to write into the TextOutput
      */
-    inline PGESTRING WriteFloat(float input)
-    {  return fromNum(input)+"\n"; }
+    inline PGE_FileFormats_misc::NumberOut<float> WriteFloat(float input)
+    {  return PGE_FileFormats_misc::numOut(input, true); }
 
     /*!
-     * \brief Generate raw string from double floating point value
+     * \brief Generate raw line from double floating point value
      * \param input Source floating point vale
-     * \return ASCII encoded floating point value
+     * \return ASCII encoded floating point value to write into the TextOutput
      */
-    inline PGESTRING WriteFloat(double input)
-    {  return fromNum(input)+"\n"; }
+    inline PGE_FileFormats_misc::NumberOut<double> WriteFloat(double input)
+    {  return PGE_FileFormats_misc::numOut(input, true); }
 
 
     /******************Units converters**********************/
@@ -38,11 +38,32 @@
 
 //(you must create and open PGE_FileFormats_misc::TextInput &in; !!!)
 #define SMBX64_FileBegin() unsigned int file_format = 0;   /*File format number*/\
+                           SMBX64::ParseError parse_error; /*Details of the value parse failure*/\
                            PGESTRING line                  /*Current Line data*/
 
 //Jump to next line
 #define nextLine() line = in.readCVSLine()
 
+//Parse current line into the field, do the on_failure statement on failure.
+//The field_name is a human-readable name of the field used by the error message.
+#define SMBX64_ReadOr(parse_func, target, field_name, on_failure) \
+    do {\
+        parse_error.status = SMBX64::parse_func(&(target), line);\
+        if(parse_error.status != SMBX64::PARSE_OK)\
+        {\
+            parse_error.field = field_name;\
+            on_failure;\
+        }\
+    } while(false)
+
+//Parse current line into the field, jump to the "badfile:" label on failure
+#define SMBX64_Read(parse_func, target, field_name) \
+    SMBX64_ReadOr(parse_func, target, field_name, goto badfile)
+
+//Parse current line into the field, return false on failure (for the single record decoders)
+#define SMBX64_ReadField(parse_func, target, field_name) \
+    SMBX64_ReadOr(parse_func, target, field_name, return false)
+
 //Version comparison
 #define ge(v) file_format>=(v)
 #define gt(v) file_format>(v)
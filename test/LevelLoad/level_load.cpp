@@ -1,5 +1,9 @@
 #include <catch.hpp>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
 #include "file_formats.h"
+#include "pge_x.h"
 
 
 TEST_CASE("[LevelFile] Load")
@@ -12,3 +16,728 @@ TEST_CASE("[LevelFile] Load")
     REQUIRE(res);
     REQUIRE(lvl.meta.ReadFileValid);
 }
+
+TEST_CASE("[LevelFile] Mapped input matches file input")
+{
+    PGE_FileFormats_misc::TextFileInput file;
+    PGE_FileFormats_misc::MappedTextFileInput mapped;
+
+    REQUIRE(file.open("sample.lvl", false));
+    REQUIRE(mapped.open("sample.lvl", false));
+
+    REQUIRE(file.read(8) == mapped.read(8));
+    REQUIRE(file.seek(0, PGE_FileFormats_misc::TextInput::begin) == mapped.seek(0, PGE_FileFormats_misc::TextInput::begin));
+
+    while(!file.eof())
+    {
+        REQUIRE(!mapped.eof());
+        REQUIRE(file.readCVSLine() == mapped.readCVSLine());
+        REQUIRE(file.getCurrentLineNumber() == mapped.getCurrentLineNumber());
+        REQUIRE(file.tell() == mapped.tell());
+    }
+    REQUIRE(mapped.eof());
+
+    REQUIRE(file.reOpen(false));
+    REQUIRE(mapped.reOpen(false));
+
+    while(!file.eof())
+    {
+        REQUIRE(file.readLine() == mapped.readLine());
+        REQUIRE(file.getCurrentLineNumber() == mapped.getCurrentLineNumber());
+    }
+    REQUIRE(mapped.eof());
+
+    REQUIRE(file.readAll() == mapped.readAll());
+}
+
+TEST_CASE("[LevelFile] Raw data view matches raw string")
+{
+    std::ifstream file("sample.lvl", std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    REQUIRE(!bytes.empty());
+
+    PGE_FileFormats_misc::TextFileInput textFile("sample.lvl", false);
+    PGESTRING rawData = textFile.readAll();
+    textFile.close();
+
+    LevelData fromString, fromView;
+    REQUIRE(FileFormats::OpenLevelRaw(rawData, "sample.lvl", fromString));
+    REQUIRE(FileFormats::OpenLevelRaw(bytes.data(), bytes.size(), "sample.lvl", fromView));
+
+    REQUIRE(fromView.meta.ReadFileValid);
+    REQUIRE(fromView.LevelName == fromString.LevelName);
+    REQUIRE(fromView.blocks.size() == fromString.blocks.size());
+    REQUIRE(fromView.npc.size() == fromString.npc.size());
+    REQUIRE(fromView.bgo.size() == fromString.bgo.size());
+    REQUIRE(fromView.events.size() == fromString.events.size());
+
+    PGESTRING a, b;
+    REQUIRE(FileFormats::WriteExtendedLvlFileRaw(fromString, a));
+    REQUIRE(FileFormats::WriteExtendedLvlFileRaw(fromView, b));
+    REQUIRE(a == b);
+}
+
+class PGEXTreeDumper : public PGEXVisitor
+{
+public:
+    PGESTRING dump;
+
+    bool onSectionBegin(const PGESTRING &name) override
+    {
+        dump += "[" + name + "]\n";
+        return true;
+    }
+
+    bool onValue(PGESTRING &marker, PGESTRING &value) override
+    {
+        dump += marker + ":" + value + ";";
+        return true;
+    }
+
+    bool onItemEnd() override
+    {
+        dump += "\n";
+        return true;
+    }
+};
+
+TEST_CASE("[LevelFile] Streaming PGE-X reader matches data tree")
+{
+    LevelData lvl;
+    REQUIRE(FileFormats::OpenLevelFile("sample.lvl", lvl));
+
+    PGESTRING lvlx;
+    REQUIRE(FileFormats::WriteExtendedLvlFileRaw(lvl, lvlx));
+
+    PGEFile tree(lvlx);
+    REQUIRE(tree.buildTreeFromRaw());
+
+    PGESTRING expected;
+    for(const PGEFile::PGEX_Entry &section : tree.dataTree)
+    {
+        expected += "[" + section.name + "]\n";
+        for(const PGEFile::PGEX_Item &item : section.data)
+        {
+            for(const PGEFile::PGEX_Val &v : item.values)
+                expected += v.marker + ":" + v.value + ";";
+            expected += "\n";
+        }
+    }
+
+    PGE_FileFormats_misc::RawTextInput in(&lvlx);
+    PGEXStream stream(in);
+    PGEXTreeDumper dumper;
+    REQUIRE(stream.visit(dumper));
+    REQUIRE(dumper.dump == expected);
+
+    LevelData streamed;
+    REQUIRE(FileFormats::ReadExtendedLvlFileRaw(lvlx, "sample.lvlx", streamed));
+    REQUIRE(streamed.blocks.size() == lvl.blocks.size());
+    REQUIRE(streamed.npc.size() == lvl.npc.size());
+
+    PGESTRING broken = lvlx.substr(0, lvlx.size() / 2);
+    PGE_FileFormats_misc::RawTextInput brokenIn(&broken);
+    PGEXStream brokenStream(brokenIn);
+    PGEXTreeDumper brokenDumper;
+    REQUIRE(!brokenStream.visit(brokenDumper));
+    REQUIRE(brokenStream.hasError());
+}
+
+TEST_CASE("[LevelFile] Indexed PGE-X sections match data tree")
+{
+    LevelData lvl;
+    REQUIRE(FileFormats::OpenLevelFile("sample.lvl", lvl));
+
+    PGESTRING lvlx;
+    REQUIRE(FileFormats::WriteExtendedLvlFileRaw(lvl, lvlx));
+
+    PGEFile tree(lvlx);
+    REQUIRE(tree.buildTreeFromRaw());
+
+    PGEFile indexed(lvlx);
+    REQUIRE(indexed.buildSectionsIndex());
+    REQUIRE(indexed.section("NOT_EXISTING") == nullptr);
+
+    for(const PGEFile::PGEX_Entry &expected : tree.dataTree)
+    {
+        const PGEFile::PGEX_Entry *sct = indexed.section(expected.name);
+        REQUIRE(sct != nullptr);
+        REQUIRE(sct->type == expected.type);
+        REQUIRE(sct->data.size() == expected.data.size());
+        for(size_t i = 0; i < expected.data.size(); i++)
+        {
+            REQUIRE(sct->data[i].values.size() == expected.data[i].values.size());
+            for(size_t j = 0; j < expected.data[i].values.size(); j++)
+            {
+                REQUIRE(sct->data[i].values[j].marker == expected.data[i].values[j].marker);
+                REQUIRE(sct->data[i].values[j].value == expected.data[i].values[j].value);
+            }
+        }
+    }
+
+    PGESTRING broken = lvlx.substr(0, lvlx.size() / 2);
+    PGEFile brokenIndex(broken);
+    REQUIRE(!brokenIndex.buildSectionsIndex());
+    REQUIRE(!IsEmpty(brokenIndex.lastError()));
+}
+
+typedef bool (*SerialLevelReader)(PGE_FileFormats_misc::TextInput &, LevelData &);
+typedef bool (*ParallelLevelReader)(PGE_FileFormats_misc::TextInput &, LevelData &, unsigned int);
+
+template<class T>
+static void requireSameItems(const PGELIST<T> &parallel, const PGELIST<T> &serial)
+{
+    REQUIRE(parallel.size() == serial.size());
+    for(size_t i = 0; i < serial.size(); i++)
+    {
+        REQUIRE(parallel[i].meta.array_id == serial[i].meta.array_id);
+        REQUIRE(parallel[i].meta.index == serial[i].meta.index);
+    }
+}
+
+// Reads the data by both readers and requires the same result or the same error
+static bool requireParallelMatchesSerial(const PGESTRING &data, SerialLevelReader readSerial, ParallelLevelReader readParallel)
+{
+    LevelData serial;
+    PGE_FileFormats_misc::RawTextInput serialIn(&data, "test.lvl");
+    bool serialValid = readSerial(serialIn, serial);
+
+    LevelData parallel;
+    PGE_FileFormats_misc::RawTextInput parallelIn(&data, "test.lvl");
+    bool parallelValid = readParallel(parallelIn, parallel, 4);
+
+    REQUIRE(parallelValid == serialValid);
+    if(!serialValid)
+    {
+        REQUIRE(parallel.meta.ERROR_info == serial.meta.ERROR_info);
+        REQUIRE(parallel.meta.ERROR_linenum == serial.meta.ERROR_linenum);
+        REQUIRE(parallel.meta.ERROR_linedata == serial.meta.ERROR_linedata);
+        return false;
+    }
+
+    REQUIRE(parallel.blocks_array_id == serial.blocks_array_id);
+    REQUIRE(parallel.bgo_array_id == serial.bgo_array_id);
+    REQUIRE(parallel.npc_array_id == serial.npc_array_id);
+    REQUIRE(parallel.doors_array_id == serial.doors_array_id);
+    requireSameItems(parallel.blocks, serial.blocks);
+    requireSameItems(parallel.bgo, serial.bgo);
+    requireSameItems(parallel.npc, serial.npc);
+    requireSameItems(parallel.doors, serial.doors);
+
+    PGESTRING serialOut, parallelOut;
+    REQUIRE(FileFormats::WriteExtendedLvlFileRaw(serial, serialOut));
+    REQUIRE(FileFormats::WriteExtendedLvlFileRaw(parallel, parallelOut));
+    REQUIRE(parallelOut == serialOut);
+    return true;
+}
+
+// Makes sections big enough to be split between several threads
+static void multiplyObjects(LevelData &lvl, int copies)
+{
+    size_t blocksCount = lvl.blocks.size();
+    size_t bgoCount = lvl.bgo.size();
+    size_t npcCount = lvl.npc.size();
+    size_t doorsCount = lvl.doors.size();
+    for(int copy = 0; copy < copies; copy++)
+    {
+        for(size_t i = 0; i < blocksCount; i++)
+            lvl.blocks.push_back(lvl.blocks[i]);
+        for(size_t i = 0; i < bgoCount; i++)
+            lvl.bgo.push_back(lvl.bgo[i]);
+        for(size_t i = 0; i < npcCount; i++)
+            lvl.npc.push_back(lvl.npc[i]);
+        for(size_t i = 0; i < doorsCount; i++)
+            lvl.doors.push_back(lvl.doors[i]);
+    }
+}
+
+TEST_CASE("[LevelFile] Parallel PGE-X reader matches serial one")
+{
+    LevelData lvl;
+    REQUIRE(FileFormats::OpenLevelFile("sample.lvl", lvl));
+    multiplyObjects(lvl, 50);
+
+    PGESTRING lvlx;
+    REQUIRE(FileFormats::WriteExtendedLvlFileRaw(lvl, lvlx));
+    REQUIRE(requireParallelMatchesSerial(lvlx, FileFormats::ReadExtendedLvlFile, FileFormats::ReadExtendedLvlFile));
+
+    PGESTRING broken = lvlx;
+    broken.replace(broken.find("BGO_END"), 7, "BGO_XND");
+    REQUIRE(!requireParallelMatchesSerial(broken, FileFormats::ReadExtendedLvlFile, FileFormats::ReadExtendedLvlFile));
+}
+
+TEST_CASE("[LevelFile] Parallel SMBX64 reader matches serial one")
+{
+    LevelData lvl;
+    REQUIRE(FileFormats::OpenLevelFile("sample.lvl", lvl));
+
+    // NPCs with the optional lines
+    LevelNPC npc = FileFormats::CreateLvlNpc();
+    npc.x = 64;
+    npc.y = 128;
+    npc.id = 91; // Buried container with the warp selection and its special option
+    npc.contents = 288;
+    npc.special_data = 3;
+    npc.msg = "Hello, world\nof quoted, multi-line messages";
+    lvl.npc.push_back(npc);
+    npc.id = 96; // Egg container
+    npc.contents = 1;
+    npc.special_data = 0;
+    npc.msg.clear();
+    npc.layer = "Layer, with a comma";
+    lvl.npc.push_back(npc);
+    npc.id = 76; // Parakoopa with the special option
+    npc.contents = 0;
+    npc.special_data = 1;
+    npc.generator = true;
+    npc.generator_direct = 2;
+    npc.generator_type = 2;
+    npc.generator_period = 25;
+    lvl.npc.push_back(npc);
+    multiplyObjects(lvl, 50);
+
+    // Writers sort the data in place, keep an untouched copy for the old format
+    LevelData old = lvl;
+
+    PGESTRING smbx64;
+    REQUIRE(FileFormats::WriteSMBX64LvlFileRaw(lvl, smbx64, 64));
+    REQUIRE(requireParallelMatchesSerial(smbx64, FileFormats::ReadSMBX64LvlFile, FileFormats::ReadSMBX64LvlFile));
+
+    // Warps are not terminated by the "next" line before SMBX 1.0.0 and stay at the serial reader.
+    // NPC special lines are not written before SMBX 1.0.0, use NPCs without them.
+    for(auto &n : old.npc)
+    {
+        n.id = 1;
+        n.contents = 0;
+        n.special_data = 0;
+    }
+    PGESTRING smbx8;
+    REQUIRE(FileFormats::WriteSMBX64LvlFileRaw(old, smbx8, 8));
+    REQUIRE(requireParallelMatchesSerial(smbx8, FileFormats::ReadSMBX64LvlFile, FileFormats::ReadSMBX64LvlFile));
+
+    // Break one of block records
+    PGESTRING broken = smbx64;
+    size_t pos = 0;
+    for(int i = 0; i < 1000; i++)
+    {
+        pos = broken.find("#FALSE#", pos + 1);
+        REQUIRE(pos != PGESTRING::npos);
+    }
+    broken.replace(pos, 7, "#BROKEN#");
+    REQUIRE(!requireParallelMatchesSerial(broken, FileFormats::ReadSMBX64LvlFile, FileFormats::ReadSMBX64LvlFile));
+
+    // Break the contents of the last egg
+    broken = smbx64;
+    pos = broken.rfind("\n96\n1\n");
+    REQUIRE(pos != PGESTRING::npos);
+    broken.replace(pos + 4, 1, "X");
+    REQUIRE(!requireParallelMatchesSerial(broken, FileFormats::ReadSMBX64LvlFile, FileFormats::ReadSMBX64LvlFile));
+}
+
+TEST_CASE("[LevelFile] PGE-X writer matches value generators")
+{
+    PGESTRINGList strings;
+    strings.push_back("plain");
+    strings.push_back("with \"quotes\";\nand:escapes[],%\\");
+    PGELIST<long> longs;
+    longs.push_back(-2147483647L - 1);
+    longs.push_back(0);
+    longs.push_back(42);
+    PGELIST<bool> bools;
+    bools.push_back(true);
+    bools.push_back(false);
+
+    PGESTRING expected;
+    expected += PGEFile::value("I", PGEFile::WriteInt(-123));
+    expected += PGEFile::value("U", PGEFile::WriteInt(4294967295u));
+    expected += PGEFile::value("LL", PGEFile::WriteInt(-9223372036854775807LL - 1));
+    expected += PGEFile::value("F", PGEFile::WriteFloat(0.1234567));
+    expected += PGEFile::value("FF", PGEFile::WriteFloat(12345678.0f));
+    expected += PGEFile::value("R", PGEFile::WriteRoundFloat(1234567.5));
+    expected += PGEFile::value("B", PGEFile::WriteBool(true));
+    expected += PGEFile::value("S", PGEFile::WriteStr(strings[1]));
+    expected += PGEFile::value("E", PGEFile::WriteStr(""));
+    expected += PGEFile::value("SA", PGEFile::WriteStrArr(strings));
+    expected += PGEFile::value("EA", PGEFile::WriteStrArr(PGESTRINGList()));
+    expected += PGEFile::value("IA", PGEFile::WriteIntArr(longs));
+    expected += PGEFile::value("BA", PGEFile::WriteBoolArr(bools));
+    expected += "\n";
+
+    PGESTRING direct = "prefix";
+    {
+        PGEXWriter w(direct);
+        w.writeInt("I", -123);
+        w.writeInt("U", 4294967295u);
+        w.writeInt("LL", -9223372036854775807LL - 1);
+        w.writeFloat("F", 0.1234567);
+        w.writeFloat("FF", 12345678.0f);
+        w.writeRoundFloat("R", 1234567.5);
+        w.writeBool("B", true);
+        w.writeStr("S", strings[1]);
+        w.writeStr("E", "");
+        w.writeStrArr("SA", strings);
+        w.writeStrArr("EA", PGESTRINGList());
+        w.writeIntArr("IA", longs);
+        w.writeBoolArr("BA", bools);
+        w << "\n";
+    }
+    REQUIRE(direct == "prefix" + expected);
+
+    PGESTRING written;
+    PGE_FileFormats_misc::RawTextOutput out(&written);
+    {
+        PGEXWriter w(out);
+        for(int i = 0; i < 10000; i++)
+        {
+            w.writeInt("ID", i);
+            w << "\n";
+        }
+    }
+
+    PGESTRING expectedLines;
+    for(int i = 0; i < 10000; i++)
+        expectedLines += PGEFile::value("ID", PGEFile::WriteInt(i)) + "\n";
+    REQUIRE(written == expectedLines);
+}
+
+TEST_CASE("[LevelFile] SMBX64 parse errors report line and field")
+{
+    LevelData lvl;
+    PGESTRING rawData = "64\n0\n\"Test level\"\n-200000\n-200600\nbottom\n";
+
+    REQUIRE(!FileFormats::ReadSMBX64LvlFileRaw(rawData, "broken.lvl", lvl));
+    REQUIRE(!lvl.meta.ReadFileValid);
+    REQUIRE(lvl.meta.ERROR_linenum == 6);
+    REQUIRE(lvl.meta.ERROR_linedata == "bottom");
+    REQUIRE(lvl.meta.ERROR_info.find("Invalid value of the section bottom field") != PGESTRING::npos);
+    REQUIRE(lvl.meta.ERROR_info.find("size_bottom") == PGESTRING::npos);
+
+    rawData = "64\n99999999999999999999\n";
+    REQUIRE(!FileFormats::ReadSMBX64LvlFileRaw(rawData, "broken.lvl", lvl));
+    REQUIRE(lvl.meta.ERROR_linenum == 2);
+    REQUIRE(lvl.meta.ERROR_info.find("out of range") != PGESTRING::npos);
+}
+
+TEST_CASE("[LevelFile] SMBX-38A records are dispatched by their identifiers")
+{
+    // Every record type known to the reader, some of them share the first
+    // characters with the others, and few unknown ones which must be kept as-is
+    const PGESTRING rawData =
+        "SMBXFile69\n"
+        "A|3|%54%65%73%74|||,,,\n"
+        "BTNS|a|b|c|d|e\n"
+        "BTNSX|1\n"
+        "BT|2\n"
+        "P1|10|20\n"
+        "P2|30|40\n"
+        "P3|50|60\n"
+        "M|1|-200000|-200600|800|600|0|0|0|0|0|0|24|32,-1|\n"
+        "B||81|-200000|-200064||0|0||-32|32\n"
+        "T||75|-139392|-140096\n"
+        "N||232|-96416|-100064|1,0,0,0,0,0|1|||0|\n"
+        "Q||-98208|-100064|5184|128|1,0.5,-1,0,0|\n"
+        "W||-195552|-200096|-179904|-180512|1|4|4|0,,0|0,0,1,0,0,0,0,32,0,0,0||0|0|-1|-1|0|\n"
+        "L|%4C%31|1\n"
+        "E|%4C%65%76%65%6C%20%2D%20%53%74%61%72%74||0,|0///||0,0,0,0,0,0,0,0,0,0,0,0|//|0/0|||,0/0,0,65,0,0\n"
+        "V|%4E%65%77|426\n"
+        "R|%41%72%72|%42\n"
+        "S|%53|cHJpbnQgMQ==\n"
+        "Su|%48|YQpi\n"
+        "SU|%49|Yw==\n"
+        "sU|%4A|Yw==\n"
+        "CB|7|0007240,000A6\n"
+        "CT|172|000134\n"
+        "CE|5|000101\n"
+        "CX|6|000101\n"
+        "CW|1,%61|3,%62\n"
+        "ZZZZ|q\n";
+
+    LevelData lvl;
+    REQUIRE(FileFormats::ReadSMBX38ALvlFileRaw(rawData, "records.lvl", lvl));
+    REQUIRE(lvl.meta.ReadFileValid);
+
+    REQUIRE(lvl.stars == 3);
+    REQUIRE(lvl.LevelName == "Test");
+    REQUIRE(lvl.player_names_overrides.size() == 5);
+    REQUIRE(lvl.player_names_overrides[4] == "e");
+
+    REQUIRE(lvl.players.size() == 2);
+    REQUIRE(lvl.players[0].id == 1);
+    REQUIRE(lvl.players[0].x == 10);
+    REQUIRE(lvl.players[0].y == 20);
+    REQUIRE(lvl.players[1].id == 2);
+    REQUIRE(lvl.players[1].x == 30);
+    REQUIRE(lvl.players[1].y == 40);
+
+    REQUIRE(lvl.sections[0].music_id == 24);
+    REQUIRE(lvl.sections[0].size_left == -200000);
+    REQUIRE(lvl.sections[0].size_right == -199200);
+
+    REQUIRE(lvl.blocks.size() == 1);
+    REQUIRE(lvl.blocks[0].id == 81);
+    REQUIRE(lvl.blocks[0].y == -200064);
+    REQUIRE(lvl.blocks[0].w == 32);
+    REQUIRE(lvl.blocks[0].autoscale);
+
+    REQUIRE(lvl.bgo.size() == 1);
+    REQUIRE(lvl.bgo[0].id == 75);
+    REQUIRE(lvl.bgo[0].x == -139392);
+
+    REQUIRE(lvl.npc.size() == 1);
+    REQUIRE(lvl.npc[0].id == 232);
+    REQUIRE(lvl.npc[0].direct == -1);
+
+    REQUIRE(lvl.physez.size() == 1);
+    REQUIRE(lvl.physez[0].w == 5184);
+
+    REQUIRE(lvl.doors.size() == 1);
+    REQUIRE(lvl.doors[0].ix == -195552);
+    REQUIRE(lvl.doors[0].ox == -179904);
+
+    // Internal layers and events are appended after the loaded ones
+    REQUIRE(lvl.layers.size() == 4);
+    REQUIRE(lvl.layers[0].name == "L1");
+
+    REQUIRE(lvl.events.size() >= 1);
+    REQUIRE(lvl.events[0].name == "Level - Start");
+
+    REQUIRE(lvl.variables.size() == 1);
+    REQUIRE(lvl.variables[0].name == "New");
+    REQUIRE(lvl.variables[0].value == "426");
+
+    REQUIRE(lvl.arrays.size() == 2);
+    REQUIRE(lvl.arrays[0].name == "Arr");
+    REQUIRE(lvl.arrays[1].name == "B");
+
+    REQUIRE(lvl.scripts.size() == 3);
+    REQUIRE(lvl.scripts[0].name == "S");
+    REQUIRE(lvl.scripts[0].script == "print 1");
+    REQUIRE(lvl.scripts[1].name == "H");
+    REQUIRE(lvl.scripts[1].script == "a\nb");
+    REQUIRE(lvl.scripts[2].name == "I");
+    REQUIRE(lvl.scripts[2].script == "c");
+
+    REQUIRE(lvl.custom38A_configs.size() == 3);
+    REQUIRE(lvl.custom38A_configs[0].type == LevelItemSetup38A::BLOCK);
+    REQUIRE(lvl.custom38A_configs[0].id == 7);
+    REQUIRE(lvl.custom38A_configs[0].data.size() == 2);
+    REQUIRE(lvl.custom38A_configs[0].data[0].key == 0x7);
+    REQUIRE(lvl.custom38A_configs[0].data[0].value == 0x240);
+    REQUIRE(lvl.custom38A_configs[1].type == LevelItemSetup38A::BGO);
+    REQUIRE(lvl.custom38A_configs[1].id == 172);
+    REQUIRE(lvl.custom38A_configs[2].type == LevelItemSetup38A::EFFECT);
+    REQUIRE(lvl.custom38A_configs[2].id == 5);
+
+    REQUIRE(lvl.sound_overrides.size() == 2);
+    REQUIRE(lvl.sound_overrides[1].id == 3);
+    REQUIRE(lvl.sound_overrides[1].fileName == "b");
+
+    REQUIRE(lvl.unsupported_38a_lines.size() == 6);
+    REQUIRE(lvl.unsupported_38a_lines[0] == "BTNSX|1");
+    REQUIRE(lvl.unsupported_38a_lines[1] == "BT|2");
+    REQUIRE(lvl.unsupported_38a_lines[2] == "P3|50|60");
+    REQUIRE(lvl.unsupported_38a_lines[3] == "sU|%4A|Yw==");
+    REQUIRE(lvl.unsupported_38a_lines[4] == "CX|6|000101");
+    REQUIRE(lvl.unsupported_38a_lines[5] == "ZZZZ|q");
+}
+
+TEST_CASE("[WorldFile] SMBX-38A records are dispatched by their identifiers")
+{
+    const PGESTRING rawData =
+        "SMBXFile67\n"
+        "WS1|%45%70|0,0,0,0,0|,|0,0,0,1,0,1,0,0,1|5,2|0|0\n"
+        "WS2|#CUST#QXV0aG9y|\n"
+        "WS3|%61%2C%62\n"
+        "WS4|%6C|%6D\n"
+        "WS5|x\n"
+        "WS|y\n"
+        "T|102|416|224|\n"
+        "S|6|112|256|\n"
+        "P|2|352|256|\n"
+        "M|1|384|384|||32|32|1|%66%61%72%74,1\n"
+        "M|3|0|0|||64|32|1|,\n"
+        "L|22|704|384|||-1,0,0,\\-1,0,0,\\-1,0,0,\\-1,0,0,\\|-1|-1|0|0,0,0,0,0,0,0,0,0|||\n"
+        "WL|%44%65%66%61%75%6C%74|1\n"
+        "WE|%66%61%72%74|0///||0/0,0,0,0,,|0/0/,0///-1,-1,0\n"
+        "WCT|1|000120\n"
+        "WCS|2|000220\n"
+        "WCL|3|000302\n"
+        "WCX|4|000302\n"
+        "WC|5|000302\n";
+
+    WorldData wld;
+    REQUIRE(FileFormats::ReadSMBX38AWldFileRaw(rawData, "records.wld", wld));
+    REQUIRE(wld.meta.ReadFileValid);
+
+    REQUIRE(wld.EpisodeTitle == "Ep");
+    REQUIRE(wld.stars == 5);
+    REQUIRE(wld.authors == "Author");
+    REQUIRE(wld.cheatsList.size() == 2);
+    REQUIRE(wld.cheatsList[1] == "b");
+    REQUIRE(wld.saveLockerEx == "l");
+    REQUIRE(wld.saveLockerMsg == "m");
+
+    REQUIRE(wld.tiles.size() == 1);
+    REQUIRE(wld.tiles[0].id == 102);
+    REQUIRE(wld.tiles[0].x == 416);
+    REQUIRE(wld.scenery.size() == 1);
+    REQUIRE(wld.scenery[0].id == 6);
+    REQUIRE(wld.scenery[0].y == 256);
+    REQUIRE(wld.paths.size() == 1);
+    REQUIRE(wld.paths[0].id == 2);
+    REQUIRE(wld.paths[0].x == 352);
+
+    REQUIRE(wld.music.size() == 1);
+    REQUIRE(wld.music[0].id == 1);
+    REQUIRE(wld.arearects.size() == 1);
+    REQUIRE(wld.arearects[0].music_id == 3);
+    REQUIRE(wld.arearects[0].w == 64);
+
+    REQUIRE(wld.levels.size() == 1);
+    REQUIRE(wld.levels[0].id == 22);
+    REQUIRE(wld.levels[0].x == 704);
+
+    REQUIRE(wld.layers.size() == 1);
+    REQUIRE(wld.layers[0].name == "Default");
+    REQUIRE(wld.events38A.size() == 1);
+    REQUIRE(wld.events38A[0].name == "fart");
+
+    REQUIRE(wld.custom38A_configs.size() == 3);
+    REQUIRE(wld.custom38A_configs[0].type == WorldItemSetup38A::TERRAIN);
+    REQUIRE(wld.custom38A_configs[0].id == 1);
+    REQUIRE(wld.custom38A_configs[0].data.size() == 1);
+    REQUIRE(wld.custom38A_configs[0].data[0].key == 0x1);
+    REQUIRE(wld.custom38A_configs[0].data[0].value == 0x20);
+    REQUIRE(wld.custom38A_configs[1].type == WorldItemSetup38A::SCENERY);
+    REQUIRE(wld.custom38A_configs[1].id == 2);
+    REQUIRE(wld.custom38A_configs[2].type == WorldItemSetup38A::LEVEL);
+    REQUIRE(wld.custom38A_configs[2].id == 3);
+
+    REQUIRE(wld.unsupported_38a_lines.size() == 4);
+    REQUIRE(wld.unsupported_38a_lines[0] == "WS5|x");
+    REQUIRE(wld.unsupported_38a_lines[1] == "WS|y");
+    REQUIRE(wld.unsupported_38a_lines[2] == "WCX|4|000302");
+    REQUIRE(wld.unsupported_38a_lines[3] == "WC|5|000302");
+}
+
+TEST_CASE("[LevelFile] PGE-X markers of blocks and NPCs are dispatched to their fields")
+{
+    // Each item sets every known marker to the value different from the default,
+    // and adds unknown markers sharing first characters with known ones
+    const PGESTRING rawData =
+        "BLOCK\n"
+        "ID:5;X:-16;Y:32;W:64;H:96;AS:1;GXN:\"gfx\";GXX:-2;GXY:3;CN:-7;CS:11;IV:1;SL:1;MA:4;"
+        "S1:12;S2:13;LR:\"Lay\";ED:\"Ed\";EH:\"Eh\";EE:\"Ee\";XTRA:\"bx\";"
+        "IDX:9;I:9;GX:8;S3:1;E:\"e\";XTRAS:\"z\";ABCDEFGH:1;ABCDEFGHIJ:2;\n"
+        "BLOCK_END\n"
+        "NPC\n"
+        "ID:17;X:100;Y:-200;GXN:\"ng\";GXX:4;GXY:-5;OW:48;OH:64;GAS:1;WGT:2;WGS:3;D:1;CN:8;"
+        "S1:21;S2:22;GE:1;GT:2;GD:3;GM:45;GA:12.5;GB:6;GR:90.5;GS:7.25;MG:\"hello\";FD:1;NM:1;BS:1;"
+        "LR:\"NL\";LA:\"NA\";SV:\"var\";EA:\"ea\";ED:\"ed\";ET:\"et\";EE:\"ee\";EG:\"eg\";EO:\"eo\";EF:\"ef\";XTRA:\"nx\";"
+        "G:1;GSX:1;WG:1;EX:\"x\";IDENTITY:3;ID2:4;\n"
+        "NPC_END\n";
+
+    LevelData lvl;
+    REQUIRE(FileFormats::ReadExtendedLvlFileRaw(rawData, "markers.lvlx", lvl));
+    REQUIRE(lvl.meta.ReadFileValid);
+
+    REQUIRE(lvl.blocks.size() == 1);
+    const LevelBlock &b = lvl.blocks[0];
+    REQUIRE(b.id == 5);
+    REQUIRE(b.x == -16);
+    REQUIRE(b.y == 32);
+    REQUIRE(b.w == 64);
+    REQUIRE(b.h == 96);
+    REQUIRE(b.autoscale);
+    REQUIRE(b.gfx_name == "gfx");
+    REQUIRE(b.gfx_dx == -2);
+    REQUIRE(b.gfx_dy == 3);
+    REQUIRE(b.npc_id == -7);
+    REQUIRE(b.npc_special_value == 11);
+    REQUIRE(b.invisible);
+    REQUIRE(b.slippery);
+    REQUIRE(b.motion_ai_id == 4);
+    REQUIRE(b.special_data == 12);
+    REQUIRE(b.special_data2 == 13);
+    REQUIRE(b.layer == "Lay");
+    REQUIRE(b.event_destroy == "Ed");
+    REQUIRE(b.event_hit == "Eh");
+    REQUIRE(b.event_emptylayer == "Ee");
+    REQUIRE(b.meta.custom_params == "bx");
+
+    REQUIRE(lvl.npc.size() == 1);
+    const LevelNPC &n = lvl.npc[0];
+    REQUIRE(n.id == 17);
+    REQUIRE(n.x == 100);
+    REQUIRE(n.y == -200);
+    REQUIRE(n.gfx_name == "ng");
+    REQUIRE(n.gfx_dx == 4);
+    REQUIRE(n.gfx_dy == -5);
+    REQUIRE(n.override_width == 48);
+    REQUIRE(n.override_height == 64);
+    REQUIRE(n.gfx_autoscale);
+    REQUIRE(n.wings_type == 2);
+    REQUIRE(n.wings_style == 3);
+    REQUIRE(n.direct == 1);
+    REQUIRE(n.contents == 8);
+    REQUIRE(n.special_data == 21);
+    REQUIRE(n.special_data2 == 22);
+    REQUIRE(n.generator);
+    REQUIRE(n.generator_type == 2);
+    REQUIRE(n.generator_direct == 3);
+    REQUIRE(n.generator_period == 45);
+    REQUIRE(n.generator_custom_angle == 12.5);
+    REQUIRE(n.generator_branches == 6);
+    REQUIRE(n.generator_angle_range == 90.5);
+    REQUIRE(n.generator_initial_speed == 7.25);
+    REQUIRE(n.msg == "hello");
+    REQUIRE(n.friendly);
+    REQUIRE(n.nomove);
+    REQUIRE(n.is_boss);
+    REQUIRE(n.layer == "NL");
+    REQUIRE(n.attach_layer == "NA");
+    REQUIRE(n.send_id_to_variable == "var");
+    REQUIRE(n.event_activate == "ea");
+    REQUIRE(n.event_die == "ed");
+    REQUIRE(n.event_talk == "et");
+    REQUIRE(n.event_emptylayer == "ee");
+    REQUIRE(n.event_grab == "eg");
+    REQUIRE(n.event_touch == "eo");
+    REQUIRE(n.event_nextframe == "ef");
+    REQUIRE(n.meta.custom_params == "nx");
+}
+
+TEST_CASE("[WorldFile] PGE-X markers of level entrances are dispatched to their fields")
+{
+    const PGESTRING rawData =
+        "LEVELS\n"
+        "ID:3;X:64;Y:-96;LF:\"a.lvlx\";LT:\"Title\";EI:2;ET:1;EL:2;ER:3;EB:4;WX:128;WY:-160;"
+        "AV:1;SP:1;BP:1;BG:1;SSS:2;XTRA:\"lx\";"
+        "E:1;EIX:1;SSSS:1;B:1;LFX:\"x\";UNKNOWN:1;UNKNOWNMARKER:2;\n"
+        "LEVELS_END\n";
+
+    WorldData wld;
+    REQUIRE(FileFormats::ReadExtendedWldFileRaw(rawData, "markers.wldx", wld));
+    REQUIRE(wld.meta.ReadFileValid);
+
+    REQUIRE(wld.levels.size() == 1);
+    const WorldLevelTile &l = wld.levels[0];
+    REQUIRE(l.id == 3);
+    REQUIRE(l.x == 64);
+    REQUIRE(l.y == -96);
+    REQUIRE(l.lvlfile == "a.lvlx");
+    REQUIRE(l.title == "Title");
+    REQUIRE(l.entertowarp == 2);
+    REQUIRE(l.top_exit == 1);
+    REQUIRE(l.left_exit == 2);
+    REQUIRE(l.right_exit == 3);
+    REQUIRE(l.bottom_exit == 4);
+    REQUIRE(l.gotox == 128);
+    REQUIRE(l.gotoy == -160);
+    REQUIRE(l.alwaysVisible);
+    REQUIRE(l.gamestart);
+    REQUIRE(l.pathbg);
+    REQUIRE(l.bigpathbg);
+    REQUIRE(l.starsShowPolicy == 2);
+    REQUIRE(l.meta.custom_params == "lx");
+}
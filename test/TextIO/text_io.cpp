@@ -0,0 +1,903 @@
+#include <catch.hpp>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+#include "pge_file_lib_globs.h"
+#include "pge_file_lib_private.h"
+#include "file_strlist.h"
+#include "CSVReaderPGE.h"
+#include "smbx38a_private.h"
+#include "pge_x.h"
+
+using PGE_FileFormats_misc::TextOutput;
+using PGE_FileFormats_misc::RawTextOutput;
+
+
+TEST_CASE("[RawTextOutput] Overwrite and append")
+{
+    PGESTRING data = "0123456789";
+    RawTextOutput out(&data, TextOutput::overwrite);
+
+    REQUIRE(out.tell() == 0);
+    REQUIRE(out.write("abc", 3) == 3);
+    REQUIRE(data == "abc3456789");
+    REQUIRE(out.tell() == 3);
+
+    // Crossing the end of the existing data
+    REQUIRE(out.seek(8, TextOutput::begin) == 0);
+    REQUIRE(out.write("XYZW", 4) == 4);
+    REQUIRE(data == "abc34567XYZW");
+    REQUIRE(out.tell() == 12);
+
+    out << "!" << PGESTRING("?");
+    REQUIRE(data == "abc34567XYZW!?");
+    REQUIRE(out.tell() == 14);
+
+    REQUIRE(out.seek(-3, TextOutput::end) == 0);
+    out << "-";
+    REQUIRE(data == "abc34567XYZ-!?");
+    REQUIRE(out.tell() == 12);
+
+    RawTextOutput app(&data, TextOutput::append);
+    app << "END";
+    REQUIRE(data == "abc34567XYZ-!?END");
+
+    RawTextOutput trunc(&data, TextOutput::truncate);
+    REQUIRE(data.size() == 0);
+    trunc << "new";
+    REQUIRE(data == "new");
+}
+
+TEST_CASE("[RawTextOutput] Overwrite of a large buffer", "[.][benchmark]")
+{
+    const int bufferSize = 8 * 1024 * 1024;
+    const char chunk[] = "abcdefghijklmnopqrstuvwxyz0123456789\n";
+    const size_t chunkLen = sizeof(chunk) - 1;
+
+    PGESTRING data;
+    for(int i = 0; i < bufferSize; i++)
+        data.push_back('-');
+
+    auto start = std::chrono::steady_clock::now();
+
+    RawTextOutput out(&data, TextOutput::overwrite);
+    int64_t total = 0;
+    while(total < bufferSize + 1024)
+        total += out.write(chunk, chunkLen);
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    WARN("Overwrite of " << bufferSize << " bytes took " << elapsed.count() << " ms");
+
+    REQUIRE(out.tell() == total);
+    REQUIRE(static_cast<int64_t>(data.size()) == total);
+    for(int64_t i = 0; i < total; i += 4099)
+        REQUIRE(data[static_cast<int>(i)] == chunk[i % static_cast<int64_t>(chunkLen)]);
+}
+
+TEST_CASE("[ViewTextInput] Matches RawTextInput")
+{
+    using PGE_FileFormats_misc::TextInput;
+    using PGE_FileFormats_misc::RawTextInput;
+    using PGE_FileFormats_misc::ViewTextInput;
+
+    const std::string src = "SMBXFile64\r\n\"quoted, text\",12,-5\n\n#TRUE#\r\n\"multi\nline\"\nlast";
+    PGESTRING rawString = src;
+
+    RawTextInput raw(&rawString, "test.lvl");
+    ViewTextInput view(src.data(), src.size(), "test.lvl");
+
+    REQUIRE(view.getFilePath() == raw.getFilePath());
+    REQUIRE(view.read(8) == raw.read(8));
+    REQUIRE(view.tell() == raw.tell());
+
+    REQUIRE(view.seek(0, TextInput::begin) == raw.seek(0, TextInput::begin));
+    while(!raw.eof())
+    {
+        REQUIRE(!view.eof());
+        REQUIRE(view.readCVSLine() == raw.readCVSLine());
+        REQUIRE(view.getCurrentLineNumber() == raw.getCurrentLineNumber());
+        REQUIRE(view.tell() == raw.tell());
+    }
+    REQUIRE(view.eof());
+
+    REQUIRE(view.seek(-10, TextInput::end) == raw.seek(-10, TextInput::end));
+    REQUIRE(view.seek(0, TextInput::begin) == raw.seek(0, TextInput::begin));
+    while(!raw.eof())
+    {
+        REQUIRE(!view.eof());
+        REQUIRE(view.readLine() == raw.readLine());
+        REQUIRE(view.getCurrentLineNumber() == raw.getCurrentLineNumber());
+    }
+    REQUIRE(view.eof());
+
+    REQUIRE(view.readAll() == raw.readAll());
+}
+
+TEST_CASE("[ViewTextInput] Null pointer is an empty input")
+{
+    using PGE_FileFormats_misc::TextInput;
+    using PGE_FileFormats_misc::ViewTextInput;
+
+    ViewTextInput view;
+    REQUIRE(view.open(nullptr, 0, "empty.lvl"));
+    REQUIRE(view.eof());
+    REQUIRE(view.readLine() == "");
+    REQUIRE(view.readCVSLine() == "");
+    REQUIRE(view.readAll() == "");
+    REQUIRE(view.seek(0, TextInput::begin) == 0);
+    REQUIRE(view.getCurrentLineNumber() == 0);
+
+    REQUIRE(!view.open(nullptr, 10));
+}
+
+TEST_CASE("[Numbers] Formatting of numbers")
+{
+    REQUIRE(fromNum(0) == "0");
+    REQUIRE(fromNum(-2147483647 - 1) == "-2147483648");
+    REQUIRE(fromNum(18446744073709551615ull) == "18446744073709551615");
+    REQUIRE(fromBoolToNum(true) == "1");
+    REQUIRE(fromNum(0.5) == "0.5");
+    REQUIRE(fromNum(0.3f) == "0.3");
+    REQUIRE(fromNum(-32.0) == "-32");
+    REQUIRE(fromNum(1e-05) == "1e-05");
+    // Values that didn't fit into 6 digits of precision are no longer truncated
+    REQUIRE(fromNum(1234567.0) == "1234567");
+    REQUIRE(fromNum(0.123456789) == "0.123456789");
+    REQUIRE(std::strtod(fromNum(0.1 + 0.2).c_str(), nullptr) == 0.1 + 0.2);
+
+    // Numbers written into the output directly match the formatted strings
+    PGESTRING data;
+    RawTextOutput out(&data, TextOutput::truncate);
+    out << PGE_NUM_OUT(-2147483647 - 1) << "|" << PGE_NUM_OUT(18446744073709551615ull)
+        << "|" << PGE_NUM_OUT(0.3f) << "|" << PGE_NUM_OUT(0.123456789)
+        << "|" << PGE_FileFormats_misc::numOut(-32.0, true);
+    REQUIRE(data == "-2147483648|18446744073709551615|0.3|0.123456789|-32\n");
+}
+
+TEST_CASE("[CSVReader] Fields of the line")
+{
+    using namespace ::CSVReader;
+
+    PGESTRING line = "N|-12|4000000000|0.25|!0|name|";
+    auto lineReader = MakeDirectReader(line);
+    auto reader = MakeCSVReaderForPGESTRING(&lineReader, '|');
+
+    int i = 0;
+    unsigned long ul = 0;
+    double d = 0.0;
+    bool b = false;
+    PGESTRING name, empty = "x";
+    reader.ReadDataLine(CSVDiscard(), &i, &ul, &d, &b, &name, &empty);
+    REQUIRE(i == -12);
+    REQUIRE(ul == 4000000000ul);
+    REQUIRE(d == 0.25);
+    REQUIRE(b);
+    REQUIRE(name == "name");
+    REQUIRE(empty == "");
+
+    // Invalid numbers are reported like std::sto*() functions do
+    const char *bad[] = {"", "abc", " 99999999999", "1.5e99999"};
+    for(const char *field : bad)
+    {
+        const bool isFloat = std::strchr(field, '.') != nullptr;
+        std::string expected, actual;
+        try
+        {
+            if(isFloat)
+                std::stof(field);
+            else
+                std::stoi(field);
+        }
+        catch(const std::exception &e)
+        {
+            expected = e.what();
+        }
+
+        PGESTRING badLine = PGESTRING("1|") + field;
+        auto badLineReader = MakeDirectReader(badLine);
+        auto badReader = MakeCSVReaderForPGESTRING(&badLineReader, '|');
+        try
+        {
+            float f;
+            if(isFloat)
+                badReader.ReadDataLine(&i, &f);
+            else
+                badReader.ReadDataLine(&i, &i);
+        }
+        catch(const std::exception &e)
+        {
+            try
+            {
+                std::rethrow_if_nested(e);
+            }
+            catch(const std::exception &nested)
+            {
+                actual = nested.what();
+            }
+        }
+        REQUIRE(!expected.empty());
+        REQUIRE(actual == expected);
+    }
+}
+
+template<class ClampFunc>
+static double readLinesTime(const PGESTRING &line, int count, const ClampFunc &clamp, long &checksum)
+{
+    using namespace ::CSVReader;
+
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < count; i++)
+    {
+        auto lineReader = MakeDirectReader(line);
+        auto reader = MakeCSVReaderForPGESTRING(&lineReader, '|');
+        int x, y, w, h;
+        PGESTRING layer;
+        reader.ReadDataLine(CSVDiscard(),
+                            MakeCSVPostProcessor(&x, clamp),
+                            MakeCSVPostProcessor(&y, clamp),
+                            MakeCSVPostProcessor(&w, clamp),
+                            MakeCSVPostProcessor(&h, clamp),
+                            &layer);
+        checksum += x + y + w + h + static_cast<long>(layer.size());
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    return static_cast<double>(elapsed.count()) / count;
+}
+
+TEST_CASE("[SMBX38A] Minimum post-processor")
+{
+    SMBX38A_MinFunc<int> clamp = MakeMinFunc<int>(0);
+    int value = -5;
+    clamp(value);
+    REQUIRE(value == 0);
+    value = 7;
+    clamp(value);
+    REQUIRE(value == 7);
+
+    long checksum = 0;
+    readLinesTime("B|-12|34|-5|600|Layer%201", 1, clamp, checksum);
+    REQUIRE(checksum == 34 + 600 + 9);
+}
+
+TEST_CASE("[SMBX38A] Record type identifiers")
+{
+    static_assert(SMBX38A_RecordId("BTNS") == 0x42544E53u, "Record identifier must be packed at compile time");
+    REQUIRE(SMBX38A_RecordId(CSVPGESTRINGField("BTNS")) == SMBX38A_RecordId("BTNS"));
+    REQUIRE(SMBX38A_RecordId(CSVPGESTRINGField("Su")) == SMBX38A_RecordId("Su"));
+    REQUIRE(SMBX38A_RecordId(CSVPGESTRINGField("BTNS1")) == 0);
+    REQUIRE(SMBX38A_RecordId(CSVPGESTRINGField("")) == 0);
+}
+
+TEST_CASE("[CSVReader] Post-processors per line", "[.][benchmark]")
+{
+    const int lines = 200000;
+    const PGESTRING line = "B|-12|34|-5|600|Layer%201";
+    SMBX38A_MinFunc<int> clamp = MakeMinFunc<int>(0);
+    std::function<void(int &)> erasedClamp = clamp;
+
+    long concreteSum = 0, erasedSum = 0;
+    double erased = readLinesTime(line, lines, erasedClamp, erasedSum);
+    double concrete = readLinesTime(line, lines, clamp, concreteSum);
+    WARN("Line with std::function post-processors: " << erased << " ns, with SMBX38A_MinFunc: " << concrete << " ns");
+
+    REQUIRE(concreteSum == erasedSum);
+    REQUIRE(concreteSum == lines * (34 + 600 + 9));
+}
+
+TEST_CASE("[PGE-X] Integer arrays")
+{
+    struct IntArrCase
+    {
+        const char *input;
+        bool valid;
+        std::vector<long> values;
+    };
+    const IntArrCase cases[] =
+    {
+        {"[]", true, {}},
+        {"[1,2]", true, {1, 2}},
+        {"[-1]", true, {-1}},
+        {"[0,-0,007]", true, {0, 0, 7}},
+        {"[1,]", true, {1}}, // The trailing comma was accepted by "^\[(\-?\d+,?)*\]$" too
+        {"[1,,2]", false, {}},
+        {"[,1]", false, {}},
+        {"[-]", false, {}},
+        {"[1 ,2]", false, {}},
+        {"[1,2", false, {}},
+        {"1,2", false, {}},
+        {"", false, {}}
+    };
+
+    for(const IntArrCase &c : cases)
+    {
+        CAPTURE(c.input);
+        REQUIRE(PGEFile::IsIntArray(c.input) == c.valid);
+
+        PGELIST<long> out;
+        REQUIRE(PGEFile::X2IntArr(c.input, out) == c.valid);
+        if(c.valid)
+            REQUIRE(std::vector<long>(out.begin(), out.end()) == c.values);
+
+        bool valid = !c.valid;
+        PGELIST<long> arr = PGEFile::X2IntArr(c.input, &valid);
+        REQUIRE(valid == c.valid);
+        REQUIRE(std::vector<long>(arr.begin(), arr.end()) == c.values);
+    }
+
+    // Values out of range are saturated
+    PGELIST<long> out;
+    REQUIRE(PGEFile::X2IntArr("[99999999999999999999999,-99999999999999999999999]", out));
+    REQUIRE(out.size() == 2);
+    REQUIRE(out[0] == LONG_MAX);
+    REQUIRE(out[1] == LONG_MIN);
+
+    PGESTRING limits = "[" + fromNum(LONG_MAX) + "," + fromNum(LONG_MIN) + "]";
+    REQUIRE(PGEFile::IsIntArray(limits));
+    REQUIRE(PGEFile::X2IntArr(limits, out));
+    REQUIRE(out.size() == 2);
+    REQUIRE(out[0] == LONG_MAX);
+    REQUIRE(out[1] == LONG_MIN);
+}
+
+TEST_CASE("[PGE-X] Boolean and string arrays")
+{
+    PGELIST<bool> flags;
+    REQUIRE(PGEFile::IsBoolArray("0110"));
+    REQUIRE(PGEFile::X2BollArr("0110", flags));
+    REQUIRE(flags.size() == 4);
+    REQUIRE((!flags[0] && flags[1] && flags[2] && !flags[3]));
+
+    REQUIRE(PGEFile::IsBoolArray(""));
+    REQUIRE(PGEFile::X2BollArr("", flags));
+    REQUIRE(flags.empty());
+
+    REQUIRE(!PGEFile::IsBoolArray("012"));
+    REQUIRE(!PGEFile::X2BollArr("012", flags));
+
+    PGESTRINGList strings;
+    strings.push_back("a,b");
+    strings.push_back("[x]");
+    strings.push_back("\"quoted\";\\");
+    strings.push_back("");
+    PGESTRING encoded = PGEFile::WriteStrArr(strings);
+    REQUIRE(encoded == "[\"a\\,b\",\"\\[x\\]\",\"\\\"quoted\\\"\\;\\\\\",\"\"]");
+    REQUIRE(PGEFile::IsStringArray(encoded));
+
+    PGESTRINGList decoded;
+    REQUIRE(PGEFile::X2STRArr(encoded, decoded));
+    REQUIRE(decoded == strings);
+
+    bool valid = false;
+    REQUIRE(PGEFile::X2STRArr(encoded, &valid) == strings);
+    REQUIRE(valid);
+
+    // Empty list is written as an empty value, "[]" has never been a valid string array
+    REQUIRE(PGEFile::WriteStrArr(PGESTRINGList()) == "");
+    REQUIRE(PGEFile::X2STRArr("", decoded));
+    REQUIRE(decoded.empty());
+    REQUIRE(!PGEFile::IsStringArray("[]"));
+    REQUIRE(!PGEFile::X2STRArr("[]", decoded));
+
+    // Unescaped comma inside the entry, missing comma between entries, no brackets
+    const char *broken[] = {"[\"a,b\"]", "[\"a\"\"b\"]", "\"a\"", "[\"a\",]"};
+    for(const char *b : broken)
+    {
+        CAPTURE(b);
+        REQUIRE(!PGEFile::IsStringArray(b));
+        REQUIRE(!PGEFile::X2STRArr(b, decoded));
+    }
+}
+
+static PGESTRING escapeScalar(const PGESTRING &in)
+{
+    PGESTRING out;
+    for(pge_size_t i = 0; i < in.size(); i++)
+    {
+        switch(PGEGetChar(in[i]))
+        {
+        case '\n':
+            out.push_back('\\');
+            out.push_back('n');
+            break;
+        case '\r':
+            out.push_back('\\');
+            out.push_back('r');
+            break;
+        case '\"': case '\\': case ';': case ':': case '[': case ']': case ',': case '%':
+            out.push_back('\\');
+            out.push_back(in[i]);
+            break;
+        default:
+            out.push_back(in[i]);
+            break;
+        }
+    }
+    return out;
+}
+
+TEST_CASE("[PGE-X] Escaping around vector boundaries")
+{
+    const char specials[] = {'\"', '\\', ';', ':', '[', ']', ',', '%', '\n', '\r'};
+    const pge_size_t positions[] = {0, 15, 16, 31, 32};
+
+    std::vector<PGESTRING> samples;
+    for(pge_size_t len : {0, 1, 15, 16, 17, 31, 32, 33, 64})
+        samples.push_back(PGESTRING(static_cast<int>(len), 'p')); // All-plain
+    for(char special : specials)
+    {
+        for(pge_size_t pos : positions)
+        {
+            PGESTRING sample(48, 'x');
+            sample[static_cast<int>(pos)] = special;
+            samples.push_back(sample);
+            sample[47] = special; // Another one after the first one
+            samples.push_back(sample);
+        }
+    }
+
+    for(const PGESTRING &sample : samples)
+    {
+        CAPTURE(sample);
+        const PGESTRING expected = escapeScalar(sample);
+
+        PGESTRING escaped;
+        PGEFile::escapeString(escaped, sample);
+        REQUIRE(escaped == expected);
+        PGEFile::escapeString(escaped, sample, true);
+        REQUIRE(escaped == "\"" + expected + "\"");
+        REQUIRE(PGEFile::WriteStr(sample) == escaped);
+
+        REQUIRE(PGEFile::X2STRING(escaped) == sample);
+        PGESTRING decoded = "garbage";
+        PGEFile::X2STRING(escaped, decoded);
+        REQUIRE(decoded == sample);
+
+        PGESTRING restored = escaped;
+        PGEFile::restoreString(restored, true);
+        REQUIRE(restored == sample);
+        restored = expected;
+        PGEFile::restoreString(restored);
+        REQUIRE(restored == sample);
+    }
+}
+
+TEST_CASE("[PGE-X] Data tree from hand-written input")
+{
+    SECTION("Sections, blank lines, sub-sections and plain text")
+    {
+        const PGESTRING raw =
+            "HEAD\n"
+            "TL:\"Test\";ID:1;\n"
+            "HEAD_END\n"
+            "\n"
+            "   \n"
+            "BLOCK\n"
+            "ID:1;X:0;\n"
+            "ID:2;X:32;Y:-64;\n"
+            "BLOCK_END\n"
+            "  \n"
+            "LAYERS\n"
+            "NESTED\n"
+            "NM:\"a\\;b\";\n"
+            "NESTED_END\n"
+            "BROKEN\n"
+            "a:b:c;\n"
+            "BROKEN_END\n"
+            "CT:2;\n"
+            "LAYERS_END\n"
+            "PLAIN\n"
+            "a:b:c;\n"
+            "text\n"
+            "PLAIN_END\n"
+            "LAST\n"
+            "V:1;\n"
+            "LAST_END"; // No trailing line feed
+
+        PGEFile f(raw);
+        REQUIRE(f.buildTreeFromRaw());
+        REQUIRE(f.dataTree.size() == 5);
+
+        const PGEFile::PGEX_Entry &head = f.dataTree[0];
+        REQUIRE(head.name == "HEAD");
+        REQUIRE(head.type == PGEFile::PGEX_Struct);
+        REQUIRE(head.subTree.empty());
+        REQUIRE(head.data.size() == 1);
+        REQUIRE(head.data[0].values.size() == 2);
+        REQUIRE(head.data[0].values[0].marker == "TL");
+        REQUIRE(head.data[0].values[0].value == "\"Test\"");
+        REQUIRE(head.data[0].values[1].marker == "ID");
+        REQUIRE(head.data[0].values[1].value == "1");
+
+        const PGEFile::PGEX_Entry &block = f.dataTree[1];
+        REQUIRE(block.name == "BLOCK");
+        REQUIRE(block.type == PGEFile::PGEX_Struct);
+        REQUIRE(block.data.size() == 2);
+        REQUIRE(block.data[0].values.size() == 2);
+        REQUIRE(block.data[1].values.size() == 3);
+        REQUIRE(block.data[1].values[2].marker == "Y");
+        REQUIRE(block.data[1].values[2].value == "-64");
+
+        const PGEFile::PGEX_Entry &layers = f.dataTree[2];
+        REQUIRE(layers.name == "LAYERS");
+        REQUIRE(layers.type == PGEFile::PGEX_Struct);
+        REQUIRE(layers.data.size() == 1);
+        REQUIRE(layers.data[0].values.size() == 1);
+        REQUIRE(layers.data[0].values[0].marker == "CT");
+        REQUIRE(layers.data[0].values[0].value == "2");
+        REQUIRE(layers.subTree.size() == 2);
+
+        const PGEFile::PGEX_Entry &nested = layers.subTree[0];
+        REQUIRE(nested.name == "NESTED");
+        REQUIRE(nested.type == PGEFile::PGEX_Struct);
+        REQUIRE(nested.data.size() == 1);
+        REQUIRE(nested.data[0].values.size() == 1);
+        REQUIRE(nested.data[0].values[0].marker == "NM");
+        REQUIRE(nested.data[0].values[0].value == "\"a\\;b\"");
+
+        // Invalid sub-section is stored as plain text under its own name
+        const PGEFile::PGEX_Entry &broken = layers.subTree[1];
+        REQUIRE(broken.name == "BROKEN");
+        REQUIRE(broken.type == PGEFile::PGEX_PlainText);
+        REQUIRE(broken.subTree.empty());
+        REQUIRE(broken.data.size() == 1);
+        REQUIRE(broken.data[0].type == PGEFile::PGEX_PlainText);
+        REQUIRE(broken.data[0].values.size() == 1);
+        REQUIRE(broken.data[0].values[0].marker == "BROKEN");
+        REQUIRE(broken.data[0].values[0].value == "a:b:c;\n");
+
+        const PGEFile::PGEX_Entry &plain = f.dataTree[3];
+        REQUIRE(plain.name == "PLAIN");
+        REQUIRE(plain.type == PGEFile::PGEX_PlainText);
+        REQUIRE(plain.data.size() == 1);
+        REQUIRE(plain.data[0].values.size() == 1);
+        REQUIRE(plain.data[0].values[0].marker == "PlainText");
+        REQUIRE(plain.data[0].values[0].value == "a:b:c;\ntext\n");
+
+        const PGEFile::PGEX_Entry &last = f.dataTree[4];
+        REQUIRE(last.name == "LAST");
+        REQUIRE(last.type == PGEFile::PGEX_Struct);
+        REQUIRE(last.data.size() == 1);
+        REQUIRE(last.data[0].values.size() == 1);
+        REQUIRE(last.data[0].values[0].marker == "V");
+        REQUIRE(last.data[0].values[0].value == "1");
+    }
+
+    SECTION("Value at the end of data without a line feed")
+    {
+        PGEFile f(PGESTRING("ONE\nA:1;B:\"two\";\nONE_END\n\nTWO\nC:3;"));
+        REQUIRE_FALSE(f.buildTreeFromRaw());
+
+        PGEFile g(PGESTRING("ONE\nA:1;B:\"two\";\nONE_END\n\nTWO\nC:3;\nTWO_END"));
+        REQUIRE(g.buildTreeFromRaw());
+        REQUIRE(g.dataTree.size() == 2);
+        REQUIRE(g.dataTree[1].name == "TWO");
+        REQUIRE(g.dataTree[1].data.size() == 1);
+        REQUIRE(g.dataTree[1].data[0].values.size() == 1);
+        REQUIRE(g.dataTree[1].data[0].values[0].marker == "C");
+        REQUIRE(g.dataTree[1].data[0].values[0].value == "3");
+    }
+
+    SECTION("Missing end of section")
+    {
+        PGEFile f(PGESTRING("HEAD\nID:1;\nHEAD_END\nBLOCK\nID:1;\nID:2;\n"));
+        REQUIRE_FALSE(f.buildTreeFromRaw());
+        REQUIRE(f.dataTree.empty()); // Already built sections are dropped
+        REQUIRE(f.lastError() == "Section [BLOCK] is not closed");
+
+        // The end of another section does not close it
+        PGEFile g(PGESTRING("HEAD\nID:1;\nBLOCK_END\n"));
+        REQUIRE_FALSE(g.buildTreeFromRaw());
+        REQUIRE(g.dataTree.empty());
+        REQUIRE(g.lastError() == "Section [HEAD] is not closed");
+    }
+}
+
+#ifndef PGE_FILES_QT
+TEST_CASE("[URL] Decoding of URL-encoded strings")
+{
+    const char *cases[][2] =
+    {
+        {"", ""},
+        {"plain text", "plain text"},
+        {"Layer%201", "Layer 1"},
+        {"%41%62%63", "Abc"},
+        {"%4", "%4"},
+        {"%%41", "%A"},
+        {"50%", "50%"},
+        {"%zz%2", "%zz%2"},
+        {"%D0%9F%D1%80%D0%B8%D0%B2%D0%B5%D1%82", "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82"}
+    };
+
+    for(const auto &c : cases)
+    {
+        std::string inplace = c[0];
+        PGE_FileFormats_misc::url_decode_inplace(inplace);
+        REQUIRE(inplace == c[1]);
+        REQUIRE(PGE_FileFormats_misc::url_decode(c[0]) == c[1]);
+        REQUIRE(PGE_FileFormats_misc::url_decode(PGE_FileFormats_misc::url_encode(c[1])) == c[1]);
+        REQUIRE(PGE_FileFormats_misc::url_decode(PGE_FileFormats_misc::url_encode(c[1], true)) == c[1]);
+    }
+}
+
+TEST_CASE("[URL] Encoding of strings")
+{
+    using namespace PGE_FileFormats_misc;
+
+    REQUIRE(url_encode("") == "");
+    REQUIRE(url_encode("A b") == "%41%20%62");
+    // Separators of SMBX-38A fields must be always encoded
+    REQUIRE(url_encode("Layer 1|a,b/c:d%e\\f", true) == "Layer%201%7Ca%2Cb%2Fc%3Ad%25e%5Cf");
+    REQUIRE(url_encode("\xD0\x9F-_.~", true) == "%D0%9F-_.~");
+
+    std::string longName;
+    for(int i = 0; i < 1000; i++)
+        longName.push_back(static_cast<char>(i % 7 ? 'a' + i % 26 : ','));
+
+    PGESTRING data;
+    RawTextOutput out(&data, TextOutput::truncate);
+    out << "|" << UrlEncoded{longName, false} << "|" << UrlEncoded{longName, true};
+    REQUIRE(data == "|" + url_encode(longName) + "|" + url_encode(longName, true));
+}
+
+TEST_CASE("[Base64] Encoding and decoding")
+{
+    using namespace PGE_FileFormats_misc;
+
+    REQUIRE(base64_encode(std::string("")) == "");
+    REQUIRE(base64_encode(std::string("f")) == "Zg==");
+    REQUIRE(base64_encode(std::string("fo")) == "Zm8=");
+    REQUIRE(base64_encode(std::string("foo")) == "Zm9v");
+    REQUIRE(base64_encode(std::string("foob"), true) == "Zm9vYg");
+
+    REQUIRE(base64_decode("Zm9vYmFy") == "foobar");
+    REQUIRE(base64_decode("Zm9vYg==") == "foob");
+    REQUIRE(base64_decode("Zm9vYg") == "foob");
+    // Decoding stops at the first character out of the alphabet
+    REQUIRE(base64_decode("Zm9v YmFy") == "foo");
+    // The trailing zero is removed
+    REQUIRE(base64_decode("Zm9vAA==") == "foo");
+
+    std::string binary;
+    for(int i = 0; i < 1000; i++)
+        binary.push_back(static_cast<char>((i * 7 + 1) & 0xFF));
+    REQUIRE(base64_decode(base64_encode(binary)) == binary);
+
+    // Wide strings are stored as UTF-16LE
+    std::string text = "Hi \xD0\x9C\xD0\xB8\xD1\x80 \xF0\x9F\x98\x80";
+    REQUIRE(base64_encodeW(text) == "SABpACAAHAQ4BEAEIAA92ADe");
+    std::string encoded = base64_encodeW(text);
+    REQUIRE(base64_decodeW(encoded) == text);
+
+    // Every byte of a sequence with an invalid leading byte is replaced
+    const std::string replacement3 = "\xEF\xBF\xBD\xEF\xBF\xBD\xEF\xBF\xBD";
+    std::string invalid = "\xF8\x88\x80";
+    invalid = base64_encodeW(invalid);
+    REQUIRE(base64_decodeW(invalid) == replacement3);
+    invalid = "\xFF\xBF\xBF";
+    invalid = base64_encodeW(invalid);
+    REQUIRE(base64_decodeW(invalid) == replacement3);
+    invalid = "\xF5\x80\x80\x80";
+    invalid = base64_encodeW(invalid);
+    REQUIRE(base64_decodeW(invalid) == replacement3 + "\xEF\xBF\xBD");
+}
+
+// Inputs of the CR compaction: longer than vectors, CR at the vector boundaries, all-CR runs, trailing CR
+static std::vector<std::string> crSamples()
+{
+    std::vector<std::string> samples;
+    std::string boundaries(100, 'a');
+    for(size_t i = 0; i < boundaries.size(); i += 10)
+        boundaries[i + 9] = '\n';
+    boundaries[15] = '\r';
+    boundaries[16] = '\r';
+    boundaries[31] = '\r';
+    boundaries[32] = '\r';
+    boundaries[64] = '\r';
+    samples.push_back(boundaries);
+    samples.push_back(std::string(70, '\r'));
+    samples.push_back(std::string(40, 'b') + std::string(33, '\r') + "\n" + std::string(40, 'c'));
+    samples.push_back(std::string(40, 'd') + "\r\n" + std::string(30, 'e') + "\r");
+    samples.push_back("\r");
+
+    // Every CR period over the sizes around vector lengths
+    for(size_t len = 1; len <= 70; len++)
+    {
+        for(size_t period = 1; period <= 5; period++)
+        {
+            std::string s;
+            for(size_t i = 0; i < len; i++)
+                s.push_back((i % period == period - 1) ? '\r' : ((i % 7 == 6) ? '\n' : static_cast<char>('a' + i % 26)));
+            samples.push_back(s);
+        }
+    }
+    return samples;
+}
+
+static std::string removeCRScalar(const std::string &in)
+{
+    std::string out;
+    for(char c : in)
+    {
+        if(c != '\r')
+            out.push_back(c);
+    }
+    return out;
+}
+
+TEST_CASE("[TextInput] Removal of CR matches scalar one")
+{
+    using PGE_FileFormats_misc::RawTextInput;
+    using PGE_FileFormats_misc::TextFileInput;
+
+    for(const std::string &sample : crSamples())
+    {
+        const std::string expected = removeCRScalar(sample);
+
+        PGESTRING raw = sample;
+        RawTextInput rawIn(&raw);
+        REQUIRE(rawIn.readAll() == expected);
+
+        {
+            std::ofstream out("cr_sample.txt", std::ios::binary | std::ios::trunc);
+            out << sample;
+        }
+        TextFileInput fileIn("cr_sample.txt", false);
+        REQUIRE(fileIn.readAll() == expected);
+        fileIn.close();
+
+        std::vector<std::string> expectedLines;
+        std::string line;
+        for(char c : expected)
+        {
+            if(c != '\n')
+                line.push_back(c);
+            else if(!line.empty())
+            {
+                expectedLines.push_back(line);
+                line.clear();
+            }
+        }
+        if(!line.empty())
+            expectedLines.push_back(line);
+
+        FileStringList list;
+        list.addData(sample);
+        for(const std::string &expectedLine : expectedLines)
+        {
+            REQUIRE(!list.isEOF());
+            REQUIRE(list.readLine() == expectedLine);
+        }
+        REQUIRE(list.isEOF());
+    }
+
+    std::remove("cr_sample.txt");
+}
+
+TEST_CASE("[TextFileInput] CSV fields across the buffer refill")
+{
+    using PGE_FileFormats_misc::TextFileInput;
+    using PGE_FileFormats_misc::MappedTextFileInput;
+
+    // The buffer of the file input is 65536 bytes long: put a quoted multi-line field
+    // with the CR at 65535 and the LF at 65536, then an unquoted CRLF pair at the same place
+    const std::string quotedPrefix = std::string(65531, 'A') + "\n";
+    const std::string quoted = quotedPrefix + "\"ab\r\ncd,ef\"\nnext\r\nlast";
+    REQUIRE(quoted[65535] == '\r');
+    REQUIRE(quoted[65536] == '\n');
+
+    const std::string plainPrefix = std::string(65535, 'B');
+    const std::string plain = plainPrefix + "\r\n\"q,\"uoted\n";
+    REQUIRE(plain[65535] == '\r');
+    REQUIRE(plain[65536] == '\n');
+
+    struct Field
+    {
+        std::string value;
+        long lineNumber;
+    };
+    const std::vector<Field> quotedFields =
+    {
+        {std::string(65531, 'A'), 1},
+        {"ab\ncd,ef", 3},
+        {"next", 4},
+        {"last", 4}
+    };
+    const std::vector<Field> plainFields =
+    {
+        {plainPrefix, 1},
+        {"q,uoted", 2}
+    };
+
+    const std::pair<const std::string *, const std::vector<Field> *> samples[] =
+    {
+        {&quoted, &quotedFields},
+        {&plain, &plainFields}
+    };
+
+    for(const auto &sample : samples)
+    {
+        {
+            std::ofstream out("refill.txt", std::ios::binary | std::ios::trunc);
+            out << *sample.first;
+        }
+
+        TextFileInput file("refill.txt", false);
+        MappedTextFileInput mapped("refill.txt", false);
+        for(const Field &field : *sample.second)
+        {
+            REQUIRE(!file.eof());
+            REQUIRE(file.readCVSLine() == field.value);
+            REQUIRE(file.getCurrentLineNumber() == field.lineNumber);
+
+            REQUIRE(!mapped.eof());
+            REQUIRE(mapped.readCVSLine() == field.value);
+            REQUIRE(mapped.getCurrentLineNumber() == field.lineNumber);
+        }
+        REQUIRE(file.readCVSLine().empty());
+        REQUIRE(file.eof());
+        REQUIRE(mapped.readCVSLine().empty());
+        REQUIRE(mapped.eof());
+        file.close();
+        mapped.close();
+    }
+
+    std::remove("refill.txt");
+}
+#endif
+
+#ifdef PGE_FILES_QT
+TEST_CASE("[MappedTextFileInput] Matches Qt file input at edges")
+{
+    const char *samples[] =
+    {
+        "",
+        "64",
+        "64\r\n\"quoted,\r\nmulti-line\",#TRUE#\r\n",
+        "\n\n\"unclosed\nquote",
+        "\xEF\xBB\xBF" "64\r\n\"Byte order mark\"\r\n" // UTF-8 BOM is skipped by QTextStream
+    };
+
+    for(const char *sample : samples)
+    {
+        {
+            std::ofstream out("edges.lvl", std::ios::binary | std::ios::trunc);
+            out << sample;
+        }
+
+        PGE_FileFormats_misc::TextFileInput file;
+        PGE_FileFormats_misc::MappedTextFileInput mapped;
+        REQUIRE(file.open("edges.lvl", true));
+        REQUIRE(mapped.open("edges.lvl", true));
+        REQUIRE(file.eof() == mapped.eof());
+
+        while(!file.eof())
+        {
+            REQUIRE(file.readCVSLine() == mapped.readCVSLine());
+            REQUIRE(file.eof() == mapped.eof());
+            REQUIRE(file.getCurrentLineNumber() == mapped.getCurrentLineNumber());
+        }
+
+        REQUIRE(file.reOpen(true));
+        REQUIRE(mapped.reOpen(true));
+        while(!file.eof())
+        {
+            REQUIRE(file.readLine() == mapped.readLine());
+            REQUIRE(file.eof() == mapped.eof());
+            REQUIRE(file.getCurrentLineNumber() == mapped.getCurrentLineNumber());
+        }
+        REQUIRE(file.readAll() == mapped.readAll());
+
+        REQUIRE(file.seek(0, PGE_FileFormats_misc::TextInput::begin) == mapped.seek(0, PGE_FileFormats_misc::TextInput::begin));
+        REQUIRE(file.readLine() == mapped.readLine());
+    }
+
+    std::remove("edges.lvl");
+}
+#endif